@@ -0,0 +1,67 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <vector>
+#include <se/array.h>
+
+namespace {
+
+constexpr std::size_t kElements = 100000;
+
+struct record {
+  std::uint64_t key;
+  std::uint64_t value;
+};
+
+} // namespace
+
+// Inserting and erasing in the middle of a 1.6 MB array: each operation
+// shifts half of the elements, so the move kernel dominates.
+SE_BENCH(array_insert_erase) {
+  static const record item = {1, 2};
+
+  se_bench_run("std::vector insert+erase at middle", 1 << 12, [](std::size_t ops) {
+    std::vector<record> vector(kElements);
+    for (std::size_t i = 0; i < ops; ++i) {
+      vector.insert(vector.begin() + kElements / 2, item);
+      vector.erase(vector.begin() + kElements / 2);
+    }
+    se_bench_keep(vector.data());
+  });
+
+  se_bench_run("se_array insert+erase at middle", 1 << 12, [](std::size_t ops) {
+    se_array_t array;
+    se_array_init(&array, sizeof(record), nullptr);
+    se_array_reserve(&array, kElements + 1);
+    for (std::size_t i = 0; i < kElements; ++i) {
+      se_array_push(&array, &item);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_array_insert(&array, kElements / 2, &item, 1);
+      se_array_erase(&array, kElements / 2, 1);
+    }
+    se_bench_keep(array.data);
+    se_array_deinit(&array);
+  });
+}
+
+SE_BENCH(array_push) {
+  se_bench_run("std::vector push_back", 1 << 22, [](std::size_t ops) {
+    std::vector<record> vector;
+    for (std::size_t i = 0; i < ops; ++i) {
+      vector.push_back({i, i});
+    }
+    se_bench_keep(vector.data());
+  });
+
+  se_bench_run("se_array_push", 1 << 22, [](std::size_t ops) {
+    se_array_t array;
+    se_array_init(&array, sizeof(record), nullptr);
+    for (std::size_t i = 0; i < ops; ++i) {
+      const record item = {i, i};
+      se_array_push(&array, &item);
+    }
+    se_bench_keep(array.data);
+    se_array_deinit(&array);
+  });
+}
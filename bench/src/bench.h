@@ -0,0 +1,75 @@
+#ifndef SE_BENCH_H
+#define SE_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Minimal benchmark registry: every SE_BENCH body registers itself
+// at static initialization time and is run from main() by name filter.
+
+struct se_bench_case {
+  const char *name;
+  void (*fn)();
+};
+
+inline std::vector<se_bench_case> &se_bench_registry() {
+  static std::vector<se_bench_case> cases;
+  return cases;
+}
+
+struct se_bench_registrar {
+  se_bench_registrar(const char *name, void (*fn)()) {
+    se_bench_registry().push_back({name, fn});
+  }
+};
+
+#define SE_BENCH(name)                                                         \
+  static void name();                                                          \
+  static se_bench_registrar name##_registrar(#name, name);                     \
+  static void name()
+
+// Address sink for compilers without GNU inline assembly.
+inline const void *volatile se_bench_sink;
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T> inline void se_bench_keep(T const &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  // The escaped address forces the value into memory, the barrier keeps
+  // the store from being moved or merged across iterations
+  se_bench_sink = &value;
+#if defined(_MSC_VER)
+  _ReadWriteBarrier();
+#endif
+#endif
+}
+
+// Runs fn(ops) once for warm-up and `rounds` times measured,
+// then prints the best per-operation latency.
+template <typename F>
+inline double se_bench_run(const char *label, std::size_t ops, F &&fn,
+                           int rounds = 5) {
+  using clock = std::chrono::steady_clock;
+  fn(ops);
+  double best = 1e300;
+  for (int r = 0; r < rounds; ++r) {
+    const auto start = clock::now();
+    fn(ops);
+    const auto stop = clock::now();
+    const double ns =
+        std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+    if (ns < best) {
+      best = ns;
+    }
+  }
+  std::printf("  %-48s %10.2f ns/op\n", label, best);
+  return best;
+}
+
+#endif // SE_BENCH_H
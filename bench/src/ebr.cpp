@@ -0,0 +1,64 @@
+#include "bench.h"
+
+#include <memory>
+#include <se/runtime_allocator.h>
+#include <se/atomic.h>
+#include <se/ebr.h>
+
+namespace {
+
+constexpr std::size_t kOps = 1 << 20;
+
+} // namespace
+
+SE_BENCH(ebr) {
+  // Read-side protection: an atomic reference count is the usual alternative
+  auto shared = std::make_shared<int>(42);
+  se_bench_run("std::shared_ptr copy", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      std::shared_ptr<int> copy = std::atomic_load(&shared);
+      se_bench_keep(*copy);
+    }
+  });
+
+  int value = 42;
+  se_bench_run("se_ebr enter+leave", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_ebr_enter();
+      se_bench_keep(value);
+      se_ebr_leave();
+    }
+  });
+
+  se_atomic_ptr_t source;
+  se_atomic_ptr_store(&source, &value, SE_ATOMIC_ORDER_RELAXED);
+  se_bench_run("se_ebr protect+clear", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(*static_cast<int *>(se_ebr_protect(0, &source)));
+      se_ebr_clear(0);
+    }
+  });
+
+  // Reclamation: allocation and the deferred free, amortized over batches
+  se_bench_run("alloc+dealloc", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *node = se_runtime_allocator_alloc(32);
+      se_bench_keep(node);
+      se_runtime_allocator_dealloc(node);
+    }
+  });
+
+  se_bench_run("alloc+se_ebr_retire", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_ebr_retire(se_runtime_allocator_alloc(32), nullptr);
+    }
+    se_ebr_collect();
+  });
+
+  se_bench_run("alloc+se_ebr_retire_protected", kOps, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_ebr_retire_protected(se_runtime_allocator_alloc(32), nullptr);
+    }
+    se_ebr_collect();
+  });
+}
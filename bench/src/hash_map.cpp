@@ -0,0 +1,114 @@
+#include "bench.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+#include <se/hash.h>
+#include <se/hash_map.h>
+
+namespace {
+
+constexpr std::size_t kCapacity = 1 << 17;
+constexpr std::size_t kLookups = 1 << 20;
+
+std::uint64_t mix(std::uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// Chained baseline: libstdc++ unordered_map, hashed with the same function
+struct byte_hash {
+  std::size_t operator()(std::uint64_t key) const {
+    return se_hash_bytes(&key, sizeof(key));
+  }
+};
+
+using chained_map = std::unordered_map<std::uint64_t, std::uint64_t, byte_hash>;
+
+// Insert, hit, miss and erase+insert at a fixed load factor (elements per slot
+// of the 2^17-slot open-addressing table; the chained map gets the same count).
+void run_load_factor(unsigned eighths) {
+  const std::size_t count = kCapacity * eighths / 8;
+
+  std::vector<std::uint64_t> keys(count);
+  std::vector<std::uint64_t> misses(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    keys[i] = mix(i);
+    misses[i] = mix(i + count);
+  }
+
+  chained_map chained;
+  chained.reserve(count);
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(std::uint64_t), sizeof(std::uint64_t), nullptr, nullptr, nullptr);
+  se_hash_map_reserve(&map, count);
+
+  std::printf(" load factor %u/8 (%zu elements)\n", eighths, count);
+
+  se_bench_run("chained insert", count, [&](std::size_t ops) {
+    chained.clear();
+    for (std::size_t i = 0; i < ops; ++i) {
+      chained.emplace(keys[i], i);
+    }
+  });
+
+  se_bench_run("se_hash_map insert", count, [&](std::size_t ops) {
+    se_hash_map_clear(&map);
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_hash_map_insert(&map, &keys[i], &i);
+    }
+  });
+
+  se_bench_run("chained find hit", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(chained.find(keys[i % count])->second);
+    }
+  });
+
+  se_bench_run("se_hash_map find hit", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(se_hash_map_find(&map, &keys[i % count]));
+    }
+  });
+
+  se_bench_run("chained find miss", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(chained.find(misses[i % count]) == chained.end());
+    }
+  });
+
+  se_bench_run("se_hash_map find miss", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(se_hash_map_find(&map, &misses[i % count]));
+    }
+  });
+
+  se_bench_run("chained erase+insert", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::uint64_t key = keys[i % count];
+      chained.erase(key);
+      chained.emplace(key, i);
+    }
+  });
+
+  se_bench_run("se_hash_map erase+insert", kLookups, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::uint64_t key = keys[i % count];
+      se_hash_map_erase(&map, &key);
+      se_hash_map_insert(&map, &key, &i);
+    }
+  });
+
+  se_hash_map_deinit(&map);
+}
+
+} // namespace
+
+SE_BENCH(hash_map) {
+  for (unsigned eighths : {4u, 6u, 7u}) {
+    run_load_factor(eighths);
+  }
+}
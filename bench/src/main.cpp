@@ -0,0 +1,17 @@
+#include "bench.h"
+
+#include <cstring>
+
+int main(int argc, char **argv) {
+  // An optional argument selects cases whose name contains the given substring
+  const char *filter = argc > 1 ? argv[1] : nullptr;
+
+  for (const se_bench_case &c : se_bench_registry()) {
+    if (filter && !std::strstr(c.name, filter)) {
+      continue;
+    }
+    std::printf("%s\n", c.name);
+    c.fn();
+  }
+  return 0;
+}
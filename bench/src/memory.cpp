@@ -0,0 +1,69 @@
+#include "bench.h"
+
+#include <se/memory.h>
+#include <se/runtime_try.h>
+
+#include <cstdint>
+
+namespace {
+
+constexpr std::size_t kBlock = 64;
+constexpr std::size_t kOps = 1 << 22;
+constexpr std::size_t kThrowOps = 1 << 18;
+
+std::uint8_t src[kBlock];
+std::uint8_t dst[kBlock];
+
+} // namespace
+
+// Throwing functions against their _r variants, on success and on failure
+SE_BENCH(memory) {
+  se_bench_run("se_memory_copy 64B", kOps, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(se_memory_copy(dst, kBlock, src, kBlock));
+    }
+  });
+
+  se_bench_run("se_memory_copy 64B in se_runtime_try", kOps, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(frame) {
+        se_bench_keep(se_memory_copy(dst, kBlock, src, kBlock));
+        se_runtime_try_finalize();
+      }
+    }
+  });
+
+  se_bench_run("se_memory_copy_r 64B", kOps, [](std::size_t ops) {
+    se_error_t error = {};
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(se_memory_copy_r(dst, kBlock, src, kBlock, &error));
+    }
+    se_bench_keep(error);
+  });
+
+  se_bench_run("se_memory_copy failure: throw-to-catch", kThrowOps, [](std::size_t ops) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *volatile missing = nullptr;
+      se_runtime_try(frame) {
+        se_bench_keep(se_memory_copy(dst, kBlock, missing, kBlock));
+        se_runtime_try_finalize();
+      }
+      else {
+        ++failed;
+      }
+    }
+    se_bench_keep(failed);
+  });
+
+  se_bench_run("se_memory_copy_r failure: error code", kThrowOps, [](std::size_t ops) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *volatile missing = nullptr;
+      se_error_t error = {};
+      se_bench_keep(se_memory_copy_r(dst, kBlock, missing, kBlock, &error));
+      failed += !se_error_is_ok(&error);
+    }
+    se_bench_keep(failed);
+  });
+}
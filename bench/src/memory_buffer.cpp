@@ -0,0 +1,55 @@
+#include "bench.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <se/memory_buffer.h>
+
+namespace {
+
+constexpr std::size_t kChunk = 64;
+constexpr std::size_t kTotal = std::size_t{256} << 20;
+
+} // namespace
+
+// Appending small records until the buffer holds 256 MiB: the cost is
+// dominated by the reallocations, each of which copies the whole buffer
+// unless the storage can be remapped.
+SE_BENCH(memory_buffer_append) {
+  static char chunk[kChunk];
+
+  se_bench_run("std::vector<char> insert", kTotal / kChunk, [](std::size_t ops) {
+    std::vector<char> vector;
+    for (std::size_t i = 0; i < ops; ++i) {
+      vector.insert(vector.end(), chunk, chunk + kChunk);
+    }
+    se_bench_keep(vector.data());
+  }, 3);
+
+  se_bench_run("realloc x1.5 + memcpy", kTotal / kChunk, [](std::size_t ops) {
+    char *data = nullptr;
+    std::size_t size = 0, capacity = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      if (size + kChunk > capacity) {
+        while (size + kChunk > capacity) {
+          capacity = capacity ? capacity * 3 / 2 : 64;
+        }
+        data = static_cast<char *>(std::realloc(data, capacity));
+      }
+      std::memcpy(data + size, chunk, kChunk);
+      size += kChunk;
+    }
+    se_bench_keep(data);
+    std::free(data);
+  }, 3);
+
+  se_bench_run("se_memory_buffer_append", kTotal / kChunk, [](std::size_t ops) {
+    se_memory_buffer_t buffer;
+    se_memory_buffer_init(&buffer);
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_memory_buffer_append(&buffer, chunk, kChunk);
+    }
+    se_bench_keep(buffer.data);
+    se_memory_buffer_deinit(&buffer);
+  }, 3);
+}
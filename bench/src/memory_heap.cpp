@@ -0,0 +1,181 @@
+#include "bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <se/memory_heap.h>
+
+namespace {
+
+constexpr std::size_t kLive = 4096;
+constexpr std::size_t kOps = 1 << 21;
+
+// Mixed request sizes typical for small-object heavy services
+inline std::size_t request_size(std::size_t i) { return 16 + (i * 40503u) % 496; }
+
+template <typename Alloc, typename Free>
+void churn(std::size_t ops, Alloc alloc, Free release) {
+  std::vector<void *> live(kLive);
+  for (std::size_t i = 0; i < kLive; ++i) {
+    live[i] = alloc(request_size(i));
+  }
+  for (std::size_t i = 0; i < ops; ++i) {
+    const std::size_t j = (i * 2654435761u) % kLive;
+    release(live[j]);
+    live[j] = alloc(request_size(i));
+    se_bench_keep(live[j]);
+  }
+  for (std::size_t i = 0; i < kLive; ++i) {
+    release(live[i]);
+  }
+}
+
+// Producer/consumer pairs: every block is released by the other thread
+// of the pair, the pattern that serializes allocators with a global lock.
+template <typename Alloc, typename Free, typename Exit>
+void handoff(std::size_t ops, Alloc alloc, Free release, Exit thread_exit) {
+  std::vector<void *> blocks(ops);
+  std::thread producer([&] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      blocks[i] = alloc(request_size(i));
+    }
+    thread_exit();
+  });
+  producer.join();
+  std::thread consumer([&] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      release(blocks[i]);
+    }
+    thread_exit();
+  });
+  consumer.join();
+}
+
+template <typename F> void run_threads(unsigned threads, std::size_t ops, F fn) {
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&] { fn(ops / threads); });
+  }
+  for (auto &thread : pool) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+SE_BENCH(memory_heap_churn) {
+  se_bench_run("malloc/free", kOps, [](std::size_t ops) {
+    churn(ops, std::malloc, std::free);
+  });
+  se_bench_run("se_memory_heap alloc/dealloc", kOps, [](std::size_t ops) {
+    churn(ops, se_memory_heap_alloc, se_memory_heap_dealloc);
+  });
+}
+
+// Throughput under contention: ns/op is wall time divided by the total
+// number of operations of all threads.
+SE_BENCH(memory_heap_scaling) {
+  const unsigned max_threads = std::thread::hardware_concurrency();
+  for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+    char label[64];
+
+    std::snprintf(label, sizeof(label), "malloc/free, %u threads", threads);
+    se_bench_run(label, kOps * threads, [&](std::size_t ops) {
+      run_threads(threads, ops, [](std::size_t n) { churn(n, std::malloc, std::free); });
+    }, 3);
+
+    std::snprintf(label, sizeof(label), "se_memory_heap, %u threads", threads);
+    se_bench_run(label, kOps * threads, [&](std::size_t ops) {
+      run_threads(threads, ops, [](std::size_t n) {
+        churn(n, se_memory_heap_alloc, se_memory_heap_dealloc);
+        se_memory_heap_thread_flush();
+      });
+    }, 3);
+  }
+}
+
+SE_BENCH(memory_heap_cross_thread) {
+  se_bench_run("malloc, free in another thread", kOps, [](std::size_t ops) {
+    handoff(ops, std::malloc, std::free, [] {});
+  });
+  se_bench_run("se_memory_heap, dealloc in another thread", kOps, [](std::size_t ops) {
+    handoff(ops, se_memory_heap_alloc, se_memory_heap_dealloc, se_memory_heap_thread_flush);
+  });
+}
+
+// Random reads over a table much larger than the TLB reach of 4K pages.
+SE_BENCH(memory_heap_huge_pages) {
+  constexpr std::size_t kTable = std::size_t{512} << 20;
+  constexpr std::size_t kWords = kTable / sizeof(std::size_t);
+
+  const se_u32_t variants[] = {SE_MEMORY_PAGE_FLAG_POPULATE,
+                               SE_MEMORY_PAGE_FLAG_POPULATE | SE_MEMORY_PAGE_FLAG_HUGE};
+  const char *labels[] = {"random reads, 4K pages", "random reads, huge pages"};
+
+  for (int v = 0; v < 2; ++v) {
+    auto *table = static_cast<std::size_t *>(se_memory_heap_alloc_with_flags(kTable, 64, variants[v]));
+    for (std::size_t i = 0; i < kWords; ++i) {
+      table[i] = (i * 2654435761u + 12345) % kWords;
+    }
+    se_bench_run(labels[v], 1 << 22, [&](std::size_t ops) {
+      std::size_t j = 0;
+      for (std::size_t i = 0; i < ops; ++i) {
+        j = table[j];
+      }
+      se_bench_keep(j);
+    }, 3);
+    se_memory_heap_dealloc(table);
+  }
+}
+
+// Zero-initialised allocations. Large blocks are sparsely used after
+// allocation, as hash tables and buffers sized for the worst case are.
+SE_BENCH(memory_heap_zeroed) {
+  se_bench_run("malloc+memset, mixed small", kOps, [](std::size_t ops) {
+    churn(ops, [](std::size_t size) { return std::memset(std::malloc(size), 0, size); }, std::free);
+  });
+  se_bench_run("calloc, mixed small", kOps, [](std::size_t ops) {
+    churn(ops, [](std::size_t size) { return std::calloc(1, size); }, std::free);
+  });
+  se_bench_run("se_memory_heap_alloc_zeroed, mixed small", kOps, [](std::size_t ops) {
+    churn(ops, [](std::size_t size) { return se_memory_heap_alloc_zeroed(size, 0); },
+          se_memory_heap_dealloc);
+  });
+
+  constexpr std::size_t kLarge = 1 << 20;
+  const auto sparse = [](void *p) {
+    static_cast<unsigned char *>(p)[kLarge / 2] = 1;
+    se_bench_keep(p);
+  };
+
+  se_bench_run("malloc+memset 1 MiB, touch one page", 1 << 12, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *p = std::memset(std::malloc(kLarge), 0, kLarge);
+      sparse(p);
+      std::free(p);
+    }
+  });
+  se_bench_run("calloc 1 MiB, touch one page", 1 << 12, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *p = std::calloc(1, kLarge);
+      sparse(p);
+      std::free(p);
+    }
+  });
+  se_bench_run("se_memory_heap alloc+memset 1 MiB, touch one page", 1 << 12, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *p = std::memset(se_memory_heap_alloc(kLarge), 0, kLarge);
+      sparse(p);
+      se_memory_heap_dealloc(p);
+    }
+  });
+  se_bench_run("se_memory_heap_alloc_zeroed 1 MiB, touch one page", 1 << 12, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      void *p = se_memory_heap_alloc_zeroed(kLarge, 0);
+      sparse(p);
+      se_memory_heap_dealloc(p);
+    }
+  });
+}
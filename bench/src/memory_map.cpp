@@ -0,0 +1,67 @@
+#include "bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <se/memory_map.h>
+
+namespace {
+
+constexpr std::size_t kFileSize = std::size_t{256} << 20;
+constexpr char kPath[] = "/tmp/se_bench_memory_map.bin";
+
+void create_file() {
+  std::FILE *file = std::fopen(kPath, "wb");
+  static char block[1 << 16];
+  for (std::size_t i = 0; i < sizeof(block); ++i) {
+    block[i] = static_cast<char>('a' + i % 26);
+  }
+  for (std::size_t written = 0; written < kFileSize; written += sizeof(block)) {
+    std::fwrite(block, 1, sizeof(block), file);
+  }
+  std::fclose(file);
+}
+
+// Sums the file as 64-bit words: a scan cheap enough that the cost of
+// getting the bytes into memory dominates.
+std::size_t checksum(const void *data, std::size_t size) {
+  const auto *words = static_cast<const std::size_t *>(data);
+  std::size_t sum = 0;
+  for (std::size_t i = 0; i < size / sizeof(std::size_t); ++i) {
+    sum += words[i];
+  }
+  return sum;
+}
+
+} // namespace
+
+// Scanning a file that is already in the page cache.
+// ns/op is per byte of the file.
+SE_BENCH(memory_map_scan) {
+  create_file();
+
+  se_bench_run("fread into heap buffer + scan", kFileSize, [](std::size_t) {
+    std::FILE *file = std::fopen(kPath, "rb");
+    auto *buffer = static_cast<char *>(std::malloc(kFileSize));
+    se_bench_keep(std::fread(buffer, 1, kFileSize, file));
+    std::fclose(file);
+    se_bench_keep(checksum(buffer, kFileSize));
+    std::free(buffer);
+  }, 3);
+
+  se_bench_run("se_memory_map_file + scan", kFileSize, [](std::size_t) {
+    se_memory_map_t map;
+    se_memory_map_file(&map, kPath, SE_MEMORY_MAP_FLAG_NONE);
+    se_memory_map_advise(&map, 0, map.size, SE_MEMORY_MAP_ADVICE_SEQUENTIAL);
+    se_bench_keep(checksum(map.data, map.size));
+    se_memory_map_unmap(&map);
+  }, 3);
+
+  se_bench_run("se_memory_map_file populate + scan", kFileSize, [](std::size_t) {
+    se_memory_map_t map;
+    se_memory_map_file(&map, kPath, SE_MEMORY_MAP_FLAG_POPULATE);
+    se_bench_keep(checksum(map.data, map.size));
+    se_memory_map_unmap(&map);
+  }, 3);
+
+  std::remove(kPath);
+}
@@ -0,0 +1,112 @@
+#include "bench.h"
+
+#include <cstdlib>
+#include <se/memory_pool.h>
+
+namespace {
+
+constexpr std::size_t kObjectSize = 128;
+constexpr std::size_t kLive = 4096;
+
+} // namespace
+
+// Alloc/free pairs with a steady working set, the churn pattern of
+// connection and request objects.
+SE_BENCH(memory_pool_churn) {
+  static void *live[kLive];
+
+  se_bench_run("malloc/free", 1 << 22, [](std::size_t ops) {
+    for (std::size_t i = 0; i < kLive; ++i) {
+      live[i] = std::malloc(kObjectSize);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::size_t j = (i * 2654435761u) % kLive;
+      std::free(live[j]);
+      live[j] = std::malloc(kObjectSize);
+      se_bench_keep(live[j]);
+    }
+    for (std::size_t i = 0; i < kLive; ++i) {
+      std::free(live[i]);
+    }
+  });
+
+  // Zeroed baseline: the pool zero-fills when
+  // SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE is on
+  se_bench_run("calloc/free", 1 << 22, [](std::size_t ops) {
+    for (std::size_t i = 0; i < kLive; ++i) {
+      live[i] = std::calloc(1, kObjectSize);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::size_t j = (i * 2654435761u) % kLive;
+      std::free(live[j]);
+      live[j] = std::calloc(1, kObjectSize);
+      se_bench_keep(live[j]);
+    }
+    for (std::size_t i = 0; i < kLive; ++i) {
+      std::free(live[i]);
+    }
+  });
+
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, kObjectSize, 0, 0);
+  se_bench_run("se_memory_pool alloc/dealloc", 1 << 22, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < kLive; ++i) {
+      live[i] = se_memory_pool_alloc(&pool);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::size_t j = (i * 2654435761u) % kLive;
+      se_memory_pool_dealloc(&pool, live[j]);
+      live[j] = se_memory_pool_alloc(&pool);
+      se_bench_keep(live[j]);
+    }
+    for (std::size_t i = 0; i < kLive; ++i) {
+      se_memory_pool_dealloc(&pool, live[i]);
+    }
+  });
+  se_memory_pool_deinit(&pool);
+
+  se_memory_pool_init(&pool, kObjectSize, SE_CACHE_LINE_SIZE, 0);
+  se_bench_run("se_memory_pool alloc/dealloc (cache line)", 1 << 22,
+               [&](std::size_t ops) {
+                 for (std::size_t i = 0; i < kLive; ++i) {
+                   live[i] = se_memory_pool_alloc(&pool);
+                 }
+                 for (std::size_t i = 0; i < ops; ++i) {
+                   const std::size_t j = (i * 2654435761u) % kLive;
+                   se_memory_pool_dealloc(&pool, live[j]);
+                   live[j] = se_memory_pool_alloc(&pool);
+                   se_bench_keep(live[j]);
+                 }
+                 for (std::size_t i = 0; i < kLive; ++i) {
+                   se_memory_pool_dealloc(&pool, live[i]);
+                 }
+               });
+  se_memory_pool_deinit(&pool);
+}
+
+// Bulk allocation followed by bulk release.
+SE_BENCH(memory_pool_bulk) {
+  static void *objects[1 << 20];
+  constexpr std::size_t n = sizeof(objects) / sizeof(objects[0]);
+
+  se_bench_run("malloc x1M then free x1M", n, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      objects[i] = std::malloc(kObjectSize);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      std::free(objects[i]);
+    }
+  });
+
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, kObjectSize, 0, 0);
+  se_bench_run("se_memory_pool x1M then dealloc x1M", n, [&](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      objects[i] = se_memory_pool_alloc(&pool);
+    }
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_memory_pool_dealloc(&pool, objects[i]);
+    }
+  });
+  se_memory_pool_deinit(&pool);
+}
@@ -0,0 +1,104 @@
+#include "bench.h"
+
+#include <se/memory_view.h>
+#include <se/runtime_try.h>
+
+#include <cstdint>
+
+namespace {
+
+constexpr std::size_t kSize = 4096;
+constexpr std::size_t kOps = 1 << 22;
+constexpr std::size_t kThrowOps = 1 << 18;
+
+std::uint8_t data[kSize];
+
+} // namespace
+
+// With SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE these calls are inlined,
+// otherwise each one goes through the exported symbol
+SE_BENCH(memory_view) {
+  const se_memory_view_t view = {data, data + kSize};
+
+  se_bench_run("se_memory_view_at_begin byte loop", kOps, [&](std::size_t ops) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      sum += *static_cast<const std::uint8_t *>(se_memory_view_at_begin(&view, i % kSize));
+    }
+    se_bench_keep(sum);
+  });
+
+  se_bench_run("se_memory_view_at_begin_unchecked byte loop", kOps, [&](std::size_t ops) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      sum += *static_cast<const std::uint8_t *>(se_memory_view_at_begin_unchecked(&view, i % kSize));
+    }
+    se_bench_keep(sum);
+  });
+
+  se_bench_run("se_memory_view_contains_range", kOps, [&](std::size_t ops) {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      const std::uint8_t *begin = data + i % kSize;
+      hits += se_memory_view_contains_range(&view, begin, begin + (i & 7));
+    }
+    se_bench_keep(hits);
+  });
+
+  se_bench_run("se_memory_view_get_size + is_empty", kOps, [&](std::size_t ops) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(view);
+      total += se_memory_view_is_empty(&view) ? 0 : se_memory_view_get_size(&view);
+    }
+    se_bench_keep(total);
+  });
+
+  // Error handling modes: every access guarded by its own try block
+  // versus the error-code variant checked after the loop
+  se_bench_run("se_memory_view_at_begin in se_runtime_try", kOps, [&](std::size_t ops) {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(frame) {
+        sum += *static_cast<const std::uint8_t *>(se_memory_view_at_begin(&view, i % kSize));
+        se_runtime_try_finalize();
+      }
+    }
+    se_bench_keep(sum);
+  });
+
+  se_bench_run("se_memory_view_at_begin_r", kOps, [&](std::size_t ops) {
+    std::size_t sum = 0;
+    se_error_t error = {};
+    for (std::size_t i = 0; i < ops; ++i) {
+      const void *ptr = se_memory_view_at_begin_r(&view, i % kSize, &error);
+      sum += ptr ? *static_cast<const std::uint8_t *>(ptr) : 0;
+    }
+    se_bench_keep(sum);
+    se_bench_keep(error);
+  });
+
+  se_bench_run("se_memory_view_at_begin failure: throw-to-catch", kThrowOps, [&](std::size_t ops) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(frame) {
+        se_bench_keep(se_memory_view_at_begin(&view, kSize + i));
+        se_runtime_try_finalize();
+      }
+      else {
+        ++failed;
+      }
+    }
+    se_bench_keep(failed);
+  });
+
+  se_bench_run("se_memory_view_at_begin_r failure: error code", kThrowOps, [&](std::size_t ops) {
+    std::size_t failed = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_error_t error = {};
+      se_bench_keep(se_memory_view_at_begin_r(&view, kSize + i, &error));
+      failed += !se_error_is_ok(&error);
+    }
+    se_bench_keep(failed);
+  });
+}
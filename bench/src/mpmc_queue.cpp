@@ -0,0 +1,154 @@
+#include "bench.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <se/mpmc_queue.h>
+
+namespace {
+
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 8;
+
+struct message {
+  std::uint64_t words[4];
+};
+
+// Baseline: bounded deque behind a mutex and two condition variables
+struct locked_queue {
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<message> messages;
+
+  void push(const message &value) {
+    std::unique_lock<std::mutex> lock(mutex);
+    not_full.wait(lock, [&] { return messages.size() < kCapacity; });
+    messages.push_back(value);
+    not_empty.notify_one();
+  }
+
+  message pop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    not_empty.wait(lock, [&] { return !messages.empty(); });
+    const message value = messages.front();
+    messages.pop_front();
+    not_full.notify_one();
+    return value;
+  }
+};
+
+// Runs `pairs` producers and `pairs` consumers, each moving ops / pairs messages.
+template <typename Produce, typename Consume>
+void run_pairs(std::size_t pairs, std::size_t ops, Produce produce, Consume consume) {
+  const std::size_t share = ops / pairs;
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < pairs; ++i) {
+    threads.emplace_back([&] { produce(share); });
+    threads.emplace_back([&] { consume(share); });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+// Message throughput at 1..64 threads: half producers, half consumers
+// (a single thread alternates enqueue and dequeue).
+SE_BENCH(mpmc_queue_contention) {
+  constexpr std::size_t kOps = 1 << 18;
+
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, kCapacity, sizeof(message));
+
+  for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+    const std::size_t pairs = threads / 2;
+
+    std::printf(" %zu thread(s)\n", threads);
+
+    se_bench_run("mutex+condvar queue", kOps, [&](std::size_t ops) {
+      locked_queue locked;
+      if (!pairs) {
+        for (std::size_t i = 0; i < ops; ++i) {
+          locked.push(message{{i}});
+          se_bench_keep(locked.pop().words[0]);
+        }
+        return;
+      }
+      run_pairs(
+          pairs, ops,
+          [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+              locked.push(message{{i}});
+            }
+          },
+          [&](std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i) {
+              se_bench_keep(locked.pop().words[0]);
+            }
+          });
+    }, 3);
+
+    se_bench_run("se_mpmc_queue", kOps, [&](std::size_t ops) {
+      message value = {};
+      if (!pairs) {
+        for (std::size_t i = 0; i < ops; ++i) {
+          se_mpmc_queue_enqueue(&queue, &value);
+          se_mpmc_queue_dequeue(&queue, &value);
+        }
+        return;
+      }
+      run_pairs(
+          pairs, ops,
+          [&](std::size_t n) {
+            const message item = {};
+            for (std::size_t i = 0; i < n; ++i) {
+              se_mpmc_queue_enqueue(&queue, &item);
+            }
+          },
+          [&](std::size_t n) {
+            message item;
+            for (std::size_t i = 0; i < n; ++i) {
+              se_mpmc_queue_dequeue(&queue, &item);
+              se_bench_keep(item.words[0]);
+            }
+          });
+    }, 3);
+
+    se_bench_run("se_mpmc_queue batch of 8", kOps, [&](std::size_t ops) {
+      message batch[kBatch] = {};
+      if (!pairs) {
+        for (std::size_t i = 0; i < ops; i += kBatch) {
+          se_mpmc_queue_enqueue_batch(&queue, batch, kBatch);
+          for (std::size_t taken = 0; taken < kBatch;) {
+            taken += se_mpmc_queue_dequeue_batch(&queue, batch, kBatch - taken);
+          }
+        }
+        return;
+      }
+      run_pairs(
+          pairs, ops,
+          [&](std::size_t n) {
+            const message items[kBatch] = {};
+            for (std::size_t i = 0; i < n; i += kBatch) {
+              se_mpmc_queue_enqueue_batch(&queue, items, kBatch);
+            }
+          },
+          [&](std::size_t n) {
+            message items[kBatch];
+            for (std::size_t taken = 0; taken < n;) {
+              const std::size_t want = n - taken < kBatch ? n - taken : kBatch;
+              taken += se_mpmc_queue_dequeue_batch(&queue, items, want);
+              se_bench_keep(items[0].words[0]);
+            }
+          });
+    }, 3);
+  }
+
+  se_mpmc_queue_deinit(&queue);
+}
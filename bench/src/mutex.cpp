@@ -0,0 +1,103 @@
+#include "bench.h"
+
+#include <cstdio>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+#include <se/barrier.h>
+#include <se/mcs_lock.h>
+#include <se/mutex.h>
+#include <se/rwlock.h>
+
+namespace {
+
+constexpr std::size_t kOps = 1 << 20;
+constexpr std::size_t kBarrierOps = 1 << 14;
+
+// Splits `ops` critical sections over `threads` threads
+template <typename F> void run_threads(std::size_t threads, std::size_t ops, F &&section) {
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < threads; ++t) {
+    pool.emplace_back([&] {
+      for (std::size_t i = 0; i < ops / threads; ++i) {
+        section();
+      }
+    });
+  }
+  for (std::thread &thread : pool) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+SE_BENCH(mutex) {
+  for (std::size_t threads : {1u, 4u}) {
+    std::printf(" %zu thread(s)\n", threads);
+    std::size_t counter = 0;
+
+    std::mutex std_mutex;
+    se_bench_run("std::mutex lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        std::lock_guard<std::mutex> lock(std_mutex);
+        ++counter;
+      });
+    });
+
+    se_mutex_t mutex;
+    se_mutex_init(&mutex, nullptr);
+    se_bench_run("se_mutex lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        se_mutex_lock(&mutex);
+        ++counter;
+        se_mutex_unlock(&mutex);
+      });
+    });
+
+    se_mcs_lock_t mcs;
+    se_mcs_lock_init(&mcs, nullptr);
+    se_bench_run("se_mcs_lock lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        se_mcs_lock_node_t node;
+        se_mcs_lock_lock(&mcs, &node);
+        ++counter;
+        se_mcs_lock_unlock(&mcs, &node);
+      });
+    });
+
+    std::shared_mutex std_shared;
+    se_bench_run("std::shared_mutex shared lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        std::shared_lock<std::shared_mutex> lock(std_shared);
+        se_bench_keep(counter);
+      });
+    });
+
+    se_rwlock_t rwlock;
+    se_rwlock_init(&rwlock, nullptr);
+    se_bench_run("se_rwlock read lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        se_rwlock_read_lock(&rwlock);
+        se_bench_keep(counter);
+        se_rwlock_read_unlock(&rwlock);
+      });
+    });
+
+    se_bench_run("se_rwlock write lock+unlock", kOps, [&](std::size_t ops) {
+      run_threads(threads, ops, [&] {
+        se_rwlock_write_lock(&rwlock);
+        ++counter;
+        se_rwlock_write_unlock(&rwlock);
+      });
+    });
+
+    se_barrier_t barrier;
+    se_barrier_init(&barrier, static_cast<se_u32_t>(threads), nullptr);
+    se_bench_run("se_barrier phase", kBarrierOps, [&](std::size_t ops) {
+      run_threads(threads, ops * threads, [&] { se_barrier_arrive_and_wait(&barrier); });
+    });
+
+    se_bench_keep(counter);
+  }
+}
@@ -0,0 +1,111 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+#include <se/parallel.h>
+
+namespace {
+
+constexpr std::size_t kCount = 1 << 22;
+constexpr std::size_t kSortCount = 1 << 20;
+
+se_u64_t mix(se_u64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  return x;
+}
+
+void sum_chunk(void *accumulator, const se_memory_view_t *chunk, void *) {
+  se_u64_t sum = 0;
+  for (const se_u64_t *it = static_cast<const se_u64_t *>(chunk->begin); it != chunk->end; ++it) {
+    sum += *it;
+  }
+  *static_cast<se_u64_t *>(accumulator) += sum;
+}
+
+void add(void *accumulator, const void *value, void *) {
+  *static_cast<se_u64_t *>(accumulator) += *static_cast<const se_u64_t *>(value);
+}
+
+int compare_u64(const void *lhs, const void *rhs, void *) {
+  const se_u64_t a = *static_cast<const se_u64_t *>(lhs);
+  const se_u64_t b = *static_cast<const se_u64_t *>(rhs);
+  return a < b ? -1 : a > b;
+}
+
+void run_algorithms(se_thread_pool_t *pool, const std::vector<se_u64_t> &values,
+                    const std::vector<se_u64_t> &unsorted) {
+  const se_memory_view_t view = {values.data(), values.data() + values.size()};
+  std::vector<se_u64_t> output(values.size());
+  std::vector<se_u64_t> sorted(unsorted.size());
+
+  se_bench_run("se_parallel_reduce sum u64", kCount, [&](std::size_t) {
+    const se_u64_t zero = 0;
+    se_u64_t sum = 0;
+    se_parallel_reduce(pool, &view, sizeof(se_u64_t), 0, &zero, sizeof(sum), sum_chunk, add, nullptr, &sum);
+    se_bench_keep(sum);
+  });
+
+  se_bench_run("se_parallel_prefix_sum_u64", kCount, [&](std::size_t) {
+    se_parallel_prefix_sum_u64(pool, &view, 0, output.data());
+    se_bench_keep(output.back());
+  });
+
+  se_bench_run("se_parallel_scan add u64", kCount, [&](std::size_t) {
+    se_parallel_scan(pool, &view, sizeof(se_u64_t), 0, add, nullptr, output.data());
+    se_bench_keep(output.back());
+  });
+
+  se_bench_run("se_parallel_sort u64", kSortCount, [&](std::size_t) {
+    sorted = unsorted;
+    const se_memory_range_t range = {sorted.data(), sorted.data() + sorted.size()};
+    se_parallel_sort(pool, &range, sizeof(se_u64_t), 0, compare_u64, nullptr);
+    se_bench_keep(sorted.front());
+  }, 3);
+}
+
+} // namespace
+
+SE_BENCH(parallel) {
+  std::vector<se_u64_t> values(kCount);
+  std::vector<se_u64_t> unsorted(kSortCount);
+  for (std::size_t i = 0; i < kCount; ++i) {
+    values[i] = mix(i) >> 16;
+  }
+  for (std::size_t i = 0; i < kSortCount; ++i) {
+    unsorted[i] = mix(i + kCount);
+  }
+
+  std::vector<se_u64_t> output(kCount);
+  std::vector<se_u64_t> sorted(kSortCount);
+
+  se_bench_run("std::accumulate u64", kCount, [&](std::size_t) {
+    se_bench_keep(std::accumulate(values.begin(), values.end(), se_u64_t{0}));
+  });
+
+  se_bench_run("std::inclusive_scan u64", kCount, [&](std::size_t) {
+    std::inclusive_scan(values.begin(), values.end(), output.begin());
+    se_bench_keep(output.back());
+  });
+
+  se_bench_run("std::stable_sort u64", kSortCount, [&](std::size_t) {
+    sorted = unsorted;
+    std::stable_sort(sorted.begin(), sorted.end());
+    se_bench_keep(sorted.front());
+  }, 3);
+
+  std::printf(" serial (no pool)\n");
+  run_algorithms(nullptr, values, unsorted);
+
+  for (se_usize_t workers : {1u, 2u, 4u}) {
+    se_thread_pool_t pool;
+    se_thread_pool_init(&pool, workers);
+    std::printf(" %zu worker(s)\n", static_cast<std::size_t>(workers));
+    run_algorithms(&pool, values, unsorted);
+    se_thread_pool_deinit(&pool);
+  }
+}
@@ -0,0 +1,104 @@
+#include "bench.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <se/ring_buffer.h>
+
+namespace {
+
+constexpr std::size_t kMessageSize = 64;
+constexpr std::size_t kCapacity = 1 << 16;
+constexpr std::size_t kQueueLength = kCapacity / kMessageSize;
+
+using message = std::array<char, kMessageSize>;
+
+// Baseline: bounded queue of messages behind a mutex and two condition variables
+struct locked_queue {
+  std::mutex mutex;
+  std::condition_variable not_empty;
+  std::condition_variable not_full;
+  std::deque<message> messages;
+
+  void push(const message &value) {
+    std::unique_lock<std::mutex> lock(mutex);
+    not_full.wait(lock, [&] { return messages.size() < kQueueLength; });
+    messages.push_back(value);
+    not_empty.notify_one();
+  }
+
+  message pop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    not_empty.wait(lock, [&] { return !messages.empty(); });
+    const message value = messages.front();
+    messages.pop_front();
+    not_full.notify_one();
+    return value;
+  }
+};
+
+// Producer and consumer spin with yield when the ring is full or empty:
+// the benchmark machine may have a single core.
+void ring_stream(se_ring_buffer_t *ring, std::size_t ops) {
+  std::thread producer([&] {
+    message value = {};
+    for (std::size_t i = 0; i < ops;) {
+      const se_memory_range_t range = se_ring_buffer_reserve(ring, kMessageSize);
+      if (range.begin == range.end) {
+        std::this_thread::yield();
+        continue;
+      }
+      std::memcpy(&value, &i, sizeof(i));
+      std::memcpy(range.begin, value.data(), kMessageSize);
+      se_ring_buffer_commit(ring, kMessageSize);
+      ++i;
+    }
+  });
+
+  for (std::size_t i = 0; i < ops;) {
+    const se_memory_view_t view = se_ring_buffer_peek(ring, kMessageSize);
+    if (view.begin == view.end) {
+      std::this_thread::yield();
+      continue;
+    }
+    se_bench_keep(*static_cast<const std::size_t *>(view.begin));
+    se_ring_buffer_consume(ring, kMessageSize);
+    ++i;
+  }
+
+  producer.join();
+}
+
+} // namespace
+
+// One producer and one consumer thread pass 64-byte messages.
+SE_BENCH(ring_buffer_stream) {
+  constexpr std::size_t kOps = 1 << 20;
+
+  se_bench_run("mutex+condvar queue", kOps, [](std::size_t ops) {
+    locked_queue queue;
+    std::thread producer([&] {
+      message value = {};
+      for (std::size_t i = 0; i < ops; ++i) {
+        std::memcpy(&value, &i, sizeof(i));
+        queue.push(value);
+      }
+    });
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(queue.pop()[0]);
+    }
+    producer.join();
+  });
+
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, kCapacity, SE_RING_BUFFER_FLAG_NONE);
+  se_bench_run("se_ring_buffer", kOps, [&](std::size_t ops) { ring_stream(&ring, ops); });
+  se_ring_buffer_deinit(&ring);
+
+  se_ring_buffer_init(&ring, kCapacity, SE_RING_BUFFER_FLAG_MIRRORED);
+  se_bench_run("se_ring_buffer mirrored", kOps, [&](std::size_t ops) { ring_stream(&ring, ops); });
+  se_ring_buffer_deinit(&ring);
+}
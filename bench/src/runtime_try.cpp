@@ -0,0 +1,55 @@
+#include "bench.h"
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_try.h>
+
+namespace {
+
+constexpr std::size_t kOps = 1 << 22;
+constexpr std::size_t kThrowOps = 1 << 18;
+
+} // namespace
+
+SE_BENCH(runtime_try) {
+  se_bench_run("se_runtime_try enter+finalize", kOps, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(frame) {
+        se_bench_keep(i);
+        se_runtime_try_finalize();
+      }
+    }
+  });
+
+  se_bench_run("se_runtime_try nested x4", kOps / 4, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(a) {
+        se_runtime_try(b) {
+          se_runtime_try(c) {
+            se_runtime_try(d) {
+              se_bench_keep(i);
+              se_runtime_try_finalize();
+            }
+            se_runtime_try_finalize();
+          }
+          se_runtime_try_finalize();
+        }
+        se_runtime_try_finalize();
+      }
+    }
+  });
+
+  // A failing library call: the check, the throw and the jump to the frame
+  se_bench_run("se_runtime_try throw-to-catch", kThrowOps, [](std::size_t ops) {
+    std::size_t caught = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_runtime_try(frame) {
+        se_runtime_allocator_alloc_aligned(16, 3);
+        se_runtime_try_finalize();
+      }
+      else {
+        ++caught;
+      }
+    }
+    se_bench_keep(caught);
+  });
+}
@@ -0,0 +1,67 @@
+#include "bench.h"
+
+#include <cstring>
+#include <string>
+#include <se/memory.h>
+#include <se/string.h>
+
+namespace {
+
+// Longer than the libstdc++ inline buffer (15), shorter than se_string's (23)
+constexpr char kShort[] = "user:0000000000:name";
+constexpr std::size_t kShortSize = sizeof(kShort) - 1;
+
+constexpr std::size_t kHaystack = 1 << 20;
+
+} // namespace
+
+// Building a short string: std::string allocates, se_string stays inline.
+SE_BENCH(string_short) {
+  se_bench_run("std::string short assign", 1 << 22, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      std::string str(kShort, kShortSize);
+      se_bench_keep(str.data());
+    }
+  });
+
+  se_bench_run("se_string short assign", 1 << 22, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_string_t str;
+      se_string_init(&str);
+      se_string_assign(&str, kShort, kShortSize);
+      se_bench_keep(se_string_get_cstr(&str));
+      se_string_deinit(&str);
+    }
+  });
+}
+
+// Substring search over 1 MiB of text with frequent first-byte hits.
+SE_BENCH(string_find) {
+  static std::string text = [] {
+    std::string str;
+    while (str.size() < kHaystack) {
+      str += "needle? no, a needless nettle. ";
+    }
+    str += "needle in a haystack";
+    return str;
+  }();
+  static const char needle[] = "needle in";
+
+  se_bench_run("std::string::find 1 MiB", 1 << 8, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(reinterpret_cast<void *>(text.find(needle)));
+    }
+  });
+
+  se_bench_run("strstr 1 MiB", 1 << 8, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(std::strstr(text.c_str(), needle));
+    }
+  });
+
+  se_bench_run("se_memory_find 1 MiB", 1 << 8, [](std::size_t ops) {
+    for (std::size_t i = 0; i < ops; ++i) {
+      se_bench_keep(se_memory_find(text.data(), text.size(), needle, sizeof(needle) - 1));
+    }
+  });
+}
@@ -0,0 +1,78 @@
+#include "bench.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <se/thread_pool.h>
+
+namespace {
+
+constexpr unsigned kFibN = 22;         // 57313 calls per run
+constexpr std::size_t kFibCalls = 57313;
+constexpr std::size_t kSubmits = 1 << 16;
+
+std::uint64_t fib_serial(unsigned n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+struct fib_job {
+  se_thread_pool_t *pool;
+  unsigned n;
+  std::uint64_t result;
+};
+
+// One task per call: measures spawn + wait overhead, not useful work
+void fib_task(void *context) {
+  fib_job *job = static_cast<fib_job *>(context);
+  if (job->n < 2) {
+    job->result = job->n;
+    return;
+  }
+
+  fib_job left = {job->pool, job->n - 1, 0};
+  fib_job right = {job->pool, job->n - 2, 0};
+
+  se_thread_pool_task_t *task = se_thread_pool_spawn(job->pool, fib_task, &left);
+  fib_task(&right);
+  se_thread_pool_wait(job->pool, task);
+
+  job->result = left.result + right.result;
+}
+
+void increment(void *context) {
+  static_cast<std::atomic<std::size_t> *>(context)->fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+SE_BENCH(thread_pool) {
+  se_bench_run("serial fib call", kFibCalls, [&](std::size_t) {
+    se_bench_keep(fib_serial(kFibN));
+  });
+
+  for (se_usize_t workers : {1u, 2u, 4u}) {
+    se_thread_pool_t pool;
+    se_thread_pool_init(&pool, workers);
+    std::printf(" %zu worker(s)\n", static_cast<std::size_t>(workers));
+
+    se_bench_run("se_thread_pool fork-join fib call", kFibCalls, [&](std::size_t) {
+      fib_job job = {&pool, kFibN, 0};
+      se_thread_pool_wait(&pool, se_thread_pool_spawn(&pool, fib_task, &job));
+      se_bench_keep(job.result);
+    });
+
+    std::atomic<std::size_t> counter{0};
+    se_bench_run("se_thread_pool submit from outside", kSubmits, [&](std::size_t ops) {
+      counter.store(0);
+      for (std::size_t i = 0; i < ops; ++i) {
+        se_thread_pool_submit(&pool, increment, &counter);
+      }
+      while (counter.load(std::memory_order_relaxed) != ops) {
+        std::this_thread::yield();
+      }
+    });
+
+    se_thread_pool_deinit(&pool);
+  }
+}
@@ -15,10 +15,24 @@ foreach (CMAKE_OPTION IN ITEMS ${CMAKE_OPTIONS})
     # Проверяем, соответствует ли имя опции шаблону "^SE_LIBRARY_OPTION_.*" и не равно ли оно "OFF".
     # Если оба условия выполняются, добавляем опцию в список определений компиляции.
     if (CMAKE_OPTION MATCHES "^SE_LIBRARY_OPTION_.*" AND NOT ${CMAKE_OPTION} STREQUAL "OFF")
+        # Логические опции передаются именем, остальные — парой имя=значение
+        if (${CMAKE_OPTION} STREQUAL "ON")
+            set(CMAKE_OPTION_DEFINITION ${CMAKE_OPTION})
+        else ()
+            set(CMAKE_OPTION_DEFINITION ${CMAKE_OPTION}=${${CMAKE_OPTION}})
+        endif ()
         # Печатаем ключ и значение опции с дополнительным форматированием
-        message(STATUS ":: ${CMAKE_OPTION}")
+        message(STATUS ":: ${CMAKE_OPTION_DEFINITION}")
         # Добавляем опцию в список SE_PRIVATE_COMPILE_DEFINITIONS
-        list(APPEND SE_TARGET_PRIVATE_COMPILE_DEFINITIONS ${CMAKE_OPTION})
+        list(APPEND SE_TARGET_PRIVATE_COMPILE_DEFINITIONS ${CMAKE_OPTION_DEFINITION})
     endif ()
 endforeach ()
 
+# Опции, которые меняют публичные заголовки, должны совпадать у библиотеки
+# и ее пользователей, поэтому передаются и как публичные определения.
+if (SE_LIBRARY_OPTION_JUMP_BUFFER_ASM)
+    list(APPEND SE_TARGET_PUBLIC_COMPILE_DEFINITIONS SE_LIBRARY_OPTION_JUMP_BUFFER_ASM)
+endif ()
+if (SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE)
+    list(APPEND SE_TARGET_PUBLIC_COMPILE_DEFINITIONS SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE)
+endif ()
@@ -14,10 +14,6 @@ list(APPEND SE_TARGET_PUBLIC_COMPILE_DEFINITIONS
         # Переменная CMAKE_SYSTEM_PROCESSOR содержит архитектуру процессора (например, x86_64, armv7).
         SE_SYSTEM_PROCESSOR="${CMAKE_SYSTEM_PROCESSOR}"
 
-        # SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX определяет максимальное
-        # количество сохраненных кадров перехвата в библиотеке.
-        SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX=255
-
         # Устанавливаем тип диапазона памяти.
         # Данная переменная определяет тип диапазона, который будет использоваться в проекте.
         #
@@ -51,4 +47,11 @@ list(APPEND SE_TARGET_PUBLIC_COMPILE_DEFINITIONS
         # В обоих случаях, при расчете нового размера памяти, не потребуется использование типа `float`,
         # что уменьшит возможные ошибки, связанные с точностью или производительностью.
         SE_DYNAMIC_BLOCK_GROWTH_FACTOR=1500
+
+        # SE_MEMORY_HEAP_HUGE_THRESHOLD задает начальный размер блока (в байтах),
+        # начиная с которого куча (memory_heap.h) отображает его большими страницами
+        # (huge pages), уменьшая промахи TLB на крупных таблицах.
+        #
+        # Во время выполнения порог меняется через se_memory_heap_set_huge_threshold().
+        SE_MEMORY_HEAP_HUGE_THRESHOLD=4194304
 )
\ No newline at end of file
@@ -253,6 +253,130 @@ option(SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
 option(SE_LIBRARY_OPTION_THREAD_LOCAL
         "Все статические переменные используют модификатор потока." ON)
 
+# Опция:
+#
+#     SE_LIBRARY_OPTION_THREAD_LOCAL_INITIAL_EXEC
+#
+# Описание:
+#
+#     Опция CMake SE_LIBRARY_OPTION_THREAD_LOCAL_INITIAL_EXEC выбирает модель
+#     потоковой памяти `initial-exec` для переменных библиотеки
+#     (действует вместе с SE_LIBRARY_OPTION_THREAD_LOCAL).
+#
+#     В разделяемой библиотеке модель по умолчанию (`global-dynamic`) вычисляет
+#     адрес потоковой переменной вызовом `__tls_get_addr`. С моделью
+#     `initial-exec` смещение известно после загрузки, и доступ к переменной
+#     (например, к стеку обработчиков в каждом `se_runtime_try`) — одна
+#     инструкция относительно указателя потока.
+#
+# Использование:
+#
+#     ON: Потоковые переменные используют модель `initial-exec`.
+#     OFF (по умолчанию): Используется модель компилятора по умолчанию.
+#
+# Примечание:
+#
+#     Включайте опцию, только если библиотека связывается с программой при
+#     сборке. При загрузке через `dlopen` (напрямую или как зависимость
+#     плагина) потоковые переменные библиотеки (около 1.6 КБ, в основном кэш
+#     кучи memory_heap.c) должны поместиться в небольшой резерв статической
+#     потоковой памяти загрузчика, иначе загрузка завершится ошибкой
+#     "cannot allocate memory in static TLS block".
+#
+option(SE_LIBRARY_OPTION_THREAD_LOCAL_INITIAL_EXEC
+        "Потоковые переменные используют модель initial-exec." OFF)
+
+# Опция:
+#
+#     SE_LIBRARY_OPTION_JUMP_BUFFER_ASM
+#
+# Описание:
+#
+#     Опция CMake SE_LIBRARY_OPTION_JUMP_BUFFER_ASM заменяет `setjmp`/`longjmp`
+#     в `se_runtime_try` и `se_runtime_throw` собственным сохранением регистров
+#     (jump_buffer.h) на x86-64 и AArch64 (ELF). На остальных платформах
+#     опция ни на что не влияет.
+#
+#     Сохраняются только регистры, которые по соглашению о вызовах обязана
+#     сохранить вызываемая функция: 8 слов на x86-64 и 22 на AArch64 вместо
+#     полного `jmp_buf` с маской сигналов и состоянием теневого стека.
+#
+# Использование:
+#
+#     ON: Контекст сохраняется функциями se_jump_buffer_save_asm / _restore_asm.
+#     OFF (по умолчанию): Используются `setjmp` и `longjmp` из libc.
+#
+# Примечание:
+#
+#     Опция меняет публичный тип `se_jump_buffer_t`, поэтому передается
+#     пользователям библиотеки как публичное определение. Маска сигналов
+#     при переходе не восстанавливается, а аппаратный теневой стек
+#     (Intel CET SHSTK) не поддерживается.
+#
+option(SE_LIBRARY_OPTION_JUMP_BUFFER_ASM
+        "Сохранять контекст try-блоков без setjmp." OFF)
+
+# Опция:
+#
+#     SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+#
+# Описание:
+#
+#     Опция CMake SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE встраивает функции
+#     memory_view.h в места вызова: заголовок перенаправляет вызовы на
+#     принудительно встраиваемые функции memory_view_inline.h, и циклы
+#     по областям памяти компилируются в арифметику указателей без вызовов
+#     через PLT.
+#
+# Использование:
+#
+#     ON: Функции memory_view.h встраиваются в код библиотеки и ее пользователей.
+#     OFF (по умолчанию): Вызываются экспортируемые функции.
+#
+# Примечание:
+#
+#     Экспортируемые символы сохраняются при любом значении опции, поэтому
+#     двоичная совместимость не меняется. Опция передается пользователям
+#     библиотеки как публичное определение. Встроенные проверки следуют
+#     уровню SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL только внутри библиотеки;
+#     в пользовательском коде выполняются все проверки.
+#
+option(SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+        "Встраивать функции memory_view.h в места вызова." OFF)
+
+# Опция:
+#
+#     SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL
+#
+# Описание:
+#
+#     Опция CMake SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL задает, какие проверки
+#     `se_runtime_check` компилируются в библиотеку (runtime_check.h).
+#     Отключенные проверки не вычисляют условие и не оставляют в коде
+#     ни сравнения, ни перехода.
+#
+#     Проверки отказов окружения (нехватка памяти, ввод-вывод, прерывание)
+#     выполняются на любом уровне: их нельзя исключить проверкой входных данных.
+#
+# Использование:
+#
+#     2 (по умолчанию): Все проверки.
+#     1: Только проверки границ (выход за пределы диапазона и недопустимый
+#        диапазон памяти); нулевые указатели и аргументы не проверяются.
+#     0: Проверки предусловий отключены.
+#
+# Примечание:
+#
+#     На уровнях 0 и 1 нарушение отключенного предусловия — неопределенное
+#     поведение, а не исключение. Функции с суффиксом `_unchecked`
+#     (memory_view.h, memory_std.h) не выполняют проверок независимо
+#     от уровня и позволяют сочетать безопасные и быстрые вызовы
+#     в одной сборке.
+#
+set(SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL 2 CACHE STRING
+        "Уровень проверок времени выполнения (0 — нет, 1 — границы, 2 — все).")
+set_property(CACHE SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL PROPERTY STRINGS 0 1 2)
+
 # Опция:
 #
 #     SE_LIBRARY_OPTION_ERROR_DESC
@@ -290,4 +414,34 @@ option(SE_LIBRARY_OPTION_THREAD_LOCAL
 #     достаточно информативны сами по себе.
 #
 option(SE_LIBRARY_OPTION_ERROR_DESC
-        "Включает поддержку описаний ошибок в runtime исключениях." OFF)
\ No newline at end of file
+        "Включает поддержку описаний ошибок в runtime исключениях." OFF)
+
+# Опция:
+#
+#     SE_LIBRARY_OPTION_ALLOC_STATS
+#
+# Описание:
+#
+#     Опция CMake SE_LIBRARY_OPTION_ALLOC_STATS включает учет статистики
+#     выделений аллокатора времени выполнения (runtime_allocator_stats.h).
+#
+#     Каждый поток ведет собственные счетчики: объем живой памяти,
+#     количество выделений и освобождений, гистограмму размеров по степеням двойки.
+#     Счетчики суммируются по запросу через se_runtime_allocator_stats_snapshot().
+#
+# Использование:
+#
+#     ON: Аллокатор времени выполнения хранит перед каждым блоком заголовок
+#         с его размером и обновляет счетчики текущего потока.
+#     OFF (по умолчанию): Учет полностью исключается из сборки,
+#          функции снимков возвращают нулевую статистику.
+#
+# Примечание:
+#
+#     Учет добавляет к каждому блоку заголовок размером в два указателя
+#     и несколько неатомарных обращений к памяти потока на каждую операцию.
+#     Без SE_LIBRARY_OPTION_THREAD_LOCAL счетчики общие для всех потоков
+#     и обновляются атомарными операциями, что заметно дороже.
+#
+option(SE_LIBRARY_OPTION_ALLOC_STATS
+        "Вести статистику выделений аллокатора времени выполнения." OFF)
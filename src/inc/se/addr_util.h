@@ -82,4 +82,36 @@
  */
 #define se_addr_is_aligned(addr, align) ((addr & ((align) - 1)) == 0)
 
+/**
+ * @def se_addr_align_up
+ * @brief Выравнивает адрес вверх до указанной границы.
+ *
+ * Возвращает наименьший адрес, который не меньше `addr`
+ * и кратен `align`.
+ *
+ * @param addr Адрес для выравнивания.
+ * @param align Граница выравнивания (должна быть степенью двойки).
+ *
+ * @return Выровненный адрес.
+ *
+ * @warning Этот макрос не проверяет, является ли `align` степенью двойки.
+ */
+#define se_addr_align_up(addr, align) (((addr) + ((align) - 1)) & ~((se_uaddr_t)(align) - 1))
+
+/**
+ * @def se_addr_align_down
+ * @brief Выравнивает адрес вниз до указанной границы.
+ *
+ * Возвращает наибольший адрес, который не больше `addr`
+ * и кратен `align`.
+ *
+ * @param addr Адрес для выравнивания.
+ * @param align Граница выравнивания (должна быть степенью двойки).
+ *
+ * @return Выровненный адрес.
+ *
+ * @warning Этот макрос не проверяет, является ли `align` степенью двойки.
+ */
+#define se_addr_align_down(addr, align) ((addr) & ~((se_uaddr_t)(align) - 1))
+
 #endif // SE_ADDR_UTIL_H
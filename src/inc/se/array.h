@@ -0,0 +1,221 @@
+/**
+ * @file array.h
+ * @brief Динамический массив элементов фиксированного размера.
+ *
+ * Массив хранит элементы непрерывно, поэтому его содержимое в любой момент
+ * доступно как `se_memory_view_t` и может обрабатываться функциями
+ * memory_view.h и memory.h. Размер элемента задается при инициализации,
+ * элементы копируются побайтно.
+ *
+ * Емкость растет геометрически с коэффициентом
+ * `SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000` (см. compile_definitions.cmake).
+ * Вставка и удаление в середине сдвигают хвост одним вызовом
+ * `se_memory_move`, который использует векторные инструкции,
+ * включенные опциями `SE_COMPILE_OPTION_*`.
+ *
+ * Память берется у аллокатора, переданного при инициализации,
+ * или у аллокатора времени выполнения, если он не задан.
+ *
+ * Пример использования:
+ * @code
+ * se_array_t array;
+ * se_array_init(&array, sizeof(int), nullptr);
+ * const int value = 42;
+ * se_array_push(&array, &value);
+ * const int *first = se_array_at(&array, 0);
+ * se_array_deinit(&array);
+ * @endcode
+ *
+ * @note Массив не потокобезопасен. Указатели на элементы становятся
+ *       недействительными после любой операции, меняющей емкость.
+ * @see memory_allocator.h
+ * @see memory_view.h
+ */
+
+#ifndef SE_ARRAY_H
+#define SE_ARRAY_H
+
+#include "memory_allocator.h"
+#include "memory_view.h"
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def SE_ARRAY_MIN_CAPACITY
+ * @brief Емкость в элементах, выделяемая при первом добавлении.
+ */
+#define SE_ARRAY_MIN_CAPACITY 8
+
+/**
+ * @struct se_array
+ * @brief Динамический массив.
+ */
+typedef struct se_array
+{
+    void                        *data;         /**< Начало хранилища или `nullptr`. */
+    se_usize_t                   element_size; /**< Размер элемента в байтах. */
+    se_usize_t                   size;         /**< Количество элементов. */
+    se_usize_t                   capacity;     /**< Емкость хранилища в элементах. */
+    const se_memory_allocator_t *allocator;    /**< Аллокатор или `nullptr` для аллокатора времени выполнения. */
+} se_array_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустой массив без выделения памяти.
+ *
+ * @param[out] self Указатель на массив.
+ * @param[in] element_size Размер элемента в байтах (больше нуля).
+ * @param[in] allocator Аллокатор хранилища или `nullptr` для аллокатора
+ *                      времени выполнения. Структура не копируется и должна
+ *                      существовать, пока существует массив.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_init(se_array_t *self, se_usize_t element_size, const se_memory_allocator_t *allocator);
+
+/**
+ * @brief Освобождает память массива.
+ * @param[in,out] self Указатель на массив.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_deinit(se_array_t *self);
+
+/**
+ * @brief Гарантирует емкость не меньше заданной.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[in] capacity Требуемая емкость в элементах.
+ *
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_reserve(se_array_t *self, se_usize_t capacity);
+
+/**
+ * @brief Добавляет элемент в конец массива.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[in] element Указатель на копируемый элемент.
+ * @return Указатель на добавленный элемент в массиве.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_array_push(se_array_t *self, const void *element);
+
+/**
+ * @brief Удаляет последний элемент.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[out] element Буфер для удаляемого элемента или `nullptr`.
+ *
+ * @note Для пустого массива выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_pop(se_array_t *self, void *element);
+
+/**
+ * @brief Вставляет элементы перед позицией `index`.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[in] index Позиция вставки (`index <= size`).
+ * @param[in] elements Вставляемые элементы (не должны лежать внутри массива).
+ * @param[in] count Количество вставляемых элементов.
+ *
+ * @note При `index > size` выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_insert(se_array_t *self, se_usize_t index, const void *elements, se_usize_t count);
+
+/**
+ * @brief Удаляет `count` элементов, начиная с позиции `index`.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[in] index Позиция первого удаляемого элемента.
+ * @param[in] count Количество удаляемых элементов.
+ *
+ * @note Если диапазон выходит за конец массива,
+ *       выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_erase(se_array_t *self, se_usize_t index, se_usize_t count);
+
+/**
+ * @brief Добавляет в конец массива элементы из области памяти.
+ *
+ * @param[in,out] self Указатель на массив.
+ * @param[in] view Область, размер которой кратен размеру элемента.
+ *
+ * @note Если размер области не кратен размеру элемента,
+ *       выбрасывает `SE_RUNTIME_ERROR_INVALID_ARGUMENT`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_append_view(se_array_t *self, const se_memory_view_t *view);
+
+/**
+ * @brief Удаляет все элементы, сохраняя емкость.
+ * @param[in,out] self Указатель на массив.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_array_clear(se_array_t *self);
+
+/**
+ * @brief Возвращает указатель на элемент.
+ *
+ * @param[in] self Указатель на массив.
+ * @param[in] index Индекс элемента.
+ * @return Указатель на элемент.
+ *
+ * @note При `index >= size` выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_array_at(const se_array_t *self, se_usize_t index);
+
+/**
+ * @brief Возвращает количество элементов.
+ * @param[in] self Указатель на массив.
+ * @return Количество элементов.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_array_get_size(const se_array_t *self);
+
+/**
+ * @brief Возвращает емкость массива.
+ * @param[in] self Указатель на массив.
+ * @return Емкость в элементах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_array_get_capacity(const se_array_t *self);
+
+/**
+ * @brief Возвращает указатель на первый элемент.
+ * @param[in] self Указатель на массив.
+ * @return Начало хранилища или `nullptr`, если память не выделена.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_array_get_data(const se_array_t *self);
+
+/**
+ * @brief Возвращает представление элементов массива.
+ * @param[in] self Указатель на массив.
+ * @return Область `[data, data + size * element_size)`; для массива без
+ *         памяти — пустая область с ненулевыми границами.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_view_t
+se_array_get_view(const se_array_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_ARRAY_H
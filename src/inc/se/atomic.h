@@ -0,0 +1,81 @@
+/**
+ * @file atomic.h
+ * @brief Атомарные операции с явным порядком доступа к памяти.
+ *
+ * Модуль дает единый набор атомарных операций для структур без блокировок.
+ * Реализация выбирается по компилятору (см. atomic_type.h): встроенные
+ * функции `__atomic_*` GCC/Clang, функции `_Interlocked*` MSVC или
+ * `<stdatomic.h>` C11. Все операции встраиваются в место вызова.
+ *
+ * Для каждого типа `N` из `u32`, `u64`, `usize` (`se_atomic_<N>_t`)
+ * и `ptr` (`se_atomic_ptr_t`) определены:
+ * - `se_atomic_<N>_load(self, order)` — чтение;
+ * - `se_atomic_<N>_store(self, value, order)` — запись;
+ * - `se_atomic_<N>_exchange(self, value, order)` — обмен, возвращает старое значение;
+ * - `se_atomic_<N>_compare_exchange_weak/strong(self, expected, desired, success, failure)` —
+ *   сравнение с обменом; при неудаче записывает текущее значение в `*expected`
+ *   и возвращает `false`; слабый вариант может ошибаться ложно;
+ * - только для целых: `se_atomic_<N>_fetch_add/sub/and/or(self, value, order)` —
+ *   операция над значением, возвращает старое значение.
+ *
+ * Кроме того:
+ * - `se_atomic_thread_fence(order)` и `se_atomic_signal_fence(order)` — барьеры;
+ * - `se_atomic_pause()` — подсказка процессору внутри цикла ожидания
+ *   (`pause` на x86, `yield` на ARM);
+ * - `se_atomic_yield()` — уступить процессор другому потоку;
+ * - `se_atomic_u128_compare_exchange(self, expected, desired)` — 128-битное
+ *   сравнение с обменом (`seq_cst`), если определен `SE_ATOMIC_HAS_U128`.
+ *
+ * Порядок неудачного сравнения (`failure`) не может быть `RELEASE`
+ * или `ACQ_REL` и не может быть сильнее `success`.
+ *
+ * Пример использования:
+ * @code
+ * static se_atomic_u32_t ready;
+ * static int payload;
+ *
+ * // Поток-писатель
+ * payload = 42;
+ * se_atomic_u32_store(&ready, 1, SE_ATOMIC_ORDER_RELEASE);
+ *
+ * // Поток-читатель
+ * while (!se_atomic_u32_load(&ready, SE_ATOMIC_ORDER_ACQUIRE))
+ * {
+ *     se_atomic_pause();
+ * }
+ * // payload == 42
+ * @endcode
+ *
+ * @see futex.h
+ */
+
+#ifndef SE_ATOMIC_H
+#define SE_ATOMIC_H
+
+#include "atomic_order.h"
+#include "atomic_type.h"
+#include "attribute.h"
+
+#if (SE_ATOMIC_BACKEND == SE_ATOMIC_BACKEND_BUILTIN)
+#    include "atomic_builtin.h"
+#elif (SE_ATOMIC_BACKEND == SE_ATOMIC_BACKEND_INTERLOCKED)
+#    include "atomic_interlocked.h"
+#else
+#    include "atomic_std.h"
+#endif
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Уступает процессор другому готовому потоку (`sched_yield`, `SwitchToThread`).
+ *
+ * Используется в циклах ожидания после нескольких итераций с `se_atomic_pause`,
+ * чтобы не отнимать время у потока, которого ждут, когда ядер меньше, чем потоков.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_atomic_yield(void);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_ATOMIC_H
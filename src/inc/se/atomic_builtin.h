@@ -0,0 +1,157 @@
+/**
+ * @file atomic_builtin.h
+ * @brief Атомарные операции на встроенных функциях `__atomic_*` GCC/Clang.
+ *
+ * Порядок `se_atomic_order_t` передается встроенным функциям как есть.
+ * Если порядок — константа в месте вызова, после встраивания операция
+ * компилируется в одну инструкцию (на x86-64 чтение и release-запись —
+ * обычные `mov`).
+ *
+ * Файл подключается через atomic.h и не предназначен для прямого включения.
+ *
+ * @see atomic.h
+ */
+
+#ifndef SE_ATOMIC_BUILTIN_H
+#define SE_ATOMIC_BUILTIN_H
+
+#include "atomic_order.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "bool.h"
+
+/**
+ * @def SE_ATOMIC_BUILTIN_DEFINE_BASE
+ * @brief Определяет чтение, запись, обмен и сравнение с обменом для типа `T`
+ *        с суффиксом имени `N`.
+ */
+#define SE_ATOMIC_BUILTIN_DEFINE_BASE(N, T)                                                          \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_load(se_atomic(T) const *self, se_atomic_order_t order)                        \
+    {                                                                                                \
+        return __atomic_load_n(self, (int)order);                                                    \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    void se_atomic_##N##_store(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        __atomic_store_n(self, value, (int)order);                                                   \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_exchange(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        return __atomic_exchange_n(self, value, (int)order);                                         \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_weak(                                                      \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        return __atomic_compare_exchange_n(self, expected, desired, 1, (int)success, (int)failure)     \
+                   ? true                                                                            \
+                   : false;                                                                          \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_strong(                                                    \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        return __atomic_compare_exchange_n(self, expected, desired, 0, (int)success, (int)failure)     \
+                   ? true                                                                            \
+                   : false;                                                                          \
+    }
+
+/**
+ * @def SE_ATOMIC_BUILTIN_DEFINE_INTEGER
+ * @brief Определяет операции `SE_ATOMIC_BUILTIN_DEFINE_BASE` и арифметику
+ *        для целого типа `T`.
+ */
+#define SE_ATOMIC_BUILTIN_DEFINE_INTEGER(N, T)                                                       \
+    SE_ATOMIC_BUILTIN_DEFINE_BASE(N, T)                                                              \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_add(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return __atomic_fetch_add(self, value, (int)order);                                          \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_sub(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return __atomic_fetch_sub(self, value, (int)order);                                          \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_and(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return __atomic_fetch_and(self, value, (int)order);                                          \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_or(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        return __atomic_fetch_or(self, value, (int)order);                                           \
+    }
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+SE_ATOMIC_BUILTIN_DEFINE_INTEGER(u32, se_u32_t)
+SE_ATOMIC_BUILTIN_DEFINE_INTEGER(u64, se_u64_t)
+SE_ATOMIC_BUILTIN_DEFINE_INTEGER(usize, se_usize_t)
+SE_ATOMIC_BUILTIN_DEFINE_BASE(ptr, void *)
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_thread_fence(se_atomic_order_t order)
+{
+    __atomic_thread_fence((int)order);
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_signal_fence(se_atomic_order_t order)
+{
+    __atomic_signal_fence((int)order);
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_pause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __atomic_signal_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+#ifdef SE_ATOMIC_HAS_U128
+SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_atomic_u128_compare_exchange(se_atomic_u128_t *self, se_u128_t *expected, se_u128_t desired)
+{
+    // Inline cmpxchg16b: the __atomic builtins would call into libatomic
+    se_u64_t      low  = (se_u64_t)*expected;
+    se_u64_t      high = (se_u64_t)(*expected >> 64);
+    unsigned char equal;
+
+    __asm__ __volatile__("lock cmpxchg16b %1\n\tsete %0"
+                         : "=q"(equal), "+m"(*self), "+a"(low), "+d"(high)
+                         : "b"((se_u64_t)desired), "c"((se_u64_t)(desired >> 64))
+                         : "memory", "cc");
+
+    if (equal)
+    {
+        return true;
+    }
+    *expected = ((se_u128_t)high << 64) | low;
+    return false;
+}
+#endif
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_ATOMIC_BUILTIN_H
@@ -0,0 +1,241 @@
+/**
+ * @file atomic_interlocked.h
+ * @brief Атомарные операции на функциях `_Interlocked*` MSVC.
+ *
+ * Операции чтения-записи (`exchange`, `compare_exchange`, `fetch_*`) —
+ * функции `_Interlocked*`, которые всегда упорядочены полностью. Чтение
+ * и запись — обращения к `volatile`-переменной с барьером компилятора
+ * на x86/x64 и барьером `dmb ish` на ARM для всех порядков, кроме
+ * `SE_ATOMIC_ORDER_RELAXED`. Запись с `SE_ATOMIC_ORDER_SEQ_CST` выполняется
+ * обменом. 64-битные чтение и запись на 32-битном x86 выполняются через
+ * `_InterlockedCompareExchange64`.
+ *
+ * Файл подключается через atomic.h и не предназначен для прямого включения.
+ *
+ * @see atomic.h
+ */
+
+#ifndef SE_ATOMIC_INTERLOCKED_H
+#define SE_ATOMIC_INTERLOCKED_H
+
+#include "atomic_order.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "bool.h"
+
+#include <intrin.h>
+
+#if defined(_M_ARM64) || defined(_M_ARM)
+#    define SE_ATOMIC_INTERLOCKED_BARRIER(order)                                                     \
+        do                                                                                           \
+        {                                                                                            \
+            if ((order) != SE_ATOMIC_ORDER_RELAXED)                                                  \
+            {                                                                                        \
+                __dmb(_ARM64_BARRIER_ISH);                                                           \
+            }                                                                                        \
+        } while (0)
+#else
+#    define SE_ATOMIC_INTERLOCKED_BARRIER(order) _ReadWriteBarrier()
+#endif
+
+/**
+ * @def SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER
+ * @brief Определяет операции для целого типа `T`, представленного
+ *        типом `L` функций `_Interlocked*<S>`.
+ */
+#define SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER(N, T, L, S)                                             \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_exchange(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        (void)order;                                                                                 \
+        return (T)_InterlockedExchange##S((volatile L *)self, (L)value);                            \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_strong(                                                    \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        const T previous = (T)_InterlockedCompareExchange##S((volatile L *)self, (L)desired, (L)*expected); \
+        (void)success;                                                                               \
+        (void)failure;                                                                               \
+        if (previous == *expected)                                                                   \
+        {                                                                                            \
+            return true;                                                                             \
+        }                                                                                            \
+        *expected = previous;                                                                        \
+        return false;                                                                                \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_weak(                                                      \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        return se_atomic_##N##_compare_exchange_strong(self, expected, desired, success, failure);   \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_load(se_atomic(T) const *self, se_atomic_order_t order)                        \
+    {                                                                                                \
+        T value;                                                                                     \
+        if (sizeof(T) > sizeof(void *))                                                              \
+        {                                                                                            \
+            value = (T)_InterlockedCompareExchange##S((volatile L *)self, 0, 0);                     \
+        }                                                                                            \
+        else                                                                                         \
+        {                                                                                            \
+            value = *self;                                                                           \
+            SE_ATOMIC_INTERLOCKED_BARRIER(order);                                                    \
+        }                                                                                            \
+        return value;                                                                                \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    void se_atomic_##N##_store(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        if (order == SE_ATOMIC_ORDER_SEQ_CST || sizeof(T) > sizeof(void *))                         \
+        {                                                                                            \
+            se_atomic_##N##_exchange(self, value, order);                                            \
+            return;                                                                                  \
+        }                                                                                            \
+        SE_ATOMIC_INTERLOCKED_BARRIER(order);                                                        \
+        *self = value;                                                                               \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_add(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        (void)order;                                                                                 \
+        return (T)_InterlockedExchangeAdd##S((volatile L *)self, (L)value);                         \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_sub(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        (void)order;                                                                                 \
+        return (T)_InterlockedExchangeAdd##S((volatile L *)self, (L)(T)(0 - value));                \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_and(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        T expected = se_atomic_##N##_load(self, SE_ATOMIC_ORDER_RELAXED);                            \
+        while (!se_atomic_##N##_compare_exchange_strong(self, &expected, expected & value, order, order)) \
+        {                                                                                            \
+        }                                                                                            \
+        return expected;                                                                             \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_or(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        T expected = se_atomic_##N##_load(self, SE_ATOMIC_ORDER_RELAXED);                            \
+        while (!se_atomic_##N##_compare_exchange_strong(self, &expected, expected | value, order, order)) \
+        {                                                                                            \
+        }                                                                                            \
+        return expected;                                                                             \
+    }
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER(u32, se_u32_t, long, )
+SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER(u64, se_u64_t, __int64, 64)
+#if defined(_WIN64)
+SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER(usize, se_usize_t, __int64, 64)
+#else
+SE_ATOMIC_INTERLOCKED_DEFINE_INTEGER(usize, se_usize_t, long, )
+#endif
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void *
+se_atomic_ptr_load(const se_atomic_ptr_t *self, se_atomic_order_t order)
+{
+    void *value = *self;
+    SE_ATOMIC_INTERLOCKED_BARRIER(order);
+    return value;
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void *
+se_atomic_ptr_exchange(se_atomic_ptr_t *self, void *value, se_atomic_order_t order)
+{
+    (void)order;
+    return _InterlockedExchangePointer((void *volatile *)self, value);
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_ptr_store(se_atomic_ptr_t *self, void *value, se_atomic_order_t order)
+{
+    if (order == SE_ATOMIC_ORDER_SEQ_CST)
+    {
+        se_atomic_ptr_exchange(self, value, order);
+        return;
+    }
+    SE_ATOMIC_INTERLOCKED_BARRIER(order);
+    *self = value;
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_atomic_ptr_compare_exchange_strong(
+    se_atomic_ptr_t *self, void **expected, void *desired, se_atomic_order_t success, se_atomic_order_t failure)
+{
+    void *const previous = _InterlockedCompareExchangePointer((void *volatile *)self, desired, *expected);
+    (void)success;
+    (void)failure;
+    if (previous == *expected)
+    {
+        return true;
+    }
+    *expected = previous;
+    return false;
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_atomic_ptr_compare_exchange_weak(
+    se_atomic_ptr_t *self, void **expected, void *desired, se_atomic_order_t success, se_atomic_order_t failure)
+{
+    return se_atomic_ptr_compare_exchange_strong(self, expected, desired, success, failure);
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_thread_fence(se_atomic_order_t order)
+{
+    if (order == SE_ATOMIC_ORDER_SEQ_CST)
+    {
+#if defined(_M_ARM64) || defined(_M_ARM)
+        __dmb(_ARM64_BARRIER_ISH);
+#elif defined(_M_X64)
+        __faststorefence();
+#else
+        _mm_mfence();
+#endif
+        return;
+    }
+    SE_ATOMIC_INTERLOCKED_BARRIER(order);
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_signal_fence(se_atomic_order_t order)
+{
+    (void)order;
+    _ReadWriteBarrier();
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_pause(void)
+{
+#if defined(_M_ARM64) || defined(_M_ARM)
+    __yield();
+#else
+    _mm_pause();
+#endif
+}
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_ATOMIC_INTERLOCKED_H
@@ -0,0 +1,38 @@
+/**
+ * @file atomic_order.h
+ * @brief Порядок доступа к памяти для атомарных операций.
+ *
+ * Значения `se_atomic_order_t` совпадают с константами `__ATOMIC_*`
+ * GCC/Clang, поэтому в основной реализации передаются встроенным функциям
+ * без преобразования. Остальные реализации (MSVC, C11 stdatomic)
+ * переводят их в свои барьеры.
+ *
+ * @see atomic.h
+ */
+
+#ifndef SE_ATOMIC_ORDER_H
+#define SE_ATOMIC_ORDER_H
+
+/**
+ * @enum se_atomic_order
+ * @brief Порядок доступа к памяти (модель памяти C11).
+ */
+typedef enum se_atomic_order
+{
+    /** Только атомарность, без упорядочивания соседних обращений. */
+    SE_ATOMIC_ORDER_RELAXED = 0,
+
+    /** Последующие обращения потока не переносятся до операции (для чтения). */
+    SE_ATOMIC_ORDER_ACQUIRE = 2,
+
+    /** Предыдущие обращения потока не переносятся после операции (для записи). */
+    SE_ATOMIC_ORDER_RELEASE = 3,
+
+    /** Acquire и release одновременно (для операций чтения-записи). */
+    SE_ATOMIC_ORDER_ACQ_REL = 4,
+
+    /** Acquire/release плюс единый порядок всех таких операций во всех потоках. */
+    SE_ATOMIC_ORDER_SEQ_CST = 5,
+} se_atomic_order_t;
+
+#endif // SE_ATOMIC_ORDER_H
@@ -0,0 +1,140 @@
+/**
+ * @file atomic_std.h
+ * @brief Атомарные операции на `<stdatomic.h>` стандарта C11.
+ *
+ * Запасная реализация для компиляторов, которые не распознаны
+ * compiler_type.h, но поддерживают атомарные типы C11. Доступна только в C.
+ *
+ * Файл подключается через atomic.h и не предназначен для прямого включения.
+ *
+ * @see atomic.h
+ */
+
+#ifndef SE_ATOMIC_STD_H
+#define SE_ATOMIC_STD_H
+
+#include "atomic_order.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "bool.h"
+
+#include <stdatomic.h>
+
+SE_ATTRIBUTE(FORCE_INLINE)
+memory_order
+se_atomic_std_order(se_atomic_order_t order)
+{
+    switch (order)
+    {
+    case SE_ATOMIC_ORDER_RELAXED: return memory_order_relaxed;
+    case SE_ATOMIC_ORDER_ACQUIRE: return memory_order_acquire;
+    case SE_ATOMIC_ORDER_RELEASE: return memory_order_release;
+    case SE_ATOMIC_ORDER_ACQ_REL: return memory_order_acq_rel;
+    default: return memory_order_seq_cst;
+    }
+}
+
+/**
+ * @def SE_ATOMIC_STD_DEFINE_BASE
+ * @brief Определяет чтение, запись, обмен и сравнение с обменом для типа `T`
+ *        с суффиксом имени `N`.
+ */
+#define SE_ATOMIC_STD_DEFINE_BASE(N, T)                                                              \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_load(se_atomic(T) const *self, se_atomic_order_t order)                        \
+    {                                                                                                \
+        return atomic_load_explicit(self, se_atomic_std_order(order));                               \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    void se_atomic_##N##_store(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        atomic_store_explicit(self, value, se_atomic_std_order(order));                              \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_exchange(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        return atomic_exchange_explicit(self, value, se_atomic_std_order(order));                    \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_weak(                                                      \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        return atomic_compare_exchange_weak_explicit(                                                \
+                   self, expected, desired, se_atomic_std_order(success), se_atomic_std_order(failure)) \
+                   ? true                                                                            \
+                   : false;                                                                          \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    bool se_atomic_##N##_compare_exchange_strong(                                                    \
+        se_atomic(T) *self, T *expected, T desired, se_atomic_order_t success, se_atomic_order_t failure) \
+    {                                                                                                \
+        return atomic_compare_exchange_strong_explicit(                                              \
+                   self, expected, desired, se_atomic_std_order(success), se_atomic_std_order(failure)) \
+                   ? true                                                                            \
+                   : false;                                                                          \
+    }
+
+/**
+ * @def SE_ATOMIC_STD_DEFINE_INTEGER
+ * @brief Определяет операции `SE_ATOMIC_STD_DEFINE_BASE` и арифметику
+ *        для целого типа `T`.
+ */
+#define SE_ATOMIC_STD_DEFINE_INTEGER(N, T)                                                           \
+    SE_ATOMIC_STD_DEFINE_BASE(N, T)                                                                  \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_add(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return atomic_fetch_add_explicit(self, value, se_atomic_std_order(order));                   \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_sub(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return atomic_fetch_sub_explicit(self, value, se_atomic_std_order(order));                   \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_and(se_atomic(T) *self, T value, se_atomic_order_t order)                \
+    {                                                                                                \
+        return atomic_fetch_and_explicit(self, value, se_atomic_std_order(order));                   \
+    }                                                                                                \
+                                                                                                     \
+    SE_ATTRIBUTE(FORCE_INLINE)                                                                       \
+    T se_atomic_##N##_fetch_or(se_atomic(T) *self, T value, se_atomic_order_t order)                 \
+    {                                                                                                \
+        return atomic_fetch_or_explicit(self, value, se_atomic_std_order(order));                    \
+    }
+
+SE_ATOMIC_STD_DEFINE_INTEGER(u32, se_u32_t)
+SE_ATOMIC_STD_DEFINE_INTEGER(u64, se_u64_t)
+SE_ATOMIC_STD_DEFINE_INTEGER(usize, se_usize_t)
+SE_ATOMIC_STD_DEFINE_BASE(ptr, void *)
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_thread_fence(se_atomic_order_t order)
+{
+    atomic_thread_fence(se_atomic_std_order(order));
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_signal_fence(se_atomic_order_t order)
+{
+    atomic_signal_fence(se_atomic_std_order(order));
+}
+
+SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_atomic_pause(void)
+{
+    // No portable processor hint: only keep the compiler from collapsing the spin loop
+    atomic_signal_fence(memory_order_seq_cst);
+}
+
+#endif // SE_ATOMIC_STD_H
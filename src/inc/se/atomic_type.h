@@ -0,0 +1,107 @@
+/**
+ * @file atomic_type.h
+ * @brief Выбор реализации атомарных операций и атомарные типы.
+ *
+ * Реализация выбирается по типу компилятора (см. compiler_type.h):
+ * - GCC и Clang: встроенные функции `__atomic_*` (`SE_ATOMIC_BACKEND_BUILTIN`);
+ * - MSVC: функции `_Interlocked*` и барьеры (`SE_ATOMIC_BACKEND_INTERLOCKED`);
+ * - другой компилятор C11 без `__STDC_NO_ATOMICS__`: `<stdatomic.h>`
+ *   (`SE_ATOMIC_BACKEND_STD`).
+ *
+ * В первых двух реализациях атомарные типы — обычные целые и указатели,
+ * поэтому их можно размещать в структурах публичных заголовков, которые
+ * компилируются и как C, и как C++. К атомарным переменным следует
+ * обращаться только через функции `se_atomic_*`.
+ *
+ * @see atomic.h
+ */
+
+#ifndef SE_ATOMIC_TYPE_H
+#define SE_ATOMIC_TYPE_H
+
+#include "compiler_type.h"
+#include "numeric_fixed.h"
+#include "size.h"
+
+/**
+ * @def SE_ATOMIC_BACKEND_BUILTIN
+ * @brief Реализация на встроенных функциях `__atomic_*` GCC/Clang.
+ */
+#define SE_ATOMIC_BACKEND_BUILTIN 1
+
+/**
+ * @def SE_ATOMIC_BACKEND_INTERLOCKED
+ * @brief Реализация на функциях `_Interlocked*` MSVC.
+ */
+#define SE_ATOMIC_BACKEND_INTERLOCKED 2
+
+/**
+ * @def SE_ATOMIC_BACKEND_STD
+ * @brief Реализация на `<stdatomic.h>` стандарта C11.
+ */
+#define SE_ATOMIC_BACKEND_STD 3
+
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+#    define SE_ATOMIC_BACKEND SE_ATOMIC_BACKEND_BUILTIN
+
+/**
+ * @def se_atomic
+ * @brief Атомарный вариант типа `T`.
+ */
+#    define se_atomic(T) T
+
+#elif (SE_COMPILER_TYPE == SE_COMPILER_TYPE_MSVC)
+#    define SE_ATOMIC_BACKEND SE_ATOMIC_BACKEND_INTERLOCKED
+#    define se_atomic(T)      volatile T
+
+#elif !defined(__cplusplus) && defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) &&                \
+    !defined(__STDC_NO_ATOMICS__)
+#    include <stdatomic.h>
+#    define SE_ATOMIC_BACKEND SE_ATOMIC_BACKEND_STD
+#    define se_atomic(T)      _Atomic(T)
+
+#else
+#    error "Atomic operations are not supported by the compiler"
+#endif
+
+/**
+ * @typedef se_atomic_u32_t
+ * @brief Атомарное беззнаковое 32-битное целое (пригодно для `se_futex_wait`).
+ */
+typedef se_atomic(se_u32_t) se_atomic_u32_t;
+
+/**
+ * @typedef se_atomic_u64_t
+ * @brief Атомарное беззнаковое 64-битное целое.
+ */
+typedef se_atomic(se_u64_t) se_atomic_u64_t;
+
+/**
+ * @typedef se_atomic_usize_t
+ * @brief Атомарный размер.
+ */
+typedef se_atomic(se_usize_t) se_atomic_usize_t;
+
+/**
+ * @typedef se_atomic_ptr_t
+ * @brief Атомарный нетипизированный указатель.
+ */
+typedef se_atomic(void *) se_atomic_ptr_t;
+
+#if (SE_ATOMIC_BACKEND == SE_ATOMIC_BACKEND_BUILTIN) && defined(__x86_64__) && defined(SE_INT128_T_SIZE) &&   \
+    (SE_INT128_T_SIZE == 16)
+/**
+ * @def SE_ATOMIC_HAS_U128
+ * @brief Определен, если доступно 128-битное сравнение с обменом
+ *        (`se_atomic_u128_compare_exchange`, инструкция `cmpxchg16b`).
+ */
+#    define SE_ATOMIC_HAS_U128 1
+
+/**
+ * @typedef se_atomic_u128_t
+ * @brief Атомарное беззнаковое 128-битное целое (выровнено по 16 байт).
+ */
+typedef se_u128_t se_atomic_u128_t;
+#endif
+
+#endif // SE_ATOMIC_TYPE_H
@@ -13,8 +13,12 @@
 #ifndef SE_ATTRIBUTE_H
 #define SE_ATTRIBUTE_H
 
+#include "attribute_aligned.h"
+#include "attribute_cold.h"
 #include "attribute_force_inline.h"
+#include "attribute_noinline.h"
 #include "attribute_noreturn.h"
+#include "attribute_returns_twice.h"
 #include "attribute_symbol.h"
 #include "attribute_target.h"
 #include "attribute_thread_local.h"
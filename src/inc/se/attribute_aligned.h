@@ -0,0 +1,36 @@
+/**
+ * @file attribute_aligned.h
+ * @brief Заголовочный файл, который содержит макрос `SE_ATTRIBUTE_ALIGNED(x)`,
+ *        оборачивающий поведение макроса `SE_COMPILER_ATTRIBUTE_ALIGNED(x)`.
+ *
+ * Макрос задает минимальное выравнивание типа или переменной в байтах.
+ * Используется, чтобы разнести по кэш-линиям данные, к которым обращаются
+ * разные потоки.
+ *
+ * Пример использования:
+ * @code
+ * typedef struct SE_ATTRIBUTE(ALIGNED(64)) counter
+ * {
+ *     se_atomic_u64_t value;
+ * } counter_t;
+ * @endcode
+ *
+ * @see SE_COMPILER_ATTRIBUTE_ALIGNED
+ */
+
+#ifndef SE_ATTRIBUTE_ALIGNED_H
+#define SE_ATTRIBUTE_ALIGNED_H
+
+#include "compiler.h"
+
+/**
+ * @def SE_ATTRIBUTE_ALIGNED(x)
+ * @brief Обертка для макроса `SE_COMPILER_ATTRIBUTE_ALIGNED(x)`.
+ *
+ * @param x Выравнивание в байтах (степень двойки).
+ *
+ * @see SE_COMPILER_ATTRIBUTE_ALIGNED
+ */
+#define SE_ATTRIBUTE_ALIGNED(x) SE_COMPILER_ATTRIBUTE_ALIGNED(x)
+
+#endif // SE_ATTRIBUTE_ALIGNED_H
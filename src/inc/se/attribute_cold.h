@@ -0,0 +1,29 @@
+/**
+ * @file attribute_cold.h
+ * @brief Заголовочный файл, который содержит макрос `SE_ATTRIBUTE_COLD`,
+ *        оборачивающий поведение макроса `SE_COMPILER_ATTRIBUTE_COLD`.
+ *
+ * Пример использования:
+ * @code
+ * SE_ATTRIBUTE(COLD)
+ * void
+ * report_failure(int code);
+ * @endcode
+ *
+ * @see SE_COMPILER_ATTRIBUTE_COLD
+ */
+
+#ifndef SE_ATTRIBUTE_COLD_H
+#define SE_ATTRIBUTE_COLD_H
+
+#include "compiler.h"
+
+/**
+ * @def SE_ATTRIBUTE_COLD
+ * @brief Обертка для макроса `SE_COMPILER_ATTRIBUTE_COLD`.
+ *
+ * @see SE_COMPILER_ATTRIBUTE_COLD
+ */
+#define SE_ATTRIBUTE_COLD SE_COMPILER_ATTRIBUTE_COLD
+
+#endif // SE_ATTRIBUTE_COLD_H
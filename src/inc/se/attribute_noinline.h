@@ -0,0 +1,22 @@
+/**
+ * @file attribute_noinline.h
+ * @brief Заголовочный файл, который содержит макрос `SE_ATTRIBUTE_NOINLINE`,
+ *        оборачивающий поведение макроса `SE_COMPILER_ATTRIBUTE_NOINLINE`.
+ *
+ * @see SE_COMPILER_ATTRIBUTE_NOINLINE
+ */
+
+#ifndef SE_ATTRIBUTE_NOINLINE_H
+#define SE_ATTRIBUTE_NOINLINE_H
+
+#include "compiler.h"
+
+/**
+ * @def SE_ATTRIBUTE_NOINLINE
+ * @brief Обертка для макроса `SE_COMPILER_ATTRIBUTE_NOINLINE`.
+ *
+ * @see SE_COMPILER_ATTRIBUTE_NOINLINE
+ */
+#define SE_ATTRIBUTE_NOINLINE SE_COMPILER_ATTRIBUTE_NOINLINE
+
+#endif // SE_ATTRIBUTE_NOINLINE_H
@@ -0,0 +1,29 @@
+/**
+ * @file attribute_returns_twice.h
+ * @brief Заголовочный файл, который содержит макрос `SE_ATTRIBUTE_RETURNS_TWICE`,
+ *        оборачивающий поведение макроса `SE_COMPILER_ATTRIBUTE_RETURNS_TWICE`.
+ *
+ * Пример использования:
+ * @code
+ * SE_ATTRIBUTE(RETURNS_TWICE)
+ * int
+ * context_save(context_t *context);
+ * @endcode
+ *
+ * @see SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+ */
+
+#ifndef SE_ATTRIBUTE_RETURNS_TWICE_H
+#define SE_ATTRIBUTE_RETURNS_TWICE_H
+
+#include "compiler.h"
+
+/**
+ * @def SE_ATTRIBUTE_RETURNS_TWICE
+ * @brief Обертка для макроса `SE_COMPILER_ATTRIBUTE_RETURNS_TWICE`.
+ *
+ * @see SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+ */
+#define SE_ATTRIBUTE_RETURNS_TWICE SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+
+#endif // SE_ATTRIBUTE_RETURNS_TWICE_H
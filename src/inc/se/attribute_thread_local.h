@@ -10,6 +10,9 @@
  *   будет определен как атрибут компилятора, указывающий на то,
  *   что переменные локальны для потока.
  *
+ * - Если дополнительно включена опция SE_LIBRARY_OPTION_THREAD_LOCAL_INITIAL_EXEC,
+ *   переменные используют модель `initial-exec` (без `__tls_get_addr`).
+ *
  * - В противном случае, этот макрос остается пустым,
  *   что означает отсутствие специального атрибута для локальности в потоке.
  */
@@ -19,7 +22,16 @@
 
 #include "compiler.h"
 
-#ifdef SE_LIBRARY_OPTION_THREAD_LOCAL
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL) && defined(SE_LIBRARY_OPTION_THREAD_LOCAL_INITIAL_EXEC)
+/**
+ * @def SE_ATTRIBUTE_THREAD_LOCAL
+ * @brief Атрибут для локальных потоковых переменных с моделью `initial-exec`.
+ *
+ * Доступ к переменной из разделяемой библиотеки не вызывает
+ * `__tls_get_addr`: смещение известно после загрузки библиотеки.
+ */
+#    define SE_ATTRIBUTE_THREAD_LOCAL SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC
+#elif defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
 /**
  * @def SE_ATTRIBUTE_THREAD_LOCAL
  * @brief Атрибут для локальных потоковых переменных.
@@ -0,0 +1,88 @@
+/**
+ * @file barrier.h
+ * @brief Многоразовый барьер для фиксированного числа потоков.
+ *
+ * Каждый поток вызывает `se_barrier_arrive_and_wait` и продолжает работу,
+ * когда до барьера дойдут все `count` потоков. Затем барьер сразу готов
+ * к следующей фазе.
+ *
+ * Фазы различаются номером поколения: последний пришедший поток
+ * сбрасывает счетчик прибывших и увеличивает поколение, а остальные
+ * ждут его изменения — сначала крутясь `SE_BARRIER_SPIN_COUNT` итераций,
+ * затем на futex (см. futex.h). Младший бит поколения — флаг «есть
+ * спящие»: если никто не уснул, фаза завершается без системного вызова.
+ *
+ * Пример использования:
+ * @code
+ * se_barrier_t barrier;
+ * se_barrier_init(&barrier, thread_count, nullptr);
+ *
+ * // Каждый поток
+ * for (int step = 0; step < steps; ++step)
+ * {
+ *     compute_step(step);
+ *     se_barrier_arrive_and_wait(&barrier);
+ * }
+ * @endcode
+ *
+ * @see lock_stats.h
+ */
+
+#ifndef SE_BARRIER_H
+#define SE_BARRIER_H
+
+#include "lock_stats.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "bool.h"
+
+/**
+ * @def SE_BARRIER_SPIN_COUNT
+ * @brief Количество проверок с паузой перед засыпанием.
+ */
+#define SE_BARRIER_SPIN_COUNT 1024
+
+/**
+ * @struct se_barrier
+ * @brief Барьер.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_barrier
+{
+    se_atomic_u32_t  arrived;    /**< Количество потоков, пришедших в текущей фазе. */
+    se_atomic_u32_t  generation; /**< Номер фазы в старших битах и флаг «есть спящие» в младшем. */
+    se_u32_t         count;      /**< Количество потоков в фазе. */
+    se_lock_stats_t *stats;      /**< Счетчики конкуренции или `nullptr`. */
+} se_barrier_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает барьер.
+ *
+ * @param[out] self Указатель на барьер.
+ * @param[in] count Количество потоков в фазе (больше нуля).
+ * @param[in] stats Счетчики конкуренции или `nullptr`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_barrier_init(se_barrier_t *self, se_u32_t count, se_lock_stats_t *stats);
+
+/**
+ * @brief Отмечает приход потока и ожидает остальных.
+ *
+ * Изменения памяти, сделанные любым участником до барьера,
+ * видны всем участникам после него.
+ *
+ * @param[in] self Указатель на барьер.
+ * @return `true` ровно для одного потока фазы — пришедшего последним.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_barrier_arrive_and_wait(se_barrier_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_BARRIER_H
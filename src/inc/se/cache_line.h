@@ -0,0 +1,34 @@
+/**
+ * @file cache_line.h
+ * @brief Заголовочный файл, определяющий размер кэш-линии `SE_CACHE_LINE_SIZE`.
+ *
+ * Размер используется всеми модулями библиотеки, которые разносят по
+ * отдельным кэш-линиям данные, изменяемые разными потоками, или выравнивают
+ * блоки памяти, чтобы исключить ложное разделение (false sharing).
+ *
+ * Пример использования:
+ * @code
+ * typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) counter
+ * {
+ *     se_atomic_u64_t value;
+ * } counter_t;
+ * @endcode
+ *
+ * @see attribute_aligned.h
+ */
+
+#ifndef SE_CACHE_LINE_H
+#define SE_CACHE_LINE_H
+
+#ifndef SE_CACHE_LINE_SIZE
+/**
+ * @def SE_CACHE_LINE_SIZE
+ * @brief Размер кэш-линии в байтах (степень двойки).
+ *
+ * Может быть переопределен до подключения заголовка, если целевой
+ * процессор использует другой размер.
+ */
+#    define SE_CACHE_LINE_SIZE 64
+#endif
+
+#endif // SE_CACHE_LINE_H
@@ -16,6 +16,7 @@
  * - `compiler_bit_depth.h`: Определяет разрядность системы (32 или 64 бита).
  * - `compiler_destructor.h`: Определяет атрибуты для вызова деструкторов.
  * - `compiler_constructor.h`: Определяет атрибуты для вызова конструкторов.
+ * - `compiler_expect.h`: Предоставляет подсказки о вероятности условий.
  * - `compiler_std_version.h`: Определяет используемую версию стандарта C.
  * - `compiler_unreachable.h`: Предоставляет макросы для пометки недостижимого кода.
  *
@@ -32,6 +33,7 @@
 #include "compiler_bit_depth.h"
 #include "compiler_constructor.h"
 #include "compiler_destructor.h"
+#include "compiler_expect.h"
 #include "compiler_extern.h"
 #include "compiler_extern_c.h"
 #include "compiler_std_version.h"
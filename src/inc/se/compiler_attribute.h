@@ -9,8 +9,14 @@
  * функций, которые не возвращают управление.
  *
  * Включаемые файлы:
+ * - `compiler_attribute_aligned.h`:
+ *    Атрибуты для выравнивания типов и переменных.
+ * - `compiler_attribute_cold.h`:
+ *    Атрибуты для пометки редко выполняемых функций.
  * - `compiler_attribute_force_inline.h`:
  *    Определения встроенных функций компилятора.
+ * - `compiler_attribute_noinline.h`:
+ *    Атрибуты для запрета встраивания функций.
  * - `compiler_attribute_symbol.h`:
  *    Атрибуты для управления экспортом и импортом символов.
  * - `compiler_attribute_unused.h`:
@@ -21,6 +27,8 @@
  *    Атрибуты для специфичных оптимизаций под определенные архитектуры.
  * - `compiler_attribute_no_return.h`:
  *    Атрибуты для пометки функций, которые не возвращают управление.
+ * - `compiler_attribute_returns_twice.h`:
+ *    Атрибуты для пометки функций, которые возвращают управление повторно.
  *
  * @note Этот заголовок упрощает управление атрибутами компилятора,
  *       делая код более переносимым и единообразным
@@ -32,8 +40,12 @@
 #ifndef SE_COMPILER_ATTRIBUTE_H
 #define SE_COMPILER_ATTRIBUTE_H
 
+#include "compiler_attribute_aligned.h"
+#include "compiler_attribute_cold.h"
 #include "compiler_attribute_force_inline.h"
+#include "compiler_attribute_noinline.h"
 #include "compiler_attribute_noreturn.h"
+#include "compiler_attribute_returns_twice.h"
 #include "compiler_attribute_symbol.h"
 #include "compiler_attribute_target.h"
 #include "compiler_attribute_thread_local.h"
@@ -0,0 +1,61 @@
+/**
+ * @file compiler_attribute_aligned.h
+ * @brief Заголовочный файл, который определяет макрос для атрибута выравнивания
+ *        типов и переменных в зависимости от типа компилятора.
+ *
+ * Этот файл содержит макрос `SE_COMPILER_ATTRIBUTE_ALIGNED(x)`, который задает
+ * минимальное выравнивание типа или переменной в байтах.
+ *
+ * Для компиляторов GCC и Clang используется атрибут `__attribute__((aligned(x)))`,
+ * для MSVC — `__declspec(align(x))`, а для других компиляторов выводится
+ * предупреждающее сообщение с использованием директивы `#pragma message`.
+ *
+ * @note Атрибут ставится между ключевым словом `struct` и именем структуры,
+ *       так его понимают все поддерживаемые компиляторы.
+ */
+
+#ifndef SE_COMPILER_ATTRIBUTE_ALIGNED_H
+#define SE_COMPILER_ATTRIBUTE_ALIGNED_H
+
+#include "compiler_type.h"
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_ALIGNED(x)
+ * @brief Задает выравнивание типа или переменной для компиляторов GCC и Clang.
+ *
+ * Размер выровненной структуры округляется вверх до кратного `x`,
+ * поэтому соседние элементы массива таких структур не делят выровненный блок.
+ *
+ * Пример использования:
+ * @code
+ * typedef struct __attribute__((aligned(64))) counter { int value; } counter_t;
+ * @endcode
+ *
+ * @param x Выравнивание в байтах (степень двойки).
+ */
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+#    define SE_COMPILER_ATTRIBUTE_ALIGNED(x) __attribute__((aligned(x)))
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_ALIGNED(x)
+ * @brief Задает выравнивание типа или переменной для компилятора MSVC.
+ *
+ * @param x Выравнивание в байтах (степень двойки).
+ */
+#elif (SE_COMPILER_TYPE == SE_COMPILER_TYPE_MSVC)
+#    define SE_COMPILER_ATTRIBUTE_ALIGNED(x) __declspec(align(x))
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_ALIGNED(x)
+ * @brief Для остальных компиляторов атрибут не определяется,
+ *        и при компиляции выводится предупреждающее сообщение.
+ *
+ * @param x Параметр игнорируется.
+ */
+#else
+#    define SE_COMPILER_ATTRIBUTE_ALIGNED(x)
+
+#    pragma message("Warning: Compiler does not support aligned attribute")
+#endif
+
+#endif // SE_COMPILER_ATTRIBUTE_ALIGNED_H
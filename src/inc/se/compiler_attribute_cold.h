@@ -0,0 +1,44 @@
+/**
+ * @file compiler_attribute_cold.h
+ * @brief Заголовочный файл, который определяет макрос для пометки
+ *        редко выполняемых функций.
+ *
+ * Этот файл содержит макрос `SE_COMPILER_ATTRIBUTE_COLD`. Компилятор
+ * оптимизирует такую функцию по размеру, размещает ее в секции `.text.unlikely`
+ * вдали от горячего кода и считает ветви, ведущие к ее вызову, маловероятными.
+ *
+ * Для компиляторов GCC и Clang используется атрибут `__attribute__((cold))`,
+ * для остальных выводится предупреждающее сообщение с использованием директивы `#pragma message`.
+ */
+
+#ifndef SE_COMPILER_ATTRIBUTE_COLD_H
+#define SE_COMPILER_ATTRIBUTE_COLD_H
+
+#include "compiler_type.h"
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_COLD
+ * @brief Помечает функцию как редко выполняемую (GCC и Clang).
+ */
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+#    define SE_COMPILER_ATTRIBUTE_COLD __attribute__((cold))
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_COLD
+ * @brief MSVC не имеет аналога: атрибут не определяется.
+ */
+#elif (SE_COMPILER_TYPE == SE_COMPILER_TYPE_MSVC)
+#    define SE_COMPILER_ATTRIBUTE_COLD
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_COLD
+ * @brief Для остальных компиляторов атрибут не определяется,
+ *        и при компиляции выводится предупреждающее сообщение.
+ */
+#else
+#    define SE_COMPILER_ATTRIBUTE_COLD
+
+#    pragma message("Warning: Compiler does not support cold attribute")
+#endif
+
+#endif // SE_COMPILER_ATTRIBUTE_COLD_H
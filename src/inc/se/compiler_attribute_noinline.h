@@ -0,0 +1,45 @@
+/**
+ * @file compiler_attribute_noinline.h
+ * @brief Заголовочный файл, который определяет макрос для запрета
+ *        встраивания функции.
+ *
+ * Этот файл содержит макрос `SE_COMPILER_ATTRIBUTE_NOINLINE`. Тело такой
+ * функции существует в одном экземпляре, а в месте вызова остается только
+ * инструкция вызова.
+ *
+ * Для компиляторов GCC и Clang используется атрибут `__attribute__((noinline))`,
+ * для MSVC — `__declspec(noinline)`, а для других компиляторов выводится
+ * предупреждающее сообщение с использованием директивы `#pragma message`.
+ */
+
+#ifndef SE_COMPILER_ATTRIBUTE_NOINLINE_H
+#define SE_COMPILER_ATTRIBUTE_NOINLINE_H
+
+#include "compiler_type.h"
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_NOINLINE
+ * @brief Запрещает встраивание функции для компиляторов GCC и Clang.
+ */
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+#    define SE_COMPILER_ATTRIBUTE_NOINLINE __attribute__((noinline))
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_NOINLINE
+ * @brief Запрещает встраивание функции для компилятора MSVC.
+ */
+#elif (SE_COMPILER_TYPE == SE_COMPILER_TYPE_MSVC)
+#    define SE_COMPILER_ATTRIBUTE_NOINLINE __declspec(noinline)
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_NOINLINE
+ * @brief Для остальных компиляторов атрибут не определяется,
+ *        и при компиляции выводится предупреждающее сообщение.
+ */
+#else
+#    define SE_COMPILER_ATTRIBUTE_NOINLINE
+
+#    pragma message("Warning: Compiler does not support noinline attribute")
+#endif
+
+#endif // SE_COMPILER_ATTRIBUTE_NOINLINE_H
@@ -0,0 +1,38 @@
+/**
+ * @file compiler_attribute_returns_twice.h
+ * @brief Заголовочный файл, который определяет макрос для пометки функций,
+ *        возвращающих управление повторно (как `setjmp`).
+ *
+ * Этот файл содержит макрос `SE_COMPILER_ATTRIBUTE_RETURNS_TWICE`. Компилятор
+ * не держит значения в регистрах на протяжении вызова такой функции
+ * и не переносит через него операции с памятью, поэтому повторный
+ * возврат через восстановление контекста не видит устаревших значений.
+ *
+ * Для компиляторов GCC и Clang используется атрибут `__attribute__((returns_twice))`,
+ * для остальных выводится предупреждающее сообщение с использованием директивы `#pragma message`.
+ */
+
+#ifndef SE_COMPILER_ATTRIBUTE_RETURNS_TWICE_H
+#define SE_COMPILER_ATTRIBUTE_RETURNS_TWICE_H
+
+#include "compiler_type.h"
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+ * @brief Помечает функцию, которая может вернуть управление повторно (GCC и Clang).
+ */
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+#    define SE_COMPILER_ATTRIBUTE_RETURNS_TWICE __attribute__((returns_twice))
+
+/**
+ * @def SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+ * @brief Для остальных компиляторов атрибут не определяется,
+ *        и при компиляции выводится предупреждающее сообщение.
+ */
+#else
+#    define SE_COMPILER_ATTRIBUTE_RETURNS_TWICE
+
+#    pragma message("Warning: Compiler does not support returns twice attribute")
+#endif
+
+#endif // SE_COMPILER_ATTRIBUTE_RETURNS_TWICE_H
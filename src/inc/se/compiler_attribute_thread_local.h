@@ -13,9 +13,13 @@
  * @note Для неподдерживаемых компиляторов макрос будет определен как пустой,
  *       и сгенерируется предупреждение.
  *
- * Макрос:
+ * Макросы:
  * - `SE_COMPILER_ATTRIBUTE_THREAD_LOCAL`:
  *    Определяет потоковую локальную область хранения.
+ * - `SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC`:
+ *    То же с моделью `initial-exec`: переменная адресуется постоянным
+ *    смещением от указателя потока, без вызова `__tls_get_addr`
+ *    из разделяемой библиотеки.
  *
  * @warning На неподдерживаемых компиляторах этот макрос
  *          не будет создавать потоковую локальную память.
@@ -36,6 +40,16 @@
  */
 #    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL __thread
 
+/**
+ * @def SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC
+ * @brief Потоковая локальная память с моделью `initial-exec` для GCC и Clang.
+ * @details Смещение переменной вычисляется при загрузке модуля, поэтому
+ *          доступ к ней — одна инструкция относительно `%fs`/`tpidr_el0`.
+ *          Модуль, загружаемый через `dlopen`, занимает резерв статической
+ *          потоковой памяти загрузчика.
+ */
+#    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC __thread __attribute__((tls_model("initial-exec")))
+
 #elif (SE_COMPILER_TYPE == SE_COMPILER_TYPE_MSVC)
 /**
  * @def SE_COMPILER_ATTRIBUTE_THREAD_LOCAL
@@ -46,6 +60,14 @@
  */
 #    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL __declspec(thread)
 
+/**
+ * @def SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC
+ * @brief Потоковая локальная память для MSVC.
+ * @details Индекс TLS модуля MSVC и так фиксирован при загрузке,
+ *          отдельной модели не требуется.
+ */
+#    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC __declspec(thread)
+
 #else
 /**
  * @def SE_COMPILER_ATTRIBUTE_THREAD_LOCAL
@@ -60,6 +82,7 @@
  *          не даст желаемого эффекта и приведет к предупреждению компилятора.
  */
 #    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL
+#    define SE_COMPILER_ATTRIBUTE_THREAD_LOCAL_INITIAL_EXEC
 
 #    pragma message("Warning: Compiler does not support thread-local storage attribute")
 #endif
@@ -0,0 +1,50 @@
+/**
+ * @file compiler_expect.h
+ * @brief Подсказки компилятору о вероятности условий.
+ *
+ * Макросы `se_compiler_likely` и `se_compiler_unlikely` сообщают
+ * компилятору ожидаемое значение условия: маловероятная ветвь
+ * выносится из горячего пути, а вероятная идет без перехода.
+ *
+ * Пример использования:
+ * @code
+ * if (se_compiler_unlikely(!ptr))
+ * {
+ *     report_failure();
+ * }
+ * @endcode
+ */
+
+#ifndef SE_COMPILER_EXPECT_H
+#define SE_COMPILER_EXPECT_H
+
+#include "compiler_type.h"
+
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC) || (SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+/**
+ * @def se_compiler_likely
+ * @brief Условие, которое почти всегда истинно (`__builtin_expect`).
+ */
+#    define se_compiler_likely(x) __builtin_expect(!!(x), 1)
+
+/**
+ * @def se_compiler_unlikely
+ * @brief Условие, которое почти всегда ложно (`__builtin_expect`).
+ */
+#    define se_compiler_unlikely(x) __builtin_expect(!!(x), 0)
+
+#else
+/**
+ * @def se_compiler_likely
+ * @brief Без подсказки: условие вычисляется как есть.
+ */
+#    define se_compiler_likely(x) (!!(x))
+
+/**
+ * @def se_compiler_unlikely
+ * @brief Без подсказки: условие вычисляется как есть.
+ */
+#    define se_compiler_unlikely(x) (!!(x))
+#endif
+
+#endif // SE_COMPILER_EXPECT_H
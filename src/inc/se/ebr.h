@@ -0,0 +1,168 @@
+/**
+ * @file ebr.h
+ * @brief Безопасное освобождение памяти для структур без блокировок.
+ *
+ * Узел, исключенный из структуры без блокировок, нельзя освободить сразу:
+ * другой поток мог прочитать указатель на него и еще обращаться к нему.
+ * Модуль откладывает освобождение до момента, когда это безопасно.
+ * Предлагаются две схемы; каждая структура выбирает одну из них.
+ *
+ * Эпохи (EBR). Читатели обращаются к узлам только между `se_ebr_enter`
+ * и `se_ebr_leave`. Каждый поток хранит в своей записи эпоху, в которой
+ * вошел в критическую секцию. Глобальная эпоха увеличивается, когда все
+ * активные потоки дошли до текущей. Узел, переданный в `se_ebr_retire`
+ * в эпоху `e`, освобождается, когда глобальная эпоха достигнет `e + 2`.
+ * Вход и выход стоят одну запись в собственную кэш-линию потока, но
+ * поток, надолго оставшийся в критической секции, задерживает
+ * освобождение всех узлов.
+ *
+ * Указатели опасности (hazard pointers). Читатель публикует указатель
+ * в одну из `SE_EBR_HAZARD_COUNT` ячеек потока (`se_ebr_protect`) перед
+ * обращением к узлу. Узел, переданный в `se_ebr_retire_protected`,
+ * освобождается, когда ни одна ячейка не указывает на него. Чтение
+ * дороже, зато число неосвобожденных узлов ограничено количеством ячеек
+ * всех потоков и порогом сканирования.
+ *
+ * Освобождение пакетное: узлы копятся в списках потока и обрабатываются
+ * каждые `SE_EBR_BATCH_SIZE` вызовов (или явно `se_ebr_collect`). Узел
+ * освобождается функцией `dealloc` либо, если она равна `nullptr`,
+ * текущим аллокатором среды выполнения (см. runtime_allocator.h).
+ *
+ * Записи потоков берутся прямо из страниц памяти и не возвращаются.
+ * `se_ebr_thread_detach` освобождает запись для повторного использования
+ * новым потоком, который наследует и ее неосвобожденные узлы.
+ *
+ * Пример использования:
+ * @code
+ * // Читатель
+ * se_ebr_enter();
+ * node_t *node = se_atomic_ptr_load(&list->head, SE_ATOMIC_ORDER_ACQUIRE);
+ * use(node);
+ * se_ebr_leave();
+ *
+ * // Писатель, исключивший узел из списка
+ * se_ebr_retire(node, nullptr);
+ * @endcode
+ *
+ * @note Записи потоков адресуются потоковыми переменными, поэтому модуль
+ *       требует опции `SE_LIBRARY_OPTION_THREAD_LOCAL`.
+ *
+ * @see runtime_allocator.h
+ */
+
+#ifndef SE_EBR_H
+#define SE_EBR_H
+
+#include "memory_allocator_dealloc_fn.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def SE_EBR_BATCH_SIZE
+ * @brief Через сколько отложенных узлов поток пытается их освободить.
+ */
+#define SE_EBR_BATCH_SIZE 64
+
+/**
+ * @def SE_EBR_HAZARD_COUNT
+ * @brief Количество ячеек указателей опасности у каждого потока.
+ */
+#define SE_EBR_HAZARD_COUNT 4
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Входит в критическую секцию эпох.
+ *
+ * Узлы, прочитанные внутри секции, не будут освобождены до выхода из нее.
+ * Секции могут быть вложенными.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_enter(void);
+
+/**
+ * @brief Выходит из критической секции эпох.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_leave(void);
+
+/**
+ * @brief Откладывает освобождение узла, защищаемого эпохами.
+ *
+ * Узел должен быть уже недоступен из структуры. Вызов допустим как внутри,
+ * так и вне критической секции.
+ *
+ * @param[in] ptr Указатель на узел.
+ * @param[in] dealloc Функция освобождения или `nullptr` для аллокатора среды выполнения.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_retire(void *ptr, se_memory_allocator_dealloc_fn *dealloc);
+
+/**
+ * @brief Публикует указатель опасности на узел.
+ *
+ * Читает `source` до тех пор, пока опубликованное значение не совпадет
+ * с прочитанным повторно: после этого узел не будет освобожден, пока
+ * ячейка не изменится.
+ *
+ * @param[in] slot Номер ячейки (меньше `SE_EBR_HAZARD_COUNT`).
+ * @param[in] source Атомарный указатель, из которого читается узел.
+ * @return Защищенный указатель (может быть `nullptr`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_ebr_protect(se_usize_t slot, se_atomic_ptr_t *source);
+
+/**
+ * @brief Снимает указатель опасности.
+ * @param[in] slot Номер ячейки (меньше `SE_EBR_HAZARD_COUNT`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_clear(se_usize_t slot);
+
+/**
+ * @brief Откладывает освобождение узла, защищаемого указателями опасности.
+ *
+ * @param[in] ptr Указатель на узел.
+ * @param[in] dealloc Функция освобождения или `nullptr` для аллокатора среды выполнения.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_retire_protected(void *ptr, se_memory_allocator_dealloc_fn *dealloc);
+
+/**
+ * @brief Пытается продвинуть эпоху и освобождает все отложенные узлы потока,
+ *        которые уже безопасно освободить.
+ *
+ * @return Количество освобожденных узлов.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ebr_collect(void);
+
+/**
+ * @brief Возвращает количество отложенных, но еще не освобожденных узлов потока.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ebr_get_pending(void);
+
+/**
+ * @brief Отсоединяет поток от модуля перед его завершением.
+ *
+ * Освобождает то, что возможно, снимает указатели опасности и отдает
+ * запись потока для повторного использования. Вызывается вне
+ * критической секции.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ebr_thread_detach(void);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_EBR_H
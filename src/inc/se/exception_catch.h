@@ -14,6 +14,7 @@
  
  #include "exception.h"
  #include "jump_buffer.h"
+ #include "memory_arena.h"
  
  /**
   * @struct se_exception_catch
@@ -22,14 +23,26 @@
   * Позволяет сохранять состояние исключения и контекст выполнения
   * при использовании механизма обработки исключений через setjmp/longjmp.
   * Содержит как само исключение, так и среду выполнения для возврата.
+  *
+  * Фреймы живут в автоматической памяти try-блоков и связываются
+  * в стек потока через поле `prev`, поэтому глубина вложенности
+  * ограничена только стеком вызовов.
+  *
+  * Фрейм может быть привязан к арене памяти: в этом случае при переходе
+  * в него через `longjmp` арена откатывается к отметке `arena_mark`,
+  * и все блоки, выделенные внутри try-блока, освобождаются автоматически.
   * 
   * @see se_exception_t Для подробностей о структуре исключения
   * @see se_jump_buffer_t Для информации о сохранении контекста выполнения
+  * @see se_memory_arena_t Для информации об аренах памяти
   */
  typedef struct se_exception_catch
  {
-     se_exception_t   exception; /**< Перехваченное исключение, содержащее информацию об ошибке. */
-     se_jump_buffer_t env;       /**< Буфер для сохранения контекста выполнения в точке перехвата. */
+     se_exception_t             exception;  /**< Перехваченное исключение, содержащее информацию об ошибке. */
+     se_jump_buffer_t           env;        /**< Буфер для сохранения контекста выполнения в точке перехвата. */
+     se_memory_arena_t         *arena;      /**< Арена, откатываемая при переходе в фрейм (может быть nullptr). */
+     se_memory_arena_mark_t     arena_mark; /**< Отметка арены на момент входа в try-блок. */
+     struct se_exception_catch *prev;       /**< Внешний фрейм стека обработчиков (может быть nullptr). */
  } se_exception_catch_t;
  
  #endif // SE_EXCEPTION_CATCH_H
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * @file futex.h
+ * @brief Ожидание изменения 32-битного слова памяти.
+ *
+ * Модуль оборачивает механизм ядра «ждать, пока слово равно значению»:
+ * `futex` на Linux и `WaitOnAddress`/`WakeByAddress*` на Windows.
+ * На остальных платформах ожидание сводится к короткому сну с повторной
+ * проверкой слова.
+ *
+ * Функции предназначены для блокирующих примитивов библиотеки:
+ * поток сначала крутится в цикле ожидания и засыпает через
+ * `se_futex_wait` только если условие долго не выполняется.
+ *
+ * Пример использования:
+ * @code
+ * // Ожидающий поток
+ * while (atomic_load(&word) == 0)
+ * {
+ *     se_futex_wait(&word, 0);
+ * }
+ *
+ * // Пробуждающий поток
+ * atomic_store(&word, 1);
+ * se_futex_wake(&word, SE_FUTEX_WAKE_ALL);
+ * @endcode
+ *
+ * @note Пробуждения могут быть ложными: после возврата из `se_futex_wait`
+ *       условие всегда нужно проверять заново.
+ */
+
+#ifndef SE_FUTEX_H
+#define SE_FUTEX_H
+
+#include "numeric_fixed.h"
+#include "attribute.h"
+
+/**
+ * @def SE_FUTEX_WAKE_ALL
+ * @brief Количество потоков для `se_futex_wake`, означающее «все ожидающие».
+ */
+#define SE_FUTEX_WAKE_ALL SE_U32_T_MAX
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Усыпляет поток, пока 32-битное слово равно `expected`.
+ *
+ * Сравнение и засыпание выполняются атомарно относительно `se_futex_wake`,
+ * поэтому пробуждение после изменения слова не теряется.
+ *
+ * @param[in] address Адрес выровненного 32-битного слова (может быть атомарным).
+ * @param[in] expected Значение, при котором поток должен спать.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_futex_wait(const void *address, se_u32_t expected);
+
+/**
+ * @brief Будит потоки, ожидающие на слове.
+ *
+ * @param[in] address Адрес 32-битного слова.
+ * @param[in] count Количество потоков или `SE_FUTEX_WAKE_ALL`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_futex_wake(const void *address, se_u32_t count);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_FUTEX_H
@@ -0,0 +1,40 @@
+/**
+ * @file hash.h
+ * @brief Хеширование последовательностей байт.
+ *
+ * `se_hash_bytes` — быстрая некриптографическая хеш-функция для ключей
+ * хеш-таблиц. Блоки по 16 байт перемешиваются умножением 64×64→128 бит
+ * со сверткой старшей и младшей половин, короткие ключи (до 16 байт)
+ * обрабатываются без цикла несколькими перекрывающимися чтениями.
+ * Все биты результата зависят от всех байт входа, поэтому младшие и старшие
+ * биты хеша можно использовать независимо (см. hash_map.h).
+ *
+ * @warning Функция не устойчива к подбору коллизий и не должна
+ *          применяться к данным, которые контролирует атакующий,
+ *          если от этого зависит производительность.
+ * @see hash_map.h
+ */
+
+#ifndef SE_HASH_H
+#define SE_HASH_H
+
+#include "numeric_fixed_types.h"
+#include "attribute.h"
+#include "size.h"
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Вычисляет 64-битный хеш последовательности байт.
+ *
+ * @param[in] data Указатель на данные (может быть `nullptr`, если `size == 0`).
+ * @param[in] size Размер данных в байтах.
+ * @return Хеш данных.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_u64_t
+se_hash_bytes(const void *data, se_usize_t size);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_HASH_H
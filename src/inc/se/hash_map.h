@@ -0,0 +1,208 @@
+/**
+ * @file hash_map.h
+ * @brief Хеш-таблица с открытой адресацией и векторным поиском.
+ *
+ * Таблица устроена по схеме Swiss table: ключи и значения лежат в плоском
+ * массиве слотов, а каждому слоту соответствует управляющий байт — пустой,
+ * удаленный или занятый с 7-битной меткой из младших бит хеша. Поиск
+ * сравнивает метку сразу с группой управляющих байт (32 с AVX2, 16 с SSE2,
+ * 8 без векторных инструкций) и проверяет ключи только у совпавших слотов;
+ * первая группа с пустым слотом завершает поиск. Группы перебираются
+ * с треугольным шагом.
+ *
+ * Удаление не оставляет надгробия, если ни один поиск не мог пройти
+ * через слот дальше (вокруг него есть пустой слот в пределах группы),
+ * поэтому таблица с чередующимися вставками и удалениями не деградирует.
+ * Таблица удваивается при заполнении на 7/8; если емкость занята в основном
+ * надгробиями, слоты перехешируются без роста.
+ *
+ * Ключи и значения имеют фиксированные размеры, заданные при инициализации,
+ * и копируются побайтно. По умолчанию ключи хешируются `se_hash_bytes`
+ * и сравниваются побайтно.
+ *
+ * Пример использования:
+ * @code
+ * se_hash_map_t map;
+ * se_hash_map_init(&map, sizeof(int), sizeof(double), nullptr, nullptr, nullptr);
+ * const int    key   = 7;
+ * const double value = 1.5;
+ * se_hash_map_insert(&map, &key, &value);
+ * const double *found = se_hash_map_find(&map, &key);
+ * se_hash_map_deinit(&map);
+ * @endcode
+ *
+ * @note Таблица не потокобезопасна. Указатели на значения становятся
+ *       недействительными после вставки, которая меняет емкость.
+ * @see hash.h
+ * @see memory_allocator.h
+ */
+
+#ifndef SE_HASH_MAP_H
+#define SE_HASH_MAP_H
+
+#include "hash_map_hash_fn.h"
+#include "hash_map_equal_fn.h"
+#include "memory_allocator.h"
+#include "attribute.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @struct se_hash_map
+ * @brief Хеш-таблица.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct se_hash_map
+{
+    se_u8_t                     *ctrl;         /**< Управляющие байты (емкость + ширина группы) или `nullptr`. */
+    void                        *slots;        /**< Массив слотов «ключ, значение». */
+    se_usize_t                   key_size;     /**< Размер ключа в байтах. */
+    se_usize_t                   value_size;   /**< Размер значения в байтах. */
+    se_usize_t                   value_offset; /**< Смещение значения внутри слота. */
+    se_usize_t                   slot_size;    /**< Размер слота в байтах. */
+    se_usize_t                   size;         /**< Количество элементов. */
+    se_usize_t                   capacity;     /**< Количество слотов (степень двойки или 0). */
+    se_usize_t                   growth_left;  /**< Сколько элементов можно вставить до перехеширования. */
+    se_hash_map_hash_fn         *hash;         /**< Хеш-функция или `nullptr` для `se_hash_bytes`. */
+    se_hash_map_equal_fn        *equal;        /**< Сравнение ключей или `nullptr` для побайтового. */
+    const se_memory_allocator_t *allocator;    /**< Аллокатор или `nullptr` для аллокатора времени выполнения. */
+} se_hash_map_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустую таблицу без выделения памяти.
+ *
+ * @param[out] self Указатель на таблицу.
+ * @param[in] key_size Размер ключа в байтах (больше нуля).
+ * @param[in] value_size Размер значения в байтах (0 для множества).
+ * @param[in] hash Хеш-функция или `nullptr` для `se_hash_bytes`.
+ * @param[in] equal Сравнение ключей или `nullptr` для побайтового.
+ * @param[in] allocator Аллокатор или `nullptr` для аллокатора времени
+ *                      выполнения. Структура должна существовать,
+ *                      пока существует таблица.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_hash_map_init(se_hash_map_t               *self,
+                 se_usize_t                   key_size,
+                 se_usize_t                   value_size,
+                 se_hash_map_hash_fn         *hash,
+                 se_hash_map_equal_fn        *equal,
+                 const se_memory_allocator_t *allocator);
+
+/**
+ * @brief Освобождает память таблицы.
+ * @param[in,out] self Указатель на таблицу (после вызова пуста).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_hash_map_deinit(se_hash_map_t *self);
+
+/**
+ * @brief Гарантирует, что `count` элементов поместятся без перехеширования.
+ *
+ * @param[in,out] self Указатель на таблицу.
+ * @param[in] count Ожидаемое количество элементов.
+ *
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_hash_map_reserve(se_hash_map_t *self, se_usize_t count);
+
+/**
+ * @brief Находит значение по ключу или добавляет ключ.
+ *
+ * Если ключа нет, он копируется в таблицу, а значение остается
+ * неинициализированным и должно быть записано вызывающей стороной.
+ *
+ * @param[in,out] self Указатель на таблицу.
+ * @param[in] key Указатель на ключ.
+ * @param[out] value Указатель на значение ключа в таблице или `nullptr`.
+ * @return `true`, если ключ был добавлен.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_hash_map_emplace(se_hash_map_t *self, const void *key, void **value);
+
+/**
+ * @brief Вставляет или заменяет значение ключа.
+ *
+ * @param[in,out] self Указатель на таблицу.
+ * @param[in] key Указатель на ключ.
+ * @param[in] value Указатель на значение (может быть `nullptr`, если размер значения равен 0).
+ * @return Указатель на значение в таблице.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_hash_map_insert(se_hash_map_t *self, const void *key, const void *value);
+
+/**
+ * @brief Ищет значение по ключу.
+ *
+ * @param[in] self Указатель на таблицу.
+ * @param[in] key Указатель на ключ.
+ * @return Указатель на значение или `nullptr`, если ключа нет.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_hash_map_find(const se_hash_map_t *self, const void *key);
+
+/**
+ * @brief Удаляет ключ.
+ *
+ * @param[in,out] self Указатель на таблицу.
+ * @param[in] key Указатель на ключ.
+ * @return `true`, если ключ был найден и удален.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_hash_map_erase(se_hash_map_t *self, const void *key);
+
+/**
+ * @brief Удаляет все элементы, сохраняя емкость.
+ * @param[in,out] self Указатель на таблицу.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_hash_map_clear(se_hash_map_t *self);
+
+/**
+ * @brief Перебирает элементы таблицы.
+ *
+ * @param[in] self Указатель на таблицу.
+ * @param[in,out] cursor Позиция перебора; перед первым вызовом равна 0.
+ * @param[out] key Указатель на ключ очередного элемента или `nullptr`.
+ * @param[out] value Указатель на значение очередного элемента или `nullptr`.
+ * @return `false`, если элементы закончились.
+ *
+ * @note Порядок перебора не определен. Таблицу нельзя менять во время
+ *       перебора, кроме удаления текущего элемента.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_hash_map_next(const se_hash_map_t *self, se_usize_t *cursor, const void **key, void **value);
+
+/**
+ * @brief Возвращает количество элементов.
+ * @param[in] self Указатель на таблицу.
+ * @return Количество элементов.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_hash_map_get_size(const se_hash_map_t *self);
+
+/**
+ * @brief Возвращает количество слотов.
+ * @param[in] self Указатель на таблицу.
+ * @return Количество слотов (элементов помещается не больше 7/8 от него).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_hash_map_get_capacity(const se_hash_map_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_HASH_MAP_H
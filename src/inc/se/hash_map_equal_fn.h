@@ -0,0 +1,31 @@
+/**
+ * @file hash_map_equal_fn.h
+ * @brief Заголовочный файл для определения типа функции сравнения ключей.
+ *
+ * Функция нужна, если равенство ключей не совпадает с побайтовым,
+ * например когда ключ хранит указатель на строку.
+ *
+ * @note Функция возвращает `int`, а не `bool`: в C `bool` библиотеки —
+ *       перечисление, и его размер не совпадает с `bool` в C++, где
+ *       функция сравнения тоже может быть написана.
+ *
+ * @see se_hash_map_hash_fn
+ */
+
+#ifndef SE_HASH_MAP_EQUAL_FN_H
+#define SE_HASH_MAP_EQUAL_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef se_hash_map_equal_fn
+ * @brief Тип функции сравнения ключей.
+ *
+ * @param lhs Указатель на первый ключ.
+ * @param rhs Указатель на второй ключ.
+ * @param size Размер ключа в байтах.
+ * @return Ненулевое значение, если ключи равны.
+ */
+typedef int(se_hash_map_equal_fn)(const void *lhs, const void *rhs, se_usize_t size);
+
+#endif // SE_HASH_MAP_EQUAL_FN_H
@@ -0,0 +1,28 @@
+/**
+ * @file hash_map_hash_fn.h
+ * @brief Заголовочный файл для определения типа хеш-функции ключей.
+ *
+ * Хеш-таблица использует младшие 7 бит хеша как метку слота в управляющем
+ * байте, а остальные биты — как позицию начала поиска, поэтому функция
+ * должна перемешивать все биты результата.
+ *
+ * @see se_hash_bytes
+ */
+
+#ifndef SE_HASH_MAP_HASH_FN_H
+#define SE_HASH_MAP_HASH_FN_H
+
+#include "numeric_fixed_types.h"
+#include "size.h"
+
+/**
+ * @typedef se_hash_map_hash_fn
+ * @brief Тип функции хеширования ключа.
+ *
+ * @param key Указатель на ключ.
+ * @param size Размер ключа в байтах.
+ * @return Хеш ключа. Равные ключи должны иметь равные хеши.
+ */
+typedef se_u64_t(se_hash_map_hash_fn)(const void *key, se_usize_t size);
+
+#endif // SE_HASH_MAP_HASH_FN_H
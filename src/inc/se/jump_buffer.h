@@ -3,16 +3,103 @@
  * @brief Определение типа данных
  *        для использования буфера возврата в setjmp/longjmp.
  *
- * Этот файл содержит определение типа `se_jump_buffer_t`,
- * который является псевдонимом для стандартного типа `jmp_buf`,
- * используемого для сохранения состояния программы при работе
- * с функциями setjmp и longjmp.
+ * Этот файл содержит определение типа `se_jump_buffer_t` и макросов
+ * `se_jump_buffer_save` / `se_jump_buffer_restore`, которыми механизм
+ * исключений сохраняет и восстанавливает состояние программы.
+ *
+ * По умолчанию это стандартные `jmp_buf`, `setjmp` и `longjmp`.
+ * С опцией `SE_LIBRARY_OPTION_JUMP_BUFFER_ASM` на x86-64 и AArch64 (ELF)
+ * используется собственное сохранение одних лишь регистров, которые
+ * вызываемая функция обязана сохранить по соглашению о вызовах:
+ * - x86-64: `rbx`, `rbp`, `r12`–`r15`, `rsp` и адрес возврата;
+ * - AArch64: `x19`–`x30`, `sp` и `d8`–`d15`.
+ *
+ * Маска сигналов, теневой стек и прочее состояние, которое может
+ * сохранять реализация libc, не затрагиваются. Переход через буфер
+ * не должен пересекать обработчик сигнала, а процесс не должен
+ * включать аппаратный теневой стек (Intel CET SHSTK).
+ *
+ * @note Опция задается при сборке библиотеки и передается ее пользователям:
+ *       `se_runtime_try` сохраняет контекст в коде вызывающей стороны,
+ *       а переход выполняется и внутри библиотеки, поэтому обе стороны
+ *       обязаны использовать одну реализацию.
  */
 
 #ifndef SE_JUMP_BUFFER_H
 #define SE_JUMP_BUFFER_H
 
-#include <setjmp.h>
+#include "attribute.h"
+
+#if defined(SE_LIBRARY_OPTION_JUMP_BUFFER_ASM) && defined(__ELF__) &&                              \
+    (defined(__x86_64__) || defined(__aarch64__))
+
+/**
+ * @def SE_JUMP_BUFFER_ASM
+ * @brief Определен, если используется собственное сохранение регистров.
+ */
+#    define SE_JUMP_BUFFER_ASM
+
+/**
+ * @def SE_JUMP_BUFFER_SIZE
+ * @brief Количество слов в буфере возврата.
+ */
+#    if defined(__x86_64__)
+#        define SE_JUMP_BUFFER_SIZE 8
+#    else
+#        define SE_JUMP_BUFFER_SIZE 22
+#    endif
+
+/**
+ * @typedef se_jump_buffer_t
+ * @brief Тип, используемый для хранения состояния выполнения программы.
+ *
+ * Массив, как и `jmp_buf`: при передаче в функцию он приводится к указателю.
+ */
+typedef void *se_jump_buffer_t[SE_JUMP_BUFFER_SIZE];
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Сохраняет регистры вызывающей функции в буфер.
+ *
+ * @param[out] env Буфер возврата.
+ * @return 0 - при сохранении контекста.
+ * @return Ненулевое значение - при возврате из `se_jump_buffer_restore_asm()`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+SE_ATTRIBUTE(RETURNS_TWICE)
+int
+se_jump_buffer_save_asm(se_jump_buffer_t env);
+
+/**
+ * @brief Восстанавливает регистры из буфера и возвращается
+ *        из соответствующего `se_jump_buffer_save_asm()`.
+ *
+ * @param[in] env Буфер возврата, функция-владелец которого еще не завершилась.
+ * @param[in] value Значение, возвращаемое из `se_jump_buffer_save_asm()` (0 заменяется на 1).
+ */
+SE_ATTRIBUTE(SYMBOL)
+SE_ATTRIBUTE(NORETURN)
+void
+se_jump_buffer_restore_asm(se_jump_buffer_t env, int value);
+
+SE_COMPILER(EXTERN_C_END)
+
+/**
+ * @def se_jump_buffer_save
+ * @brief Сохраняет контекст выполнения (аналог `setjmp`).
+ */
+#    define se_jump_buffer_save(env) se_jump_buffer_save_asm(env)
+
+/**
+ * @def se_jump_buffer_restore
+ * @brief Восстанавливает контекст выполнения (аналог `longjmp`).
+ */
+#    define se_jump_buffer_restore(env, value) se_jump_buffer_restore_asm(env, value)
+
+#else
+
+#    include <setjmp.h>
 
 /**
  * @typedef se_jump_buffer_t
@@ -24,4 +111,18 @@
  */
 typedef jmp_buf se_jump_buffer_t;
 
+/**
+ * @def se_jump_buffer_save
+ * @brief Сохраняет контекст выполнения через `setjmp`.
+ */
+#    define se_jump_buffer_save(env) setjmp(env)
+
+/**
+ * @def se_jump_buffer_restore
+ * @brief Восстанавливает контекст выполнения через `longjmp`.
+ */
+#    define se_jump_buffer_restore(env, value) longjmp(env, value)
+
+#endif
+
 #endif // SE_JUMP_BUFFER_H
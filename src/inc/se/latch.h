@@ -0,0 +1,118 @@
+/**
+ * @file latch.h
+ * @brief Одноразовый счетчик-защелка.
+ *
+ * Защелка создается со счетчиком; потоки уменьшают его, а ожидающие
+ * потоки продолжают работу, когда счетчик дойдет до нуля. После этого
+ * защелка остается открытой навсегда.
+ *
+ * Счетчик и флаг «есть спящие» хранятся в одном 32-битном слове.
+ * Ожидающий поток сначала крутится `SE_LATCH_SPIN_COUNT` итераций,
+ * затем устанавливает флаг и засыпает на futex (см. futex.h).
+ * Последнее уменьшение делает системный вызов, только если флаг
+ * установлен.
+ *
+ * Пример использования:
+ * @code
+ * se_latch_t done;
+ * se_latch_init(&done, worker_count, nullptr);
+ *
+ * // Каждый рабочий поток по завершении
+ * se_latch_count_down(&done, 1);
+ *
+ * // Главный поток
+ * se_latch_wait(&done);
+ * @endcode
+ *
+ * @see lock_stats.h
+ */
+
+#ifndef SE_LATCH_H
+#define SE_LATCH_H
+
+#include "lock_stats.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "bool.h"
+
+/**
+ * @def SE_LATCH_SPIN_COUNT
+ * @brief Количество проверок с паузой перед засыпанием.
+ */
+#define SE_LATCH_SPIN_COUNT 128
+
+/**
+ * @def SE_LATCH_MAX_COUNT
+ * @brief Наибольшее начальное значение счетчика.
+ */
+#define SE_LATCH_MAX_COUNT 0x7FFFFFFFu
+
+/**
+ * @struct se_latch
+ * @brief Защелка.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_latch
+{
+    se_atomic_u32_t  state; /**< Счетчик в младших 31 бите и флаг «есть спящие» в старшем. */
+    se_lock_stats_t *stats; /**< Счетчики конкуренции или `nullptr`. */
+} se_latch_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает защелку.
+ *
+ * @param[out] self Указатель на защелку.
+ * @param[in] count Начальное значение счетчика (не больше `SE_LATCH_MAX_COUNT`).
+ * @param[in] stats Счетчики конкуренции или `nullptr`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_latch_init(se_latch_t *self, se_u32_t count, se_lock_stats_t *stats);
+
+/**
+ * @brief Уменьшает счетчик и будит ожидающих, если он дошел до нуля.
+ *
+ * Изменения памяти до вызова видны потокам, дождавшимся защелки.
+ *
+ * @param[in] self Указатель на защелку.
+ * @param[in] count На сколько уменьшить (не больше текущего значения).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_latch_count_down(se_latch_t *self, se_u32_t count);
+
+/**
+ * @brief Проверяет, открыта ли защелка.
+ *
+ * @param[in] self Указатель на защелку.
+ * @return `true`, если счетчик равен нулю.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_latch_try_wait(const se_latch_t *self);
+
+/**
+ * @brief Ожидает, пока счетчик не дойдет до нуля.
+ * @param[in] self Указатель на защелку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_latch_wait(se_latch_t *self);
+
+/**
+ * @brief Уменьшает счетчик и ожидает, пока он не дойдет до нуля.
+ *
+ * @param[in] self Указатель на защелку.
+ * @param[in] count На сколько уменьшить (не больше текущего значения).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_latch_arrive_and_wait(se_latch_t *self, se_u32_t count);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_LATCH_H
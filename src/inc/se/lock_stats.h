@@ -0,0 +1,43 @@
+/**
+ * @file lock_stats.h
+ * @brief Счетчики конкуренции примитивов синхронизации.
+ *
+ * Блокировки (mutex.h, mcs_lock.h, rwlock.h) и точки встречи (latch.h,
+ * barrier.h) принимают при создании необязательный указатель на набор
+ * счетчиков. Счетчики обновляются только на медленном пути — когда
+ * захват не удался с первой попытки или поток вынужден ждать, — поэтому
+ * захват без конкуренции их не трогает, а без счетчиков медленный путь
+ * стоит одной лишней проверки указателя.
+ *
+ * Один набор может обслуживать несколько примитивов: счетчики
+ * увеличиваются атомарно. Читать их следует через `se_atomic_u64_load`.
+ *
+ * Пример использования:
+ * @code
+ * se_lock_stats_t stats = {0};
+ * se_mutex_t      mutex;
+ * se_mutex_init(&mutex, &stats);
+ *
+ * // ...
+ *
+ * se_u64_t waits = se_atomic_u64_load(&stats.wait_count, SE_ATOMIC_ORDER_RELAXED);
+ * @endcode
+ */
+
+#ifndef SE_LOCK_STATS_H
+#define SE_LOCK_STATS_H
+
+#include "atomic_type.h"
+
+/**
+ * @struct se_lock_stats
+ * @brief Счетчики конкуренции.
+ */
+typedef struct se_lock_stats
+{
+    se_atomic_u64_t contended_count; /**< Захваты и ожидания, не завершившиеся с первой попытки. */
+    se_atomic_u64_t spin_count;      /**< Итерации ожидания с паузой процессора. */
+    se_atomic_u64_t wait_count;      /**< Засыпания на futex. */
+} se_lock_stats_t;
+
+#endif // SE_LOCK_STATS_H
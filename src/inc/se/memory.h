@@ -18,12 +18,17 @@
  * @see se_memory_compare
  * @see se_memory_find
  * @see se_memory_set
+ *
+ * Функции с суффиксом `_r` повторяют одноименные функции, но вместо
+ * исключения записывают код ошибки в `error` (если он не nullptr)
+ * и возвращают nullptr. При успехе `error` не изменяется.
  */
 
 #ifndef SE_MEMORY_H
 #define SE_MEMORY_H
 
 #include "size.h"
+#include "error.h"
 #include "attribute.h"
 
 SE_COMPILER(EXTERN_C_BEGIN)
@@ -175,6 +180,55 @@ SE_ATTRIBUTE(SYMBOL)
 void *
 se_memory_set(void *dst, se_usize_t len, se_u8_t val);
 
+/**
+ * @brief Вариант `se_memory_copy` с кодом ошибки.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return Результат `se_memory_copy` или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_copy_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_copy_rev` с кодом ошибки.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return Результат `se_memory_copy_rev` или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_copy_rev_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_move` с кодом ошибки.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return Результат `se_memory_move` или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_move_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_compare` с кодом ошибки.
+ *
+ * Результат nullptr означает и равенство блоков, и ошибку; их различает
+ * код в `error`.
+ *
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return Результат `se_memory_compare` или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_compare_r(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_set` с кодом ошибки.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return Результат `se_memory_set` или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_set_r(void *dst, se_usize_t len, se_u8_t val, se_error_t *error);
+
 SE_COMPILER(EXTERN_C_END)
 
 #endif // SE_MEMORY_H
\ No newline at end of file
@@ -0,0 +1,41 @@
+/**
+ * @file memory_allocator.h
+ * @brief Заголовочный файл, описывающий интерфейс аллокатора памяти.
+ *
+ * Аллокатор объединяет пару функций выделения и освобождения памяти.
+ * Структуры данных библиотеки получают память через аллокатор,
+ * что позволяет подменять источник памяти (stdlib, пулы, арены и т.д.)
+ * без изменения их кода.
+ *
+ * @see se_memory_allocator_alloc_fn
+ * @see se_memory_allocator_alloc_aligned_fn
+ * @see se_memory_allocator_alloc_zeroed_fn
+ * @see se_memory_allocator_dealloc_fn
+ * @see runtime_allocator.h
+ */
+
+#ifndef SE_MEMORY_ALLOCATOR_H
+#define SE_MEMORY_ALLOCATOR_H
+
+#include "memory_allocator_alloc_fn.h"
+#include "memory_allocator_alloc_aligned_fn.h"
+#include "memory_allocator_alloc_zeroed_fn.h"
+#include "memory_allocator_dealloc_fn.h"
+
+/**
+ * @struct se_memory_allocator
+ * @brief Функции выделения и освобождения памяти.
+ *
+ * Поля `alloc_aligned` и `alloc_zeroed` необязательны: аллокатор без
+ * `alloc_aligned` обслуживает только выравнивание, которое дает `alloc`,
+ * а без `alloc_zeroed` обнуление выполняется вызывающей стороной.
+ */
+typedef struct se_memory_allocator
+{
+    se_memory_allocator_alloc_fn         *alloc;         /**< Функция выделения памяти. */
+    se_memory_allocator_dealloc_fn       *dealloc;       /**< Функция освобождения памяти. */
+    se_memory_allocator_alloc_aligned_fn *alloc_aligned; /**< Функция выделения выровненной памяти (может быть `nullptr`). */
+    se_memory_allocator_alloc_zeroed_fn  *alloc_zeroed;  /**< Функция выделения обнуленной памяти (может быть `nullptr`). */
+} se_memory_allocator_t;
+
+#endif // SE_MEMORY_ALLOCATOR_H
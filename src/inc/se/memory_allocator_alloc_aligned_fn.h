@@ -0,0 +1,29 @@
+/**
+ * @file memory_allocator_alloc_aligned_fn.h
+ * @brief Заголовочный файл для определения типа функции выделения выровненной памяти.
+ *
+ * Этот файл содержит определение типа функции, которая используется для
+ * выделения памяти определенного размера с заданным выравниванием начала блока.
+ *
+ * @note Блок, выделенный такой функцией, освобождается функцией освобождения
+ *       того же аллокатора, что и обычный блок.
+ */
+
+#ifndef SE_MEMORY_ALLOCATOR_ALLOC_ALIGNED_FN_H
+#define SE_MEMORY_ALLOCATOR_ALLOC_ALIGNED_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef se_memory_allocator_alloc_aligned_fn
+ * @brief Тип функции для выделения выровненной памяти.
+ * @details Эта функция используется для выделения памяти заданного размера,
+ *          начало которой кратно `alignment`.
+ *
+ * @param size_of_bytes Размер памяти в байтах, который необходимо выделить.
+ * @param alignment Выравнивание начала блока (степень двойки).
+ * @return Указатель на выделенную память или NULL в случае ошибки.
+ */
+typedef void *(se_memory_allocator_alloc_aligned_fn)(se_usize_t size_of_bytes, se_usize_t alignment);
+
+#endif // SE_MEMORY_ALLOCATOR_ALLOC_ALIGNED_FN_H
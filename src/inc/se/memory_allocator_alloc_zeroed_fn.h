@@ -0,0 +1,35 @@
+/**
+ * @file memory_allocator_alloc_zeroed_fn.h
+ * @brief Заголовочный файл для определения типа функции выделения обнуленной памяти.
+ *
+ * Этот файл содержит определение типа функции, которая выделяет память,
+ * гарантированно заполненную нулями. Аллокатор, знающий происхождение блока
+ * (например, свежие страницы от операционной системы уже обнулены),
+ * пропускает повторное обнуление.
+ *
+ * @note Блок, выделенный такой функцией, освобождается функцией освобождения
+ *       того же аллокатора, что и обычный блок.
+ */
+
+#ifndef SE_MEMORY_ALLOCATOR_ALLOC_ZEROED_FN_H
+#define SE_MEMORY_ALLOCATOR_ALLOC_ZEROED_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef se_memory_allocator_alloc_zeroed_fn
+ * @brief Тип функции для выделения обнуленной памяти.
+ * @details Эта функция используется для выделения памяти заданного размера,
+ *          заполненной нулями.
+ *
+ * @param size_of_bytes Размер памяти в байтах, который необходимо выделить.
+ * @param alignment Выравнивание начала блока (степень двойки)
+ *                  или 0 для выравнивания функции `alloc`.
+ * @return Указатель на выделенную память или NULL в случае ошибки.
+ *
+ * @note Функция должна поддерживать те же выравнивания,
+ *       что и функции `alloc`/`alloc_aligned` того же аллокатора.
+ */
+typedef void *(se_memory_allocator_alloc_zeroed_fn)(se_usize_t size_of_bytes, se_usize_t alignment);
+
+#endif // SE_MEMORY_ALLOCATOR_ALLOC_ZEROED_FN_H
@@ -0,0 +1,147 @@
+/**
+ * @file memory_arena.h
+ * @brief Линейный (bump) аллокатор поверх заранее выделенного буфера.
+ *
+ * Арена выделяет память последовательным сдвигом указателя внутри буфера,
+ * предоставленного вызывающей стороной. Освобождение отдельных блоков
+ * не поддерживается: вместо этого запоминается отметка (`se_memory_arena_mark_t`)
+ * и арена откатывается к ней одним присваиванием.
+ *
+ * Отметка арены может быть привязана к фрейму `se_exception_catch_t`
+ * (см. `se_runtime_try_with_arena`), и тогда при переходе `longjmp`
+ * в этот фрейм арена автоматически откатывается к состоянию на момент входа
+ * в try-блок. Это дает исключение-безопасное выделение временной памяти
+ * без вызовов malloc/free на горячем пути.
+ *
+ * @see se_runtime_try_with_arena
+ */
+
+#ifndef SE_MEMORY_ARENA_H
+#define SE_MEMORY_ARENA_H
+
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def SE_MEMORY_ARENA_ALIGNMENT
+ * @brief Выравнивание блоков, выделяемых через `se_memory_arena_alloc`.
+ *
+ * Значение достаточно для хранения любых скалярных типов
+ * на поддерживаемых платформах.
+ */
+#define SE_MEMORY_ARENA_ALIGNMENT (2 * sizeof(void *))
+
+/**
+ * @typedef se_memory_arena_mark_t
+ * @brief Отметка состояния арены.
+ *
+ * Хранит позицию указателя выделения на момент получения отметки.
+ * Используется для отката арены через `se_memory_arena_rewind`.
+ */
+typedef void *se_memory_arena_mark_t;
+
+/**
+ * @struct se_memory_arena
+ * @brief Линейная арена памяти.
+ *
+ * Описывает буфер `[begin, end)` и текущую позицию выделения `cur`.
+ * Все блоки между `begin` и `cur` считаются занятыми.
+ */
+typedef struct se_memory_arena
+{
+    void *begin; /**< Начало буфера арены. */
+    void *end;   /**< Конец буфера арены (байт за последним). */
+    void *cur;   /**< Текущая позиция выделения. */
+} se_memory_arena_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует арену поверх переданного буфера.
+ * @param[out] self Указатель на арену.
+ * @param[in] buffer Буфер, которым будет управлять арена.
+ * @param[in] size Размер буфера в байтах.
+ * @note Проверяет self и buffer на nullptr.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_arena_init(se_memory_arena_t *self, void *buffer, se_usize_t size);
+
+/**
+ * @brief Выделяет блок памяти с выравниванием `SE_MEMORY_ARENA_ALIGNMENT`.
+ * @param[in,out] self Указатель на арену.
+ * @param[in] size Размер блока в байтах.
+ * @return Указатель на выделенный блок.
+ * @note При нехватке места выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ * @note При включенной опции `SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`
+ *       блок заполняется нулями.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_arena_alloc(se_memory_arena_t *self, se_usize_t size);
+
+/**
+ * @brief Выделяет блок памяти с заданным выравниванием.
+ * @param[in,out] self Указатель на арену.
+ * @param[in] size Размер блока в байтах.
+ * @param[in] alignment Выравнивание (степень двойки).
+ * @return Указатель на выделенный блок.
+ * @note Проверяет alignment на степень двойки (`SE_RUNTIME_ERROR_INVALID_ARGUMENT`).
+ * @note При нехватке места выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_arena_alloc_aligned(se_memory_arena_t *self, se_usize_t size, se_usize_t alignment);
+
+/**
+ * @brief Возвращает текущую отметку арены.
+ * @param[in] self Указатель на арену.
+ * @return Отметка, к которой можно откатить арену.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_arena_mark_t
+se_memory_arena_get_mark(const se_memory_arena_t *self);
+
+/**
+ * @brief Откатывает арену к ранее полученной отметке.
+ *
+ * Все блоки, выделенные после получения отметки, становятся недействительными.
+ *
+ * @param[in,out] self Указатель на арену.
+ * @param[in] mark Отметка, полученная через `se_memory_arena_get_mark`.
+ * @note Проверяет, что отметка лежит в `[begin, cur]`
+ *       (`SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_arena_rewind(se_memory_arena_t *self, se_memory_arena_mark_t mark);
+
+/**
+ * @brief Освобождает все блоки арены.
+ * @param[in,out] self Указатель на арену.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_arena_reset(se_memory_arena_t *self);
+
+/**
+ * @brief Возвращает количество занятых байт.
+ * @param[in] self Указатель на арену.
+ * @return Размер `[begin, cur)` в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_arena_get_used(const se_memory_arena_t *self);
+
+/**
+ * @brief Возвращает количество свободных байт.
+ * @param[in] self Указатель на арену.
+ * @return Размер `[cur, end)` в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_arena_get_available(const se_memory_arena_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_ARENA_H
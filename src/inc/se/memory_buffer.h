@@ -0,0 +1,181 @@
+/**
+ * @file memory_buffer.h
+ * @brief Растущий байтовый буфер.
+ *
+ * Буфер хранит непрерывную последовательность байт и увеличивает емкость
+ * при добавлении данных. Емкость растет геометрически с коэффициентом
+ * `SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000` (см. compile_definitions.cmake),
+ * поэтому добавление выполняется за амортизированное O(1).
+ *
+ * Пока емкость меньше `SE_MEMORY_BUFFER_PAGED_THRESHOLD`, память берется
+ * у аллокатора времени выполнения. Начиная с порога буфер переходит
+ * на страницы операционной системы (см. memory_page.h) и растет через
+ * `se_memory_page_realloc`: на Linux это `mremap`, который переносит
+ * страницы без копирования содержимого.
+ *
+ * Пример использования:
+ * @code
+ * se_memory_buffer_t buffer;
+ * se_memory_buffer_init(&buffer);
+ * se_memory_buffer_append(&buffer, "abc", 3);
+ * const se_memory_view_t view = se_memory_buffer_get_view(&buffer);
+ * se_memory_buffer_deinit(&buffer);
+ * @endcode
+ *
+ * @note Буфер не потокобезопасен. Указатели на содержимое становятся
+ *       недействительными после любой операции, меняющей емкость.
+ * @see memory_view.h
+ */
+
+#ifndef SE_MEMORY_BUFFER_H
+#define SE_MEMORY_BUFFER_H
+
+#include "memory_view.h"
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def SE_MEMORY_BUFFER_MIN_CAPACITY
+ * @brief Емкость, выделяемая при первом добавлении данных.
+ */
+#define SE_MEMORY_BUFFER_MIN_CAPACITY 64
+
+/**
+ * @def SE_MEMORY_BUFFER_PAGED_THRESHOLD
+ * @brief Емкость, начиная с которой буфер хранится в страницах операционной системы.
+ *
+ * Емкость страничного буфера кратна размеру страницы.
+ */
+#define SE_MEMORY_BUFFER_PAGED_THRESHOLD (256 * 1024)
+
+/**
+ * @struct se_memory_buffer
+ * @brief Растущий байтовый буфер.
+ */
+typedef struct se_memory_buffer
+{
+    void      *data;     /**< Начало хранилища или `nullptr`, если память не выделена. */
+    se_usize_t size;     /**< Количество занятых байт. */
+    se_usize_t capacity; /**< Размер хранилища в байтах. */
+} se_memory_buffer_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустой буфер без выделения памяти.
+ * @param[out] self Указатель на буфер.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_init(se_memory_buffer_t *self);
+
+/**
+ * @brief Освобождает память буфера.
+ * @param[in,out] self Указатель на буфер.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_deinit(se_memory_buffer_t *self);
+
+/**
+ * @brief Гарантирует емкость не меньше заданной.
+ *
+ * @param[in,out] self Указатель на буфер.
+ * @param[in] capacity Требуемая емкость в байтах.
+ *
+ * @note Емкость увеличивается ровно до запрошенной (с округлением
+ *       до страницы для страничного буфера), коэффициент роста не применяется.
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_reserve(se_memory_buffer_t *self, se_usize_t capacity);
+
+/**
+ * @brief Добавляет данные в конец буфера.
+ *
+ * @param[in,out] self Указатель на буфер.
+ * @param[in] data Добавляемые данные (может быть `nullptr`, если `size == 0`).
+ * @param[in] size Размер данных в байтах.
+ *
+ * @note `data` не должен указывать внутрь самого буфера.
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_append(se_memory_buffer_t *self, const void *data, se_usize_t size);
+
+/**
+ * @brief Резервирует место в конце буфера и возвращает указатель на него.
+ *
+ * Позволяет записывать данные прямо в буфер без промежуточной копии.
+ *
+ * @param[in,out] self Указатель на буфер.
+ * @param[in] size Количество добавляемых байт.
+ * @return Указатель на первый добавленный байт (содержимое не инициализировано).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_buffer_extend(se_memory_buffer_t *self, se_usize_t size);
+
+/**
+ * @brief Уменьшает емкость до текущего размера.
+ *
+ * Страничный буфер, размер которого опустился ниже
+ * `SE_MEMORY_BUFFER_PAGED_THRESHOLD`, переносится обратно
+ * в память аллокатора времени выполнения.
+ *
+ * @param[in,out] self Указатель на буфер.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_shrink_to_fit(se_memory_buffer_t *self);
+
+/**
+ * @brief Удаляет все данные, сохраняя емкость.
+ * @param[in,out] self Указатель на буфер.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_buffer_clear(se_memory_buffer_t *self);
+
+/**
+ * @brief Возвращает количество занятых байт.
+ * @param[in] self Указатель на буфер.
+ * @return Размер в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_buffer_get_size(const se_memory_buffer_t *self);
+
+/**
+ * @brief Возвращает емкость буфера.
+ * @param[in] self Указатель на буфер.
+ * @return Емкость в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_buffer_get_capacity(const se_memory_buffer_t *self);
+
+/**
+ * @brief Возвращает указатель на содержимое буфера.
+ * @param[in] self Указатель на буфер.
+ * @return Начало данных или `nullptr`, если память не выделена.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_buffer_get_data(const se_memory_buffer_t *self);
+
+/**
+ * @brief Возвращает представление занятой части буфера.
+ * @param[in] self Указатель на буфер.
+ * @return Область `[data, data + size)`; для буфера без памяти — пустая
+ *         область с ненулевыми границами.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_view_t
+se_memory_buffer_get_view(const se_memory_buffer_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_BUFFER_H
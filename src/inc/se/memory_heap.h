@@ -0,0 +1,215 @@
+/**
+ * @file memory_heap.h
+ * @brief Многопоточный аллокатор общего назначения с классами размеров.
+ *
+ * Запросы до `SE_MEMORY_HEAP_SMALL_MAX` байт округляются до одного
+ * из `SE_MEMORY_HEAP_CLASS_COUNT` классов размеров. Объекты одного класса
+ * нарезаются из спанов — блоков размера `SE_MEMORY_HEAP_SPAN_SIZE`,
+ * выровненных по собственному размеру и полученных напрямую у операционной
+ * системы (см. memory_page.h). Заголовок спана хранит класс размера, поэтому
+ * освобождение находит его маскированием указателя без поиска.
+ *
+ * Каждый поток держит для каждого класса собственный магазин свободных
+ * объектов (`SE_ATTRIBUTE(THREAD_LOCAL)`), поэтому выделение и освобождение
+ * в общем случае не требуют синхронизации. Переполненный магазин сбрасывает
+ * пачку объектов в центральное хранилище (depot), пустой — забирает пачку
+ * оттуда. Хранилище lock-free: пачки лежат в массиве атомарных слотов
+ * и передаются целиком обменом указателя, что исключает проблему ABA.
+ *
+ * Объект можно освободить в любом потоке: он попадает в магазин
+ * освобождающего потока, глобальная блокировка не берется.
+ *
+ * Запросы больше `SE_MEMORY_HEAP_SMALL_MAX` обслуживаются отдельным
+ * отображением страниц на каждый блок. Блоки от порога huge pages
+ * (`se_memory_heap_set_huge_threshold`) отображаются большими страницами.
+ * Освобожденные большие блоки до 32 МиБ сбрасываются через `MADV_DONTNEED`
+ * и остаются в небольшом кэше для повторного использования.
+ *
+ * Куча знает происхождение каждого блока: свежие страницы операционной
+ * системы уже заполнены нулями, поэтому `se_memory_heap_alloc_zeroed`
+ * обнуляет только повторно используемые объекты.
+ *
+ * Функции `se_memory_heap_alloc` и `se_memory_heap_dealloc` совместимы
+ * с интерфейсом аллокатора времени выполнения:
+ * @code
+ * se_runtime_allocator_set(se_memory_heap_get_allocator());
+ * @endcode
+ *
+ * @note Для многопоточного использования требуется включенная опция
+ *       `SE_LIBRARY_OPTION_THREAD_LOCAL`.
+ * @see memory_allocator.h
+ * @see runtime_allocator.h
+ */
+
+#ifndef SE_MEMORY_HEAP_H
+#define SE_MEMORY_HEAP_H
+
+#include "memory_allocator.h"
+#include "memory_page.h"
+#include "attribute.h"
+
+/**
+ * @def SE_MEMORY_HEAP_ALIGNMENT
+ * @brief Гарантированное выравнивание выделяемых блоков.
+ */
+#define SE_MEMORY_HEAP_ALIGNMENT 16
+
+/**
+ * @def SE_MEMORY_HEAP_SMALL_MAX
+ * @brief Максимальный размер запроса, обслуживаемого классами размеров.
+ */
+#define SE_MEMORY_HEAP_SMALL_MAX 32768
+
+/**
+ * @def SE_MEMORY_HEAP_CLASS_COUNT
+ * @brief Количество классов размеров.
+ *
+ * Классы идут с шагом 16 байт до 128 байт, далее по четыре класса
+ * на каждую степень двойки до `SE_MEMORY_HEAP_SMALL_MAX`.
+ */
+#define SE_MEMORY_HEAP_CLASS_COUNT 40
+
+/**
+ * @def SE_MEMORY_HEAP_SPAN_SIZE
+ * @brief Размер спана (степень двойки, спаны выровнены по своему размеру).
+ */
+#define SE_MEMORY_HEAP_SPAN_SIZE (256 * 1024)
+
+/**
+ * @def SE_MEMORY_HEAP_DEPOT_SLOTS
+ * @brief Количество слотов центрального хранилища на один класс размеров.
+ */
+#define SE_MEMORY_HEAP_DEPOT_SLOTS 64
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Выделяет блок памяти.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @return Указатель на блок, выровненный по `SE_MEMORY_HEAP_ALIGNMENT`,
+ *         или `nullptr` при нехватке памяти.
+ *
+ * @note Функция не выбрасывает исключений: сигнатура совпадает
+ *       с `se_memory_allocator_alloc_fn`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_heap_alloc(se_usize_t size);
+
+/**
+ * @brief Выделяет блок памяти с заданным выравниванием.
+ *
+ * Выравнивание до размера кэш-линии обслуживается классами размеров,
+ * чей размер кратен выравниванию; большее выравнивание (например, страничное)
+ * — отдельным отображением страниц.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @param[in] alignment Выравнивание (степень двойки, меньше `SE_MEMORY_HEAP_SPAN_SIZE`).
+ * @return Указатель на блок или `nullptr` при нехватке памяти
+ *         или недопустимом выравнивании.
+ *
+ * @note Блок освобождается через `se_memory_heap_dealloc`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_heap_alloc_aligned(se_usize_t size, se_usize_t alignment);
+
+/**
+ * @brief Выделяет заполненный нулями блок памяти.
+ *
+ * Обнуление выполняется только для повторно используемых объектов:
+ * ни разу не выданная память спана и большие блоки уже нулевые.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @param[in] alignment Выравнивание (степень двойки) или 0 для `SE_MEMORY_HEAP_ALIGNMENT`.
+ * @return Указатель на блок или `nullptr` при ошибке.
+ *
+ * @note Сигнатура совпадает с `se_memory_allocator_alloc_zeroed_fn`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_heap_alloc_zeroed(se_usize_t size, se_usize_t alignment);
+
+/**
+ * @brief Выделяет блок в отдельном отображении страниц с заданными флагами.
+ *
+ * Флаги позволяют запросить большие страницы и предварительное отображение
+ * (`SE_MEMORY_PAGE_FLAG_POPULATE`) или, наоборот, ленивое резервирование
+ * (`SE_MEMORY_PAGE_FLAG_LAZY`) для конкретного блока. При `flags == 0`
+ * функция эквивалентна `se_memory_heap_alloc_aligned`.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @param[in] alignment Выравнивание (степень двойки, меньше `SE_MEMORY_HEAP_SPAN_SIZE`).
+ * @param[in] flags Комбинация значений `se_memory_page_flags_t`.
+ * @return Указатель на блок или `nullptr` при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_heap_alloc_with_flags(se_usize_t size, se_usize_t alignment, se_u32_t flags);
+
+/**
+ * @brief Освобождает блок памяти.
+ *
+ * Допускается освобождение в потоке, отличном от выделившего.
+ *
+ * @param[in] ptr Указатель, полученный от `se_memory_heap_alloc` (допускается `nullptr`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_heap_dealloc(void *ptr);
+
+/**
+ * @brief Возвращает полезный размер выделенного блока.
+ * @param[in] ptr Указатель, полученный от `se_memory_heap_alloc`.
+ * @return Размер блока в байтах (не меньше запрошенного).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_heap_get_size(const void *ptr);
+
+/**
+ * @brief Устанавливает размер, начиная с которого блоки отображаются большими страницами.
+ *
+ * @param[in] threshold Порог в байтах; `SE_USIZE_T_MAX` отключает huge pages.
+ * @return Предыдущее значение порога.
+ *
+ * @note Начальное значение задается определением `SE_MEMORY_HEAP_HUGE_THRESHOLD`
+ *       (см. compile_definitions.cmake). Порог предназначен для настройки
+ *       при старте программы и не синхронизируется между потоками.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_heap_set_huge_threshold(se_usize_t threshold);
+
+/**
+ * @brief Возвращает порог отображения блоков большими страницами.
+ * @return Порог в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_heap_get_huge_threshold(void);
+
+/**
+ * @brief Сбрасывает магазины текущего потока в центральное хранилище.
+ *
+ * Делает закэшированные потоком объекты доступными остальным потокам.
+ * При включенной опции SE_LIBRARY_OPTION_THREAD_LOCAL вызывается
+ * автоматически при завершении потока, который выделял или освобождал
+ * память кучи; явный вызов нужен только для досрочного сброса.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_heap_thread_flush(void);
+
+/**
+ * @brief Возвращает описание кучи в виде аллокатора времени выполнения.
+ * @return Указатель на статическую структуру аллокатора.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const se_memory_allocator_t *
+se_memory_heap_get_allocator(void);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_HEAP_H
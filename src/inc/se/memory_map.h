@@ -0,0 +1,148 @@
+/**
+ * @file memory_map.h
+ * @brief Отображение файлов в память.
+ *
+ * Файл отображается в адресное пространство процесса (`mmap`, на Windows —
+ * `MapViewOfFile`) и доступен как обычная область памяти без чтения
+ * в промежуточный буфер: страницы подгружаются из страничного кэша
+ * операционной системы по мере обращения, а повторное отображение
+ * того же файла разделяет те же физические страницы.
+ *
+ * Представление `se_memory_map_get_view()` можно передавать во все функции
+ * memory_view.h и memory.h (например, `se_memory_find`), которые тогда
+ * работают непосредственно с байтами файла.
+ *
+ * Пример использования:
+ * @code
+ * se_memory_map_t map;
+ * se_memory_map_file(&map, "data.bin", SE_MEMORY_MAP_FLAG_NONE);
+ * se_memory_map_advise(&map, 0, map.size, SE_MEMORY_MAP_ADVICE_SEQUENTIAL);
+ * const se_memory_view_t view = se_memory_map_get_view(&map);
+ * // ...
+ * se_memory_map_unmap(&map);
+ * @endcode
+ *
+ * @note Изменение или усечение файла другим процессом во время отображения
+ *       видно через общее отображение; обращение за пределы усеченного
+ *       файла приводит к `SIGBUS`.
+ * @see memory_view.h
+ */
+
+#ifndef SE_MEMORY_MAP_H
+#define SE_MEMORY_MAP_H
+
+#include "memory_view.h"
+#include "attribute.h"
+#include "offset.h"
+#include "size.h"
+
+/**
+ * @enum se_memory_map_flags
+ * @brief Флаги отображения файла.
+ */
+typedef enum se_memory_map_flags
+{
+    /** Отображение только для чтения, общее со страничным кэшем. */
+    SE_MEMORY_MAP_FLAG_NONE = 0,
+
+    /**
+     * Отображение с копированием при записи (`MAP_PRIVATE`): страницы
+     * доступны для записи, изменения видны только процессу и не попадают в файл.
+     */
+    SE_MEMORY_MAP_FLAG_COPY_ON_WRITE = 1 << 0,
+
+    /**
+     * Отобразить все страницы сразу (`MAP_POPULATE`): файл читается целиком
+     * при создании отображения, а обращения не вызывают page fault.
+     */
+    SE_MEMORY_MAP_FLAG_POPULATE = 1 << 1,
+} se_memory_map_flags_t;
+
+/**
+ * @enum se_memory_map_advice
+ * @brief Подсказки о характере доступа к отображению (`madvise`).
+ */
+typedef enum se_memory_map_advice
+{
+    /** Доступ без особенностей, упреждающее чтение по умолчанию. */
+    SE_MEMORY_MAP_ADVICE_NORMAL,
+
+    /** Последовательный доступ: агрессивное упреждающее чтение, ранний сброс прочитанного. */
+    SE_MEMORY_MAP_ADVICE_SEQUENTIAL,
+
+    /** Случайный доступ: упреждающее чтение отключается. */
+    SE_MEMORY_MAP_ADVICE_RANDOM,
+
+    /** Диапазон понадобится в ближайшее время: начать чтение в фоне. */
+    SE_MEMORY_MAP_ADVICE_WILLNEED,
+} se_memory_map_advice_t;
+
+/**
+ * @struct se_memory_map
+ * @brief Отображенный в память файл.
+ */
+typedef struct se_memory_map
+{
+    void      *data; /**< Начало отображения или `nullptr` для пустого файла. */
+    se_usize_t size; /**< Размер файла в байтах. */
+} se_memory_map_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Отображает файл в память.
+ *
+ * Дескриптор файла закрывается сразу после создания отображения:
+ * отображение остается действительным до вызова `se_memory_map_unmap`.
+ *
+ * @param[out] self Указатель на отображение.
+ * @param[in] path Путь к файлу.
+ * @param[in] flags Комбинация значений `se_memory_map_flags_t`.
+ *
+ * @note Пустой файл не отображается: `data` равен `nullptr`, `size` — нулю.
+ * @note Если файл не удается открыть или отобразить,
+ *       выбрасывает `SE_RUNTIME_ERROR_IO`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_map_file(se_memory_map_t *self, const char *path, se_u32_t flags);
+
+/**
+ * @brief Сообщает операционной системе характер доступа к части отображения.
+ *
+ * @param[in] self Указатель на отображение.
+ * @param[in] offset Смещение начала диапазона (округляется вниз до страницы).
+ * @param[in] size Размер диапазона в байтах (обрезается по концу файла).
+ * @param[in] advice Подсказка о доступе.
+ *
+ * @note Подсказка не влияет на содержимое и может быть проигнорирована.
+ *       На Windows поддерживается только `SE_MEMORY_MAP_ADVICE_WILLNEED`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_map_advise(const se_memory_map_t *self,
+                     se_uoffset_t           offset,
+                     se_usize_t             size,
+                     se_memory_map_advice_t advice);
+
+/**
+ * @brief Возвращает представление отображенного файла.
+ * @param[in] self Указатель на отображение.
+ * @return Область `[data, data + size)`; для пустого файла — пустая
+ *         область с ненулевыми границами.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_view_t
+se_memory_map_get_view(const se_memory_map_t *self);
+
+/**
+ * @brief Удаляет отображение.
+ * @param[in,out] self Указатель на отображение (после вызова пусто).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_map_unmap(se_memory_map_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_MAP_H
@@ -0,0 +1,193 @@
+/**
+ * @file memory_page.h
+ * @brief Выделение памяти страницами напрямую у операционной системы.
+ *
+ * Модуль предоставляет тонкую обертку над `mmap`/`munmap` (POSIX)
+ * и `VirtualAlloc`/`VirtualFree` (Windows). Используется аллокаторами
+ * библиотеки как источник крупных блоков (спанов), минуя стандартную библиотеку.
+ *
+ * Память, полученная от операционной системы, всегда заполнена нулями.
+ *
+ * Флаги `se_memory_page_flags_t` управляют размером страниц и моментом
+ * их отображения в физическую память: крупные таблицы выигрывают от huge pages
+ * (меньше промахов TLB), а предварительное заполнение убирает page fault
+ * с критического пути.
+ */
+
+#ifndef SE_MEMORY_PAGE_H
+#define SE_MEMORY_PAGE_H
+
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def SE_MEMORY_PAGE_HUGE_SIZE
+ * @brief Размер большой страницы (huge page), используемый по умолчанию.
+ */
+#define SE_MEMORY_PAGE_HUGE_SIZE (2 * 1024 * 1024)
+
+/**
+ * @enum se_memory_page_flags
+ * @brief Флаги выделения страниц.
+ */
+typedef enum se_memory_page_flags
+{
+    SE_MEMORY_PAGE_FLAG_NONE = 0,
+
+    /**
+     * Отобразить все страницы сразу (`MAP_POPULATE`), чтобы первое обращение
+     * не вызывало page fault.
+     */
+    SE_MEMORY_PAGE_FLAG_POPULATE = 1 << 0,
+
+    /**
+     * Отложить резервирование до первого обращения (`MAP_NORESERVE`):
+     * подходит для разреженных таблиц, большая часть которых не используется.
+     */
+    SE_MEMORY_PAGE_FLAG_LAZY = 1 << 1,
+
+    /**
+     * Использовать большие страницы. Сначала запрашиваются явные страницы
+     * из пула hugetlbfs (`MAP_HUGETLB`, на Windows `MEM_LARGE_PAGES`),
+     * при их отсутствии — обычные страницы с `MADV_HUGEPAGE`
+     * (transparent huge pages). Размер и выравнивание блока округляются
+     * до `se_memory_page_get_huge_size()`.
+     */
+    SE_MEMORY_PAGE_FLAG_HUGE = 1 << 2,
+} se_memory_page_flags_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает размер страницы памяти.
+ * @return Размер страницы в байтах (степень двойки).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_page_get_size(void);
+
+/**
+ * @brief Возвращает размер большой страницы.
+ * @return Размер большой страницы в байтах (степень двойки).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_page_get_huge_size(void);
+
+/**
+ * @brief Выделяет блок страниц.
+ *
+ * @param[in] size Размер блока в байтах (округляется вверх до размера страницы).
+ * @return Указатель на начало блока, выровненный по размеру страницы,
+ *         или `nullptr` при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_page_alloc(se_usize_t size);
+
+/**
+ * @brief Выделяет блок страниц с заданным выравниванием начала.
+ *
+ * @param[in] size Размер блока в байтах (округляется вверх до размера страницы).
+ * @param[in] alignment Выравнивание (степень двойки, не меньше размера страницы).
+ * @return Указатель на начало блока или `nullptr` при ошибке.
+ *
+ * @note Блок освобождается через `se_memory_page_dealloc` с тем же `size`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_page_alloc_aligned(se_usize_t size, se_usize_t alignment);
+
+/**
+ * @brief Выделяет блок страниц с заданным выравниванием и флагами.
+ *
+ * @param[in] size Размер блока в байтах (округляется вверх до размера страницы,
+ *                 а с `SE_MEMORY_PAGE_FLAG_HUGE` — до размера большой страницы).
+ * @param[in] alignment Выравнивание (степень двойки) или 0 для размера страницы.
+ * @param[in] flags Комбинация значений `se_memory_page_flags_t`.
+ * @return Указатель на начало блока или `nullptr` при ошибке.
+ *
+ * @note С флагом `SE_MEMORY_PAGE_FLAG_HUGE` в `se_memory_page_dealloc`
+ *       передается размер, округленный до размера большой страницы.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_page_alloc_with_flags(se_usize_t size, se_usize_t alignment, se_u32_t flags);
+
+/**
+ * @brief Изменяет размер блока страниц с сохранением содержимого.
+ *
+ * На Linux используется `mremap`: страницы переносятся изменением таблиц
+ * страниц без копирования данных, поэтому стоимость не зависит от размера
+ * блока. На остальных платформах выделяется новый блок и содержимое копируется.
+ *
+ * @param[in] ptr Указатель, полученный от `se_memory_page_alloc` (допускается `nullptr`).
+ * @param[in] old_size Текущий размер блока в байтах.
+ * @param[in] new_size Новый размер блока в байтах (округляется вверх до размера страницы).
+ * @return Указатель на блок (может отличаться от `ptr`) или `nullptr` при ошибке;
+ *         при ошибке исходный блок остается действительным.
+ *
+ * @note Добавленные страницы заполнены нулями. Не предназначена для блоков,
+ *       выделенных с выравниванием больше размера страницы или большими страницами.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_page_realloc(void *ptr, se_usize_t old_size, se_usize_t new_size);
+
+/**
+ * @brief Возвращает физические страницы блока операционной системе, сохраняя отображение.
+ *
+ * Блок остается доступным: при следующем обращении страницы отображаются
+ * заново и заполнены нулями (`MADV_DONTNEED`, на Windows — повторная фиксация
+ * после `MEM_DECOMMIT`).
+ *
+ * @param[in] ptr Начало блока (выровнено по размеру страницы).
+ * @param[in] size Размер блока в байтах (округляется вверх до размера страницы).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_page_reset(void *ptr, se_usize_t size);
+
+/**
+ * @brief Возвращает блок страниц операционной системе.
+ *
+ * @param[in] ptr Указатель, полученный от `se_memory_page_alloc*` (допускается `nullptr`).
+ * @param[in] size Размер, переданный при выделении.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_page_dealloc(void *ptr, se_usize_t size);
+
+/**
+ * @brief Выделяет блок страниц, отображенный в память дважды подряд.
+ *
+ * Возвращает область размером `2 * size`, вторая половина которой — то же
+ * физическое содержимое, что и первая: запись по адресу `ptr + i`
+ * видна по адресу `ptr + size + i`. Кольцевые буферы поверх такого блока
+ * получают непрерывные фрагменты даже на стыке конца и начала.
+ *
+ * На Linux используется `memfd_create`, на остальных POSIX-системах —
+ * анонимный объект `shm_open`, на Windows — `CreateFileMapping`
+ * с двумя представлениями `MapViewOfFileEx`.
+ *
+ * @param[in] size Размер одной половины в байтах; должен быть кратен
+ *                 размеру страницы, на Windows — 64 КиБ.
+ * @return Указатель на начало области или `nullptr` при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_page_alloc_mirrored(se_usize_t size);
+
+/**
+ * @brief Освобождает блок, выделенный `se_memory_page_alloc_mirrored`.
+ *
+ * @param[in] ptr Указатель на начало области (допускается `nullptr`).
+ * @param[in] size Размер одной половины, переданный при выделении.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_page_dealloc_mirrored(void *ptr, se_usize_t size);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_PAGE_H
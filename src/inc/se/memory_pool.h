@@ -0,0 +1,127 @@
+/**
+ * @file memory_pool.h
+ * @brief Пул объектов фиксированного размера.
+ *
+ * Пул выделяет память крупными слябами через аллокатор времени выполнения
+ * и нарезает их на элементы одинакового размера. Освобожденные элементы
+ * связываются в интрузивный список: указатель на следующий свободный элемент
+ * хранится прямо в освобожденном слоте, поэтому пул не тратит память
+ * на служебные структуры.
+ *
+ * Выделение и освобождение выполняются за O(1) без обращения к системному
+ * аллокатору, кроме момента исчерпания текущего сляба.
+ *
+ * @note Пул не потокобезопасен.
+ * @see runtime_allocator.h
+ */
+
+#ifndef SE_MEMORY_POOL_H
+#define SE_MEMORY_POOL_H
+
+#include "attribute.h"
+#include "cache_line.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @def SE_MEMORY_POOL_ALIGNMENT
+ * @brief Выравнивание элементов пула по умолчанию.
+ */
+#define SE_MEMORY_POOL_ALIGNMENT (2 * sizeof(void *))
+
+/**
+ * @def SE_MEMORY_POOL_SLAB_CAPACITY
+ * @brief Количество элементов в слябе по умолчанию.
+ */
+#define SE_MEMORY_POOL_SLAB_CAPACITY 1024
+
+/**
+ * @struct se_memory_pool
+ * @brief Пул объектов фиксированного размера.
+ */
+typedef struct se_memory_pool
+{
+    se_usize_t element_size;  /**< Размер слота с учетом выравнивания. */
+    se_usize_t alignment;     /**< Выравнивание элементов. */
+    se_usize_t slab_capacity; /**< Количество элементов в одном слябе. */
+    void      *free_list;     /**< Голова интрузивного списка свободных слотов. */
+    void      *slabs;         /**< Голова списка выделенных слябов. */
+    void      *cur;           /**< Следующий ни разу не выданный слот текущего сляба. */
+    void      *end;           /**< Конец области слотов текущего сляба. */
+    bool       end_zeroed;    /**< Ни разу не выданные слоты текущего сляба заполнены нулями. */
+} se_memory_pool_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пул.
+ *
+ * @param[out] self Указатель на пул.
+ * @param[in] element_size Размер элемента в байтах (больше нуля).
+ * @param[in] alignment Выравнивание элементов (степень двойки)
+ *                      или 0 для `SE_MEMORY_POOL_ALIGNMENT`.
+ *                      Для исключения ложного разделения используйте `SE_CACHE_LINE_SIZE`.
+ * @param[in] slab_capacity Количество элементов в слябе
+ *                          или 0 для `SE_MEMORY_POOL_SLAB_CAPACITY`.
+ *
+ * @note Размер слота округляется вверх до кратного выравниванию
+ *       и не может быть меньше размера указателя.
+ * @note Память не выделяется до первого вызова `se_memory_pool_alloc`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_pool_init(se_memory_pool_t *self,
+                    se_usize_t        element_size,
+                    se_usize_t        alignment,
+                    se_usize_t        slab_capacity);
+
+/**
+ * @brief Освобождает все слябы пула.
+ *
+ * После вызова все элементы, выделенные из пула, становятся недействительными.
+ * Пул можно снова использовать без повторной инициализации.
+ *
+ * @param[in,out] self Указатель на пул.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_pool_deinit(se_memory_pool_t *self);
+
+/**
+ * @brief Выделяет элемент из пула.
+ *
+ * @param[in,out] self Указатель на пул.
+ * @return Указатель на элемент, выровненный по `alignment`.
+ *
+ * @note При включенной опции `SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`
+ *       элемент заполняется нулями. Слябы берутся через
+ *       `se_runtime_allocator_alloc_zeroed()` уже обнуленными, поэтому явно
+ *       обнуляются только повторно выдаваемые элементы.
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_pool_alloc(se_memory_pool_t *self);
+
+/**
+ * @brief Возвращает элемент в пул.
+ *
+ * @param[in,out] self Указатель на пул.
+ * @param[in] ptr Указатель на элемент, полученный из этого пула (допускается `nullptr`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_memory_pool_dealloc(se_memory_pool_t *self, void *ptr);
+
+/**
+ * @brief Возвращает размер слота пула.
+ * @param[in] self Указатель на пул.
+ * @return Размер слота в байтах (не меньше запрошенного размера элемента).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_pool_get_element_size(const se_memory_pool_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MEMORY_POOL_H
@@ -40,6 +40,16 @@ SE_ATTRIBUTE(SYMBOL)
 void *
 se_memory_std_copy(void *dst, const void *src, se_usize_t n);
 
+/**
+ * @brief Вариант `se_memory_std_copy` без проверки указателей.
+ *
+ * Не зависит от уровня SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL: вызывающий
+ * код сам гарантирует, что указатели валидны.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_std_copy_unchecked(void *dst, const void *src, se_usize_t n);
+
 /**
  * @brief Оптимизированное обратное копирование блока памяти.
  *
@@ -77,6 +87,16 @@ SE_ATTRIBUTE(SYMBOL)
 void *
 se_memory_std_copy_reverse(void *dst, const void *src, se_usize_t n);
 
+/**
+ * @brief Вариант `se_memory_std_copy_reverse` без проверки указателей.
+ *
+ * Не зависит от уровня SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL: вызывающий
+ * код сам гарантирует, что указатели валидны.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_std_copy_reverse_unchecked(void *dst, const void *src, se_usize_t n);
+
 /**
  * @brief Безопасное перемещение блока памяти с обработкой перекрывающихся регионов.
  *
@@ -106,6 +126,16 @@ SE_ATTRIBUTE(SYMBOL)
 void *
 se_memory_std_move(void *dst, const void *src, se_usize_t n);
 
+/**
+ * @brief Вариант `se_memory_std_move` без проверки указателей.
+ *
+ * Не зависит от уровня SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL: вызывающий
+ * код сам гарантирует, что указатели валидны.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_std_move_unchecked(void *dst, const void *src, se_usize_t n);
+
 /**
  * @brief Оптимизированное сравнение блоков памяти с определением позиции различия
  *
@@ -142,6 +172,16 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_std_compare(const void *lhs, const void *rhs, se_usize_t n);
 
+/**
+ * @brief Вариант `se_memory_std_compare` без проверки указателей.
+ *
+ * Не зависит от уровня SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL: вызывающий
+ * код сам гарантирует, что указатели валидны.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_std_compare_unchecked(const void *lhs, const void *rhs, se_usize_t n);
+
 /**
  * @brief Обратное сравнение блоков памяти с поиском последнего различия
  *
@@ -178,6 +218,47 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_std_compare_reverse(const void *lhs, const void *rhs, se_usize_t n);
 
+/**
+ * @brief Поиск первого вхождения блока памяти
+ *
+ * Ищет блок `rhs` в блоке `lhs` и возвращает указатель на первое вхождение.
+ *
+ * @param lhs Указатель на блок, в котором выполняется поиск
+ * @param lhs_size Размер блока `lhs` в байтах
+ * @param rhs Указатель на искомый блок
+ * @param rhs_size Размер искомого блока в байтах
+ * @return Указатель на первое вхождение в `lhs`, `lhs` при `rhs_size = 0`
+ *         либо nullptr, если вхождений нет
+ *
+ * @note Особенности реализации:
+ * - Проверка указателей (SE_RUNTIME_ERROR_NULL_POINTER)
+ * - Кандидаты отбираются сравнением первого и последнего байта `rhs`
+ *   сразу для вектора позиций:
+ *   * AVX2 (32 позиции) при SE_COMPILE_OPTION_AVX2
+ *   * SSE2 (16 позиций) при SE_COMPILE_OPTION_SSE2
+ * - Оставшиеся кандидаты проверяются через se_memory_std_compare
+ * - Выравнивание указателей не требуется
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_std_find(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size);
+
+/**
+ * @brief Поиск последнего вхождения блока памяти
+ *
+ * Аналог se_memory_std_find, просматривающий `lhs` с конца.
+ *
+ * @param lhs Указатель на блок, в котором выполняется поиск
+ * @param lhs_size Размер блока `lhs` в байтах
+ * @param rhs Указатель на искомый блок
+ * @param rhs_size Размер искомого блока в байтах
+ * @return Указатель на последнее вхождение в `lhs`, конец `lhs` при `rhs_size = 0`
+ *         либо nullptr, если вхождений нет
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_std_find_reverse(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size);
+
 /**
  * @brief Оптимизированное заполнение памяти заданным значением
  *
@@ -217,6 +298,16 @@ SE_ATTRIBUTE(SYMBOL)
 void *
 se_memory_std_set(void *dst, se_usize_t len, se_u8_t val);
 
+/**
+ * @brief Вариант `se_memory_std_set` без проверки указателей.
+ *
+ * Не зависит от уровня SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL: вызывающий
+ * код сам гарантирует, что указатели валидны.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_memory_std_set_unchecked(void *dst, se_usize_t len, se_u8_t val);
+
 SE_COMPILER(EXTERN_C_END)
 
 #endif // SE_MEMORY_STD_H
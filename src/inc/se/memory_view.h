@@ -2,6 +2,7 @@
 #define SE_MEMORY_VIEW_H
 
 #include "attribute.h"
+#include "error.h"
 #include "bool.h"
 #include "offset.h"
 
@@ -50,6 +51,14 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_view_get_begin(const se_memory_view_t *self);
 
+/**
+ * @brief Вариант `se_memory_view_get_begin` без проверки self.
+ * @note Не зависит от SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_get_begin_unchecked(const se_memory_view_t *self);
+
 /**
  * @brief Возвращает указатель на конец области памяти из se_memory_view_t.
  * @param[in] self Указатель на se_memory_view_t.
@@ -60,6 +69,14 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_view_get_end(const se_memory_view_t *self);
 
+/**
+ * @brief Вариант `se_memory_view_get_end` без проверки self.
+ * @note Не зависит от SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_get_end_unchecked(const se_memory_view_t *self);
+
 /**
  * @brief Распаковывает указатели begin и end из se_memory_view_t.
  * @param[in] self Указатель на se_memory_view_t.
@@ -130,6 +147,14 @@ SE_ATTRIBUTE(SYMBOL)
 se_usize_t
 se_memory_view_get_size(const se_memory_view_t *self);
 
+/**
+ * @brief Вариант `se_memory_view_get_size` без проверки валидности области.
+ * @note Не зависит от SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_view_get_size_unchecked(const se_memory_view_t *self);
+
 /**
  * @brief Проверяет, кратен ли размер области заданному размеру элемента.
  * @param[in] self Указатель на se_memory_view_t.
@@ -173,6 +198,14 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_view_at_begin(const se_memory_view_t *self, se_uoffset_t offset);
 
+/**
+ * @brief Вариант `se_memory_view_at_begin` без проверки смещения.
+ * @note Не зависит от SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_at_begin_unchecked(const se_memory_view_t *self, se_uoffset_t offset);
+
 /**
  * @brief Возвращает указатель на конец с обратным смещением.
  * @param[in] self Указатель на se_memory_view_t.
@@ -183,6 +216,14 @@ SE_ATTRIBUTE(SYMBOL)
 const void *
 se_memory_view_at_end(const se_memory_view_t *self, se_uoffset_t offset);
 
+/**
+ * @brief Вариант `se_memory_view_at_end` без проверки смещения.
+ * @note Не зависит от SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_at_end_unchecked(const se_memory_view_t *self, se_uoffset_t offset);
+
 /**
  * @brief Возвращает указатель с учетом направления.
  * @param[in] self Указатель на se_memory_view_t.
@@ -262,6 +303,82 @@ SE_ATTRIBUTE(SYMBOL)
 bool
 se_memory_view_is_equal(const se_memory_view_t *self, const se_memory_view_t *other);
 
+/*
+ * Варианты с суффиксом `_r` сообщают об ошибке кодом: при нарушении
+ * предусловия код записывается в `error` (если он не nullptr), а функция
+ * возвращает nullptr, 0 или false. При успехе `error` не изменяется,
+ * поэтому в цикле его достаточно проверить один раз после цикла.
+ */
+
+/**
+ * @brief Вариант `se_memory_view_get_begin` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return self->begin или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_get_begin_r(const se_memory_view_t *self, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_view_get_end` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_NULL_POINTER`) или nullptr.
+ * @return self->end или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_get_end_r(const se_memory_view_t *self, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_view_get_size` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[out] error Код ошибки или nullptr.
+ * @return Размер в байтах или 0 при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_memory_view_get_size_r(const se_memory_view_t *self, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_view_contains_pointer` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[in] ptr Указатель для проверки.
+ * @param[out] error Код ошибки или nullptr.
+ * @return true, если ptr в пределах self; false при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_memory_view_contains_pointer_r(const se_memory_view_t *self, const void *ptr, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_view_at_begin` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[in] offset Смещение в байтах.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_OUT_OF_RANGE` и др.) или nullptr.
+ * @return Сдвинутый begin или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_at_begin_r(const se_memory_view_t *self, se_uoffset_t offset, se_error_t *error);
+
+/**
+ * @brief Вариант `se_memory_view_at_end` с кодом ошибки.
+ * @param[in] self Указатель на se_memory_view_t.
+ * @param[in] offset Смещение в байтах от конца.
+ * @param[out] error Код ошибки (`SE_RUNTIME_ERROR_OUT_OF_RANGE` и др.) или nullptr.
+ * @return Сдвинутый end или nullptr при ошибке.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const void *
+se_memory_view_at_end_r(const se_memory_view_t *self, se_uoffset_t offset, se_error_t *error);
+
 SE_COMPILER(EXTERN_C_END)
 
+// С опцией SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE вызовы функций выше
+// встраиваются (см. memory_view_inline.h)
+#ifdef SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+#    include "memory_view_inline.h"
+#endif // SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+
 #endif // SE_MEMORY_VIEW_H
@@ -0,0 +1,364 @@
+/**
+ * @file memory_view_inline.h
+ * @brief Встраиваемая реализация функций memory_view.h.
+ *
+ * Функции `se_memory_view_inline_*` повторяют одноименные функции
+ * memory_view.h и служат им единственной реализацией: экспортируемые
+ * символы библиотеки только вызывают их.
+ *
+ * С опцией `SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE` вызовы `se_memory_view_*`
+ * в пользовательском коде перенаправляются сюда макросами, поэтому цепочки
+ * вроде `contains` → `unpack` → `get_begin` сворачиваются в сравнения
+ * указателей без вызовов через PLT. Адрес функции (`&se_memory_view_get_begin`)
+ * по-прежнему указывает на экспортируемый символ.
+ *
+ * Проверки `se_runtime_check` во встроенном коде следуют уровню
+ * `SE_RUNTIME_CHECK_LEVEL` той единицы трансляции, куда код встроен.
+ *
+ * Файл подключается через memory_view.h при включенной опции и напрямую
+ * из memory_view.c; пользовательскому коду включать его не нужно.
+ *
+ * @see memory_view.h
+ */
+
+#ifndef SE_MEMORY_VIEW_INLINE_H
+#define SE_MEMORY_VIEW_INLINE_H
+
+#include "memory_view.h"
+#include "runtime_check_return.h"
+#include "runtime_return_if.h"
+#include "runtime_check.h"
+#include "numeric_util.h"
+#include "ptr_util.h"
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_begin_unchecked(const se_memory_view_t *self)
+{
+    return self->begin;
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_begin(const se_memory_view_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_view_inline_get_begin_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_end_unchecked(const se_memory_view_t *self)
+{
+    return self->end;
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_end(const se_memory_view_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_view_inline_get_end_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_memory_view_inline_unpack(const se_memory_view_t *self, const void **begin, const void **end)
+{
+    if (begin)
+        *begin = se_memory_view_inline_get_begin(self);
+
+    if (end)
+        *end = se_memory_view_inline_get_end(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_begin_equal(const se_memory_view_t *self, const void *ptr)
+{
+    return se_memory_view_inline_get_begin(self) == ptr;
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_end_equal(const se_memory_view_t *self, const void *ptr)
+{
+    return se_memory_view_inline_get_end(self) == ptr;
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_empty(const se_memory_view_t *self)
+{
+    const void *end = se_memory_view_inline_get_end(self);
+    return se_memory_view_inline_is_begin_equal(self, end);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_valid(const se_memory_view_t *self)
+{
+    const void *begin, *end;
+    se_memory_view_inline_unpack(self, &begin, &end);
+    return se_ptr_range_is_valid(begin, end);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_contains_pointer(const se_memory_view_t *self, const void *ptr)
+{
+    se_runtime_check(se_memory_view_inline_is_valid(self), SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
+
+    const void *begin, *end;
+    se_memory_view_inline_unpack(self, &begin, &end);
+    return se_ptr_within_range(begin, end, ptr);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_contains(const se_memory_view_t *self, const se_memory_view_t *other)
+{
+    const void *begin, *end;
+    se_memory_view_inline_unpack(other, &begin, &end);
+    return se_memory_view_inline_is_valid(other) && se_memory_view_inline_contains_pointer(self, begin) &&
+           se_memory_view_inline_contains_pointer(self, end);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_contains_range(const se_memory_view_t *self, const void *begin, const void *end)
+{
+    const se_memory_view_t _t = {begin, end};
+    return se_memory_view_inline_contains(self, &_t);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+se_usize_t
+se_memory_view_inline_get_size_unchecked(const se_memory_view_t *self)
+{
+    return (se_usize_t)se_ptr_to_addr_diff(self->end, self->begin);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+se_usize_t
+se_memory_view_inline_get_size(const se_memory_view_t *self)
+{
+    se_runtime_check(se_memory_view_inline_is_valid(self), SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
+    return se_memory_view_inline_get_size_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_multiple_of(const se_memory_view_t *self, se_usize_t element_size)
+{
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+    const se_usize_t size = se_memory_view_inline_get_size(self);
+    return se_numeric_no_remainder(size, element_size);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_aligned(const se_memory_view_t *self, se_usize_t alignment_size)
+{
+    se_runtime_check(alignment_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const void *begin, *end;
+    se_memory_view_inline_unpack(self, &begin, &end);
+    return se_ptr_pair_is_aligned(begin, end, alignment_size);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_valid_offset(const se_memory_view_t *self, se_uoffset_t offset)
+{
+    return offset < se_memory_view_inline_get_size(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_begin_unchecked(const se_memory_view_t *self, se_uoffset_t offset)
+{
+    return se_ptr_shift(const void, self->begin, offset);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_begin(const se_memory_view_t *self, se_uoffset_t offset)
+{
+    se_runtime_check(se_memory_view_inline_is_valid_offset(self, offset), SE_RUNTIME_ERROR_OUT_OF_RANGE);
+    return se_memory_view_inline_at_begin_unchecked(self, offset);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_end_unchecked(const se_memory_view_t *self, se_uoffset_t offset)
+{
+    const se_usize_t size = se_memory_view_inline_get_size_unchecked(self);
+    return se_memory_view_inline_at_begin_unchecked(self, size - (offset + 1));
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_end(const se_memory_view_t *self, se_uoffset_t offset)
+{
+    const se_usize_t size = se_memory_view_inline_get_size(self);
+    return se_memory_view_inline_at_begin(self, size - (offset + 1));
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at(const se_memory_view_t *self, se_uoffset_t offset, bool reversed)
+{
+    return reversed ? se_memory_view_inline_at_end(self, offset) : se_memory_view_inline_at_begin(self, offset);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_first(const void *self)
+{
+    return se_memory_view_inline_at(se_ptr_cast(const se_memory_view_t, self), 0, false);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_last(const void *self)
+{
+    return se_memory_view_inline_at(se_ptr_cast(const se_memory_view_t, self), 0, true);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_begin_equal_to(const se_memory_view_t *self, const se_memory_view_t *other)
+{
+    return se_memory_view_inline_is_begin_equal(self, se_memory_view_inline_get_begin(other));
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_end_equal_to(const se_memory_view_t *self, const se_memory_view_t *other)
+{
+    return se_memory_view_inline_is_end_equal(self, se_memory_view_inline_get_end(other));
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_is_equal(const se_memory_view_t *self, const se_memory_view_t *other)
+{
+    return se_memory_view_inline_is_begin_equal_to(self, other) &&
+           se_memory_view_inline_is_end_equal_to(self, other);
+}
+
+/*
+ * Варианты с кодом ошибки. Порядок проверок совпадает с бросающими
+ * функциями, поэтому код ошибки в `error` тот же, что был бы в исключении.
+ */
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_check_r(const se_memory_view_t *self, se_error_t *error)
+{
+    se_runtime_check_return(self, error, SE_RUNTIME_ERROR_NULL_POINTER, false);
+    se_runtime_check_return(se_ptr_range_is_valid(self->begin, self->end), error,
+                            SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE, false);
+    return true;
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_begin_r(const se_memory_view_t *self, se_error_t *error)
+{
+    se_runtime_check_return(self, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return se_memory_view_inline_get_begin_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_get_end_r(const se_memory_view_t *self, se_error_t *error)
+{
+    se_runtime_check_return(self, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return se_memory_view_inline_get_end_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+se_usize_t
+se_memory_view_inline_get_size_r(const se_memory_view_t *self, se_error_t *error)
+{
+    se_runtime_return_ifn(se_memory_view_inline_check_r(self, error), 0);
+    return se_memory_view_inline_get_size_unchecked(self);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+bool
+se_memory_view_inline_contains_pointer_r(const se_memory_view_t *self, const void *ptr, se_error_t *error)
+{
+    se_runtime_return_ifn(se_memory_view_inline_check_r(self, error), false);
+    return se_ptr_within_range(self->begin, self->end, ptr);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_begin_r(const se_memory_view_t *self, se_uoffset_t offset, se_error_t *error)
+{
+    se_runtime_return_ifn(se_memory_view_inline_check_r(self, error), nullptr);
+    se_runtime_check_return(offset < se_memory_view_inline_get_size_unchecked(self), error,
+                            SE_RUNTIME_ERROR_OUT_OF_RANGE, nullptr);
+    return se_memory_view_inline_at_begin_unchecked(self, offset);
+}
+
+static SE_ATTRIBUTE(FORCE_INLINE)
+const void *
+se_memory_view_inline_at_end_r(const se_memory_view_t *self, se_uoffset_t offset, se_error_t *error)
+{
+    se_runtime_return_ifn(se_memory_view_inline_check_r(self, error), nullptr);
+    se_runtime_check_return(offset < se_memory_view_inline_get_size_unchecked(self), error,
+                            SE_RUNTIME_ERROR_OUT_OF_RANGE, nullptr);
+    return se_memory_view_inline_at_end_unchecked(self, offset);
+}
+
+SE_COMPILER(EXTERN_C_END)
+
+/*
+ * Перенаправление вызовов. Макросы функционального вида не затрагивают
+ * имя функции без скобок, поэтому ее адрес остается адресом символа.
+ * memory_view.c определяет SE_MEMORY_VIEW_EXPORT, чтобы объявить сами символы.
+ */
+#if defined(SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE) && !defined(SE_MEMORY_VIEW_EXPORT)
+#    define se_memory_view_get_begin(self)                 se_memory_view_inline_get_begin(self)
+#    define se_memory_view_get_begin_unchecked(self)       se_memory_view_inline_get_begin_unchecked(self)
+#    define se_memory_view_get_end(self)                   se_memory_view_inline_get_end(self)
+#    define se_memory_view_get_end_unchecked(self)         se_memory_view_inline_get_end_unchecked(self)
+#    define se_memory_view_unpack(self, begin, end)        se_memory_view_inline_unpack(self, begin, end)
+#    define se_memory_view_is_empty(self)                  se_memory_view_inline_is_empty(self)
+#    define se_memory_view_is_valid(self)                  se_memory_view_inline_is_valid(self)
+#    define se_memory_view_contains_pointer(self, ptr)     se_memory_view_inline_contains_pointer(self, ptr)
+#    define se_memory_view_contains(self, other)           se_memory_view_inline_contains(self, other)
+#    define se_memory_view_contains_range(self, begin, end) se_memory_view_inline_contains_range(self, begin, end)
+#    define se_memory_view_get_size(self)                  se_memory_view_inline_get_size(self)
+#    define se_memory_view_get_size_unchecked(self)        se_memory_view_inline_get_size_unchecked(self)
+#    define se_memory_view_is_multiple_of(self, size)      se_memory_view_inline_is_multiple_of(self, size)
+#    define se_memory_view_is_aligned(self, size)          se_memory_view_inline_is_aligned(self, size)
+#    define se_memory_view_is_valid_offset(self, offset)   se_memory_view_inline_is_valid_offset(self, offset)
+#    define se_memory_view_at_begin(self, offset)          se_memory_view_inline_at_begin(self, offset)
+#    define se_memory_view_at_begin_unchecked(self, offset) se_memory_view_inline_at_begin_unchecked(self, offset)
+#    define se_memory_view_at_end(self, offset)            se_memory_view_inline_at_end(self, offset)
+#    define se_memory_view_at_end_unchecked(self, offset)  se_memory_view_inline_at_end_unchecked(self, offset)
+#    define se_memory_view_at(self, offset, reversed)      se_memory_view_inline_at(self, offset, reversed)
+#    define se_memory_view_get_first(self)                 se_memory_view_inline_get_first(self)
+#    define se_memory_view_get_last(self)                  se_memory_view_inline_get_last(self)
+#    define se_memory_view_is_begin_equal(self, ptr)       se_memory_view_inline_is_begin_equal(self, ptr)
+#    define se_memory_view_is_end_equal(self, ptr)         se_memory_view_inline_is_end_equal(self, ptr)
+#    define se_memory_view_is_begin_equal_to(self, other)  se_memory_view_inline_is_begin_equal_to(self, other)
+#    define se_memory_view_is_end_equal_to(self, other)    se_memory_view_inline_is_end_equal_to(self, other)
+#    define se_memory_view_is_equal(self, other)           se_memory_view_inline_is_equal(self, other)
+#    define se_memory_view_get_begin_r(self, error)        se_memory_view_inline_get_begin_r(self, error)
+#    define se_memory_view_get_end_r(self, error)          se_memory_view_inline_get_end_r(self, error)
+#    define se_memory_view_get_size_r(self, error)         se_memory_view_inline_get_size_r(self, error)
+#    define se_memory_view_contains_pointer_r(self, ptr, error)                                    \
+        se_memory_view_inline_contains_pointer_r(self, ptr, error)
+#    define se_memory_view_at_begin_r(self, offset, error) se_memory_view_inline_at_begin_r(self, offset, error)
+#    define se_memory_view_at_end_r(self, offset, error)   se_memory_view_inline_at_end_r(self, offset, error)
+#endif // SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+
+#endif // SE_MEMORY_VIEW_INLINE_H
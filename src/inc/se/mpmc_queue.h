@@ -0,0 +1,214 @@
+/**
+ * @file mpmc_queue.h
+ * @brief Ограниченная очередь сообщений фиксированного размера для многих
+ *        производителей и многих потребителей.
+ *
+ * Очередь построена по схеме Д. Вьюкова: кольцевой массив ячеек, каждая
+ * из которых хранит номер последовательности и сообщение. Номер ячейки
+ * сообщает, свободна ли она для записи с текущей позиции производителей
+ * или заполнена для чтения с текущей позиции потребителей, поэтому захват
+ * ячейки — это одна операция CAS над позицией своей стороны, а публикация —
+ * одна release-запись номера. Производители и потребители не трогают
+ * позиции друг друга, и каждая позиция лежит в своей кэш-линии.
+ *
+ * Пакетные функции захватывают сразу несколько подряд идущих ячеек одним CAS.
+ *
+ * Неблокирующие функции (`try_*`) сразу возвращают управление, если очередь
+ * полна или пуста. Блокирующие сначала крутятся `SE_MPMC_QUEUE_SPIN_COUNT`
+ * итераций, а затем засыпают на futex (см. futex.h) до появления места
+ * или данных.
+ *
+ * Пример использования:
+ * @code
+ * se_mpmc_queue_t queue;
+ * se_mpmc_queue_init(&queue, 1024, sizeof(message_t));
+ *
+ * // Потоки-производители
+ * se_mpmc_queue_enqueue(&queue, &message);
+ *
+ * // Потоки-потребители
+ * message_t received;
+ * se_mpmc_queue_dequeue(&queue, &received);
+ *
+ * se_mpmc_queue_deinit(&queue);
+ * @endcode
+ *
+ * @note Порядок сообщений сохраняется для каждой пары производитель–потребитель.
+ * @see futex.h
+ */
+
+#ifndef SE_MPMC_QUEUE_H
+#define SE_MPMC_QUEUE_H
+
+#include "attribute.h"
+#include "cache_line.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @def SE_MPMC_QUEUE_SPIN_COUNT
+ * @brief Количество попыток с паузой перед засыпанием в блокирующих функциях.
+ */
+#define SE_MPMC_QUEUE_SPIN_COUNT 128
+
+/**
+ * @struct se_mpmc_queue
+ * @brief Очередь сообщений.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct se_mpmc_queue
+{
+    void      *cells;        /**< Массив ячеек «номер, сообщение». */
+    se_usize_t capacity;     /**< Количество ячеек (степень двойки). */
+    se_usize_t element_size; /**< Размер сообщения в байтах. */
+    se_usize_t cell_size;    /**< Размер ячейки в байтах. */
+    void      *control;      /**< Позиции сторон и слова ожидания, выровненные по кэш-линиям. */
+} se_mpmc_queue_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает пустую очередь.
+ *
+ * @param[out] self Указатель на очередь.
+ * @param[in] capacity Количество сообщений (округляется вверх до степени двойки, не меньше 2).
+ * @param[in] element_size Размер сообщения в байтах (больше нуля).
+ *
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mpmc_queue_init(se_mpmc_queue_t *self, se_usize_t capacity, se_usize_t element_size);
+
+/**
+ * @brief Освобождает память очереди.
+ *
+ * @param[in,out] self Указатель на очередь.
+ *
+ * @note Ни один поток не должен работать с очередью во время вызова.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mpmc_queue_deinit(se_mpmc_queue_t *self);
+
+/**
+ * @brief Добавляет сообщение, если есть место.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[in] element Сообщение размером `element_size`.
+ * @return `false`, если очередь полна.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_mpmc_queue_try_enqueue(se_mpmc_queue_t *self, const void *element);
+
+/**
+ * @brief Извлекает сообщение, если оно есть.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[out] element Буфер размером `element_size`.
+ * @return `false`, если очередь пуста.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_mpmc_queue_try_dequeue(se_mpmc_queue_t *self, void *element);
+
+/**
+ * @brief Добавляет подряд идущие сообщения, сколько поместится.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[in] elements Массив сообщений.
+ * @param[in] count Количество сообщений в массиве.
+ * @return Количество добавленных сообщений (первые из массива).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_try_enqueue_batch(se_mpmc_queue_t *self, const void *elements, se_usize_t count);
+
+/**
+ * @brief Извлекает доступные сообщения, не больше `count`.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[out] elements Массив для сообщений.
+ * @param[in] count Емкость массива в сообщениях.
+ * @return Количество извлеченных сообщений.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_try_dequeue_batch(se_mpmc_queue_t *self, void *elements, se_usize_t count);
+
+/**
+ * @brief Добавляет сообщение, ожидая места.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[in] element Сообщение размером `element_size`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mpmc_queue_enqueue(se_mpmc_queue_t *self, const void *element);
+
+/**
+ * @brief Извлекает сообщение, ожидая его появления.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[out] element Буфер размером `element_size`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mpmc_queue_dequeue(se_mpmc_queue_t *self, void *element);
+
+/**
+ * @brief Добавляет все сообщения массива, ожидая места.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[in] elements Массив сообщений.
+ * @param[in] count Количество сообщений в массиве.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mpmc_queue_enqueue_batch(se_mpmc_queue_t *self, const void *elements, se_usize_t count);
+
+/**
+ * @brief Извлекает от одного до `count` сообщений, ожидая хотя бы одного.
+ *
+ * @param[in] self Указатель на очередь.
+ * @param[out] elements Массив для сообщений.
+ * @param[in] count Емкость массива в сообщениях (больше нуля).
+ * @return Количество извлеченных сообщений.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_dequeue_batch(se_mpmc_queue_t *self, void *elements, se_usize_t count);
+
+/**
+ * @brief Возвращает емкость очереди.
+ * @param[in] self Указатель на очередь.
+ * @return Количество сообщений.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_get_capacity(const se_mpmc_queue_t *self);
+
+/**
+ * @brief Возвращает размер сообщения.
+ * @param[in] self Указатель на очередь.
+ * @return Размер сообщения в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_get_element_size(const se_mpmc_queue_t *self);
+
+/**
+ * @brief Возвращает количество сообщений в очереди.
+ *
+ * @param[in] self Указатель на очередь.
+ * @return Количество сообщений; при одновременной работе потоков — приблизительное.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_mpmc_queue_get_size(const se_mpmc_queue_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MPMC_QUEUE_H
@@ -0,0 +1,100 @@
+/**
+ * @file mutex.h
+ * @brief Адаптивный мьютекс на futex.
+ *
+ * Состояние мьютекса — одно 32-битное слово: 0 — свободен, 1 — захвачен,
+ * 2 — захвачен и, возможно, есть спящие потоки (схема У. Дреппера,
+ * «Futexes Are Tricky»). Захват без конкуренции — один CAS, освобождение
+ * без ожидающих — один обмен без системного вызова.
+ *
+ * При конкуренции поток сначала крутится `SE_MUTEX_SPIN_COUNT` итераций
+ * с паузой процессора: короткие критические секции успевают завершиться
+ * без засыпания. Затем поток помечает слово значением 2 и засыпает
+ * на futex (см. futex.h); освобождающий поток будит одного ожидающего.
+ *
+ * Мьютекс не рекурсивный и не справедливый: освободившийся мьютекс
+ * может захватить крутящийся поток раньше разбуженного.
+ *
+ * Пример использования:
+ * @code
+ * se_mutex_t mutex;
+ * se_mutex_init(&mutex, nullptr);
+ *
+ * se_mutex_lock(&mutex);
+ * // критическая секция
+ * se_mutex_unlock(&mutex);
+ * @endcode
+ *
+ * @see lock_stats.h
+ */
+
+#ifndef SE_MUTEX_H
+#define SE_MUTEX_H
+
+#include "lock_stats.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "bool.h"
+
+/**
+ * @def SE_MUTEX_SPIN_COUNT
+ * @brief Количество попыток с паузой перед засыпанием.
+ */
+#define SE_MUTEX_SPIN_COUNT 128
+
+/**
+ * @struct se_mutex
+ * @brief Мьютекс.
+ *
+ * Занимает отдельную кэш-линию, поэтому захват не мешает соседним данным.
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_mutex
+{
+    se_atomic_u32_t  state; /**< 0 — свободен, 1 — захвачен, 2 — захвачен, есть ожидающие. */
+    se_lock_stats_t *stats; /**< Счетчики конкуренции или `nullptr`. */
+} se_mutex_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает свободный мьютекс.
+ *
+ * @param[out] self Указатель на мьютекс.
+ * @param[in] stats Счетчики конкуренции или `nullptr`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mutex_init(se_mutex_t *self, se_lock_stats_t *stats);
+
+/**
+ * @brief Захватывает мьютекс, ожидая его освобождения.
+ * @param[in] self Указатель на мьютекс.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mutex_lock(se_mutex_t *self);
+
+/**
+ * @brief Захватывает мьютекс, если он свободен.
+ *
+ * @param[in] self Указатель на мьютекс.
+ * @return `false`, если мьютекс захвачен.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_mutex_try_lock(se_mutex_t *self);
+
+/**
+ * @brief Освобождает мьютекс и будит одного ожидающего, если он есть.
+ *
+ * @param[in] self Указатель на мьютекс, захваченный вызывающим потоком.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_mutex_unlock(se_mutex_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_MUTEX_H
@@ -0,0 +1,203 @@
+/**
+ * @file parallel.h
+ * @brief Параллельные алгоритмы над массивами записей фиксированного размера.
+ *
+ * Алгоритмы делят массив на фрагменты из целого числа записей и выполняют
+ * их задачами пула потоков (см. thread_pool.h). Задачи порождаются
+ * рекурсивным делением пополам, поэтому простаивающие рабочие потоки
+ * крадут крупные части работы, а не отдельные фрагменты.
+ *
+ * Границы фрагментов по возможности выровнены по кэш-линиям: размер
+ * фрагмента кратен `SE_CACHE_LINE_SIZE` байт, а первая граница
+ * приходится на первую выровненную запись. Соседние фрагменты тогда
+ * не делят кэш-линию, и запись на месте не вызывает ложного разделения.
+ *
+ * Размер фрагмента (`grain`) задается в записях; 0 выбирает его
+ * автоматически: примерно `SE_PARALLEL_CHUNKS_PER_WORKER` фрагментов
+ * на рабочий поток, но не меньше `SE_PARALLEL_MIN_CHUNK_SIZE` байт.
+ * Массив, умещающийся в один фрагмент, обрабатывается в вызывающем
+ * потоке без задач. Пул может быть `nullptr`: тогда все выполняется
+ * последовательно.
+ *
+ * Функции обратного вызова не должны выбрасывать исключения.
+ *
+ * Пример использования:
+ * @code
+ * static void
+ * sum_chunk(void *accumulator, const se_memory_view_t *chunk, void *context)
+ * {
+ *     for (const se_u64_t *it = chunk->begin; it != chunk->end; ++it)
+ *     {
+ *         *(se_u64_t *)accumulator += *it;
+ *     }
+ * }
+ *
+ * static void
+ * add(void *accumulator, const void *value, void *context)
+ * {
+ *     *(se_u64_t *)accumulator += *(const se_u64_t *)value;
+ * }
+ *
+ * const se_u64_t   zero = 0;
+ * se_u64_t         sum  = 0;
+ * se_memory_view_t view = {column, column + count};
+ * se_parallel_reduce(&pool, &view, sizeof(se_u64_t), 0, &zero, sizeof(sum), sum_chunk, add, nullptr, &sum);
+ * @endcode
+ *
+ * @see thread_pool.h
+ */
+
+#ifndef SE_PARALLEL_H
+#define SE_PARALLEL_H
+
+#include "parallel_compare_fn.h"
+#include "parallel_combine_fn.h"
+#include "parallel_reduce_fn.h"
+#include "parallel_for_fn.h"
+#include "memory_range.h"
+#include "memory_view.h"
+#include "thread_pool.h"
+#include "numeric_fixed_types.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "size.h"
+
+/**
+ * @def SE_PARALLEL_MIN_CHUNK_SIZE
+ * @brief Минимальный размер автоматически выбранного фрагмента в байтах.
+ *
+ * Стоимость задачи — десятки наносекунд; фрагмент такого размера
+ * обрабатывается на порядки дольше.
+ */
+#define SE_PARALLEL_MIN_CHUNK_SIZE 16384
+
+/**
+ * @def SE_PARALLEL_CHUNKS_PER_WORKER
+ * @brief Количество автоматически выбранных фрагментов на рабочий поток.
+ *
+ * Больше одного, чтобы неравномерная работа выравнивалась кражей.
+ */
+#define SE_PARALLEL_CHUNKS_PER_WORKER 4
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Вызывает функцию для каждого фрагмента массива.
+ *
+ * @param[in] pool Пул потоков или `nullptr`.
+ * @param[in] view Массив записей.
+ * @param[in] element_size Размер записи в байтах (больше нуля, делит размер массива).
+ * @param[in] grain Размер фрагмента в записях или 0.
+ * @param[in] fn Функция фрагмента; фрагменты обрабатываются в произвольном порядке.
+ * @param[in] context Аргумент функции.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_parallel_for(se_thread_pool_t       *pool,
+                const se_memory_view_t *view,
+                se_usize_t              element_size,
+                se_usize_t              grain,
+                se_parallel_for_fn     *fn,
+                void                   *context);
+
+/**
+ * @brief Сворачивает массив ассоциативной операцией.
+ *
+ * Каждый фрагмент сворачивается `reduce` в свой частичный результат,
+ * начинающийся с копии `identity`; частичные результаты объединяются
+ * `combine` слева направо в порядке фрагментов.
+ *
+ * @param[in] pool Пул потоков или `nullptr`.
+ * @param[in] view Массив записей.
+ * @param[in] element_size Размер записи в байтах (больше нуля, делит размер массива).
+ * @param[in] grain Размер фрагмента в записях или 0.
+ * @param[in] identity Нейтральный элемент размером `result_size`.
+ * @param[in] result_size Размер результата в байтах (больше нуля).
+ * @param[in] reduce Свертка фрагмента.
+ * @param[in] combine Объединение частичных результатов.
+ * @param[in] context Аргумент функций.
+ * @param[out] result Результат размером `result_size`; для пустого массива — `identity`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_parallel_reduce(se_thread_pool_t       *pool,
+                   const se_memory_view_t *view,
+                   se_usize_t              element_size,
+                   se_usize_t              grain,
+                   const void             *identity,
+                   se_usize_t              result_size,
+                   se_parallel_reduce_fn  *reduce,
+                   se_parallel_combine_fn *combine,
+                   void                   *context,
+                   void                   *result);
+
+/**
+ * @brief Вычисляет включающую префиксную свертку массива.
+ *
+ * `output[0] = input[0]`, `output[i] = output[i - 1] ⊕ input[i]`.
+ * Выполняется в два прохода: итоги фрагментов, затем свертка каждого
+ * фрагмента со смещением — итогом всех предыдущих.
+ *
+ * @param[in] pool Пул потоков или `nullptr`.
+ * @param[in] view Входной массив записей.
+ * @param[in] element_size Размер записи в байтах (больше нуля, делит размер массива).
+ * @param[in] grain Размер фрагмента в записях или 0.
+ * @param[in] combine Ассоциативная операция над записями.
+ * @param[in] context Аргумент операции.
+ * @param[out] output Выходной массив того же размера; может совпадать со входным.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_parallel_scan(se_thread_pool_t       *pool,
+                 const se_memory_view_t *view,
+                 se_usize_t              element_size,
+                 se_usize_t              grain,
+                 se_parallel_combine_fn *combine,
+                 void                   *context,
+                 void                   *output);
+
+/**
+ * @brief Вычисляет включающие префиксные суммы массива `se_u64_t`.
+ *
+ * То же, что `se_parallel_scan` со сложением, но без вызова функции
+ * на каждую запись.
+ *
+ * @param[in] pool Пул потоков или `nullptr`.
+ * @param[in] view Входной массив `se_u64_t`.
+ * @param[in] grain Размер фрагмента в записях или 0.
+ * @param[out] output Выходной массив того же размера; может совпадать со входным.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_parallel_prefix_sum_u64(se_thread_pool_t *pool, const se_memory_view_t *view, se_usize_t grain, se_u64_t *output);
+
+/**
+ * @brief Устойчиво сортирует массив записей.
+ *
+ * Сортировка слиянием: половины сортируются параллельно, а крупные
+ * слияния делятся на независимые части двоичным поиском медианы.
+ * Фрагменты размером `grain` сортируются последовательно
+ * (вставками до 16 записей, далее слиянием).
+ *
+ * @param[in] pool Пул потоков или `nullptr`.
+ * @param[in,out] range Массив записей.
+ * @param[in] element_size Размер записи в байтах (больше нуля, делит размер массива).
+ * @param[in] grain Размер последовательно сортируемого фрагмента в записях или 0.
+ * @param[in] compare Функция сравнения.
+ * @param[in] context Аргумент функции сравнения.
+ *
+ * @note Использует дополнительный буфер размером с массив из аллокатора
+ *       времени выполнения.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_parallel_sort(se_thread_pool_t        *pool,
+                 const se_memory_range_t *range,
+                 se_usize_t               element_size,
+                 se_usize_t               grain,
+                 se_parallel_compare_fn  *compare,
+                 void                    *context);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_PARALLEL_H
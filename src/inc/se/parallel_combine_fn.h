@@ -0,0 +1,26 @@
+/**
+ * @file parallel_combine_fn.h
+ * @brief Заголовочный файл для определения типа ассоциативной операции.
+ *
+ * Параллельные алгоритмы применяют операцию в порядке элементов,
+ * но группируют вызовы произвольно, поэтому она должна быть
+ * ассоциативной; коммутативность не требуется.
+ *
+ * @see se_parallel_reduce
+ * @see se_parallel_scan
+ */
+
+#ifndef SE_PARALLEL_COMBINE_FN_H
+#define SE_PARALLEL_COMBINE_FN_H
+
+/**
+ * @typedef se_parallel_combine_fn
+ * @brief Тип ассоциативной операции: `accumulator = accumulator ⊕ value`.
+ *
+ * @param accumulator Левый операнд и результат.
+ * @param value Правый операнд.
+ * @param context Контекст, переданный в алгоритм.
+ */
+typedef void(se_parallel_combine_fn)(void *accumulator, const void *value, void *context);
+
+#endif // SE_PARALLEL_COMBINE_FN_H
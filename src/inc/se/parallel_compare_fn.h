@@ -0,0 +1,23 @@
+/**
+ * @file parallel_compare_fn.h
+ * @brief Заголовочный файл для определения типа функции сравнения записей.
+ *
+ * @see se_parallel_sort
+ */
+
+#ifndef SE_PARALLEL_COMPARE_FN_H
+#define SE_PARALLEL_COMPARE_FN_H
+
+/**
+ * @typedef se_parallel_compare_fn
+ * @brief Тип функции сравнения записей.
+ *
+ * @param lhs Указатель на первую запись.
+ * @param rhs Указатель на вторую запись.
+ * @param context Контекст, переданный в `se_parallel_sort`.
+ * @return Отрицательное значение, ноль или положительное значение,
+ *         если `lhs` меньше, равна или больше `rhs`.
+ */
+typedef int(se_parallel_compare_fn)(const void *lhs, const void *rhs, void *context);
+
+#endif // SE_PARALLEL_COMPARE_FN_H
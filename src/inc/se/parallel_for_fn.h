@@ -0,0 +1,24 @@
+/**
+ * @file parallel_for_fn.h
+ * @brief Заголовочный файл для определения типа функции обработки фрагмента.
+ *
+ * @see se_parallel_for
+ */
+
+#ifndef SE_PARALLEL_FOR_FN_H
+#define SE_PARALLEL_FOR_FN_H
+
+#include "memory_view.h"
+#include "size.h"
+
+/**
+ * @typedef se_parallel_for_fn
+ * @brief Тип функции, обрабатывающей фрагмент массива.
+ *
+ * @param chunk Фрагмент из целого числа элементов.
+ * @param first Индекс первого элемента фрагмента в исходном массиве.
+ * @param context Контекст, переданный в `se_parallel_for`.
+ */
+typedef void(se_parallel_for_fn)(const se_memory_view_t *chunk, se_usize_t first, void *context);
+
+#endif // SE_PARALLEL_FOR_FN_H
@@ -0,0 +1,23 @@
+/**
+ * @file parallel_reduce_fn.h
+ * @brief Заголовочный файл для определения типа функции свертки фрагмента.
+ *
+ * @see se_parallel_reduce
+ */
+
+#ifndef SE_PARALLEL_REDUCE_FN_H
+#define SE_PARALLEL_REDUCE_FN_H
+
+#include "memory_view.h"
+
+/**
+ * @typedef se_parallel_reduce_fn
+ * @brief Тип функции, добавляющей элементы фрагмента к частичному результату.
+ *
+ * @param accumulator Частичный результат; начинается с копии нейтрального элемента.
+ * @param chunk Фрагмент из целого числа элементов.
+ * @param context Контекст, переданный в `se_parallel_reduce`.
+ */
+typedef void(se_parallel_reduce_fn)(void *accumulator, const se_memory_view_t *chunk, void *context);
+
+#endif // SE_PARALLEL_REDUCE_FN_H
@@ -0,0 +1,206 @@
+/**
+ * @file ring_buffer.h
+ * @brief Кольцевой байтовый буфер для одного производителя и одного потребителя.
+ *
+ * Буфер передает байты между двумя потоками без блокировок: производитель
+ * резервирует свободный фрагмент, записывает в него данные на месте
+ * и публикует их (`se_ring_buffer_commit`), потребитель получает
+ * опубликованные данные как `se_memory_view_t` (`se_ring_buffer_peek`)
+ * и освобождает прочитанное (`se_ring_buffer_consume`). Копирование
+ * не требуется ни с одной стороны.
+ *
+ * Позиции записи и чтения — монотонные счетчики, публикуемые парой
+ * release/acquire. Каждая позиция вместе с закэшированной копией позиции
+ * другой стороны лежит в своей кэш-линии, поэтому, пока в кэше достаточно
+ * места или данных, стороны не обращаются к общим кэш-линиям.
+ *
+ * В обычном режиме фрагмент заканчивается на конце буфера, и данные,
+ * пересекающие его, выдаются двумя фрагментами. В зеркальном режиме
+ * (`SE_RING_BUFFER_FLAG_MIRRORED`) память отображена дважды подряд
+ * (см. `se_memory_page_alloc_mirrored`), и любой фрагмент непрерывен.
+ *
+ * Пример использования:
+ * @code
+ * // Поток производителя
+ * se_memory_range_t free = se_ring_buffer_reserve(&ring, 64);
+ * // ... запись до 64 байт в free.begin ...
+ * se_ring_buffer_commit(&ring, 64);
+ *
+ * // Поток потребителя
+ * se_memory_view_t data = se_ring_buffer_peek(&ring, 1);
+ * // ... разбор data ...
+ * se_ring_buffer_consume(&ring, se_memory_view_get_size(&data));
+ * @endcode
+ *
+ * @note Функции производителя (`reserve`, `commit`, `write`) и потребителя
+ *       (`peek`, `consume`, `read`) можно вызывать одновременно только
+ *       из одного потока с каждой стороны.
+ * @see memory_page.h
+ */
+
+#ifndef SE_RING_BUFFER_H
+#define SE_RING_BUFFER_H
+
+#include "memory_range.h"
+#include "memory_view.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "size.h"
+
+/**
+ * @def SE_RING_BUFFER_MIRRORED_MIN_CAPACITY
+ * @brief Минимальная емкость зеркального буфера (гранулярность отображения на Windows).
+ */
+#define SE_RING_BUFFER_MIRRORED_MIN_CAPACITY 65536
+
+/**
+ * @enum se_ring_buffer_flags
+ * @brief Флаги кольцевого буфера.
+ */
+typedef enum se_ring_buffer_flags
+{
+    /** Обычный буфер в памяти аллокатора времени выполнения. */
+    SE_RING_BUFFER_FLAG_NONE = 0,
+
+    /** Память отображается дважды подряд: фрагменты не разрываются на конце буфера. */
+    SE_RING_BUFFER_FLAG_MIRRORED = 1 << 0,
+} se_ring_buffer_flags_t;
+
+/**
+ * @struct se_ring_buffer
+ * @brief Кольцевой буфер.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct se_ring_buffer
+{
+    void      *data;     /**< Память буфера. */
+    se_usize_t capacity; /**< Емкость в байтах (степень двойки). */
+    se_u32_t   flags;    /**< Комбинация `se_ring_buffer_flags_t`. */
+    void      *control;  /**< Позиции сторон, выровненные по кэш-линиям. */
+} se_ring_buffer_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает пустой буфер.
+ *
+ * @param[out] self Указатель на буфер.
+ * @param[in] capacity Емкость в байтах (округляется вверх до степени двойки,
+ *                     в зеркальном режиме — не меньше
+ *                     `SE_RING_BUFFER_MIRRORED_MIN_CAPACITY`).
+ * @param[in] flags Комбинация значений `se_ring_buffer_flags_t`.
+ *
+ * @note При нехватке памяти или ошибке отображения выбрасывает
+ *       `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ring_buffer_init(se_ring_buffer_t *self, se_usize_t capacity, se_u32_t flags);
+
+/**
+ * @brief Освобождает память буфера.
+ * @param[in,out] self Указатель на буфер.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ring_buffer_deinit(se_ring_buffer_t *self);
+
+/**
+ * @brief Резервирует непрерывный свободный фрагмент (производитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[in] min_size Минимальный нужный размер фрагмента.
+ * @return Свободный фрагмент размером не меньше `min_size` (может быть больше)
+ *         или пустой фрагмент, если столько места нет.
+ *
+ * @note В обычном режиме фрагмент не выходит за конец буфера, поэтому
+ *       `min_size` больше остатка до конца не удовлетворяется,
+ *       пока позиция записи не перейдет в начало.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_range_t
+se_ring_buffer_reserve(se_ring_buffer_t *self, se_usize_t min_size);
+
+/**
+ * @brief Публикует `size` байт, записанных в зарезервированный фрагмент (производитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[in] size Количество байт (не больше размера последнего фрагмента).
+ *
+ * @note Если `size` превышает свободное место, выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ring_buffer_commit(se_ring_buffer_t *self, se_usize_t size);
+
+/**
+ * @brief Возвращает непрерывный фрагмент опубликованных данных (потребитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[in] min_size Минимальный нужный размер фрагмента.
+ * @return Данные размером не меньше `min_size` (может быть больше)
+ *         или пустое представление, если столько данных нет.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_view_t
+se_ring_buffer_peek(se_ring_buffer_t *self, se_usize_t min_size);
+
+/**
+ * @brief Освобождает `size` прочитанных байт (потребитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[in] size Количество байт (не больше размера последнего фрагмента).
+ *
+ * @note Если `size` превышает объем данных, выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_ring_buffer_consume(se_ring_buffer_t *self, se_usize_t size);
+
+/**
+ * @brief Копирует байты в буфер, сколько поместится (производитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[in] data Данные.
+ * @param[in] size Размер данных в байтах.
+ * @return Количество записанных байт.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ring_buffer_write(se_ring_buffer_t *self, const void *data, se_usize_t size);
+
+/**
+ * @brief Копирует доступные байты из буфера (потребитель).
+ *
+ * @param[in] self Указатель на буфер.
+ * @param[out] dst Буфер назначения.
+ * @param[in] size Размер буфера назначения в байтах.
+ * @return Количество прочитанных байт.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ring_buffer_read(se_ring_buffer_t *self, void *dst, se_usize_t size);
+
+/**
+ * @brief Возвращает емкость буфера.
+ * @param[in] self Указатель на буфер.
+ * @return Емкость в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ring_buffer_get_capacity(const se_ring_buffer_t *self);
+
+/**
+ * @brief Возвращает объем опубликованных и еще не освобожденных данных.
+ *
+ * @param[in] self Указатель на буфер.
+ * @return Размер данных в байтах; при одновременной работе сторон — приблизительный.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_ring_buffer_get_size(const se_ring_buffer_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_RING_BUFFER_H
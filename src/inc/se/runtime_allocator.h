@@ -0,0 +1,126 @@
+/**
+ * @file runtime_allocator.h
+ * @brief Управление аллокатором памяти времени выполнения.
+ *
+ * Модуль предоставляет:
+ * - Глобальный аллокатор `m_runtime_allocator`, через который библиотека получает память.
+ * - Функции `se_runtime_allocator_alloc()`, `se_runtime_allocator_alloc_aligned()`,
+ *   `se_runtime_allocator_alloc_zeroed()` и `se_runtime_allocator_dealloc()`.
+ * - Функцию `se_runtime_allocator_set()` для переопределения аллокатора.
+ *
+ * Поведение зависит от опции CMake `SE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB`:
+ * - Если `ON`, аллокатор по умолчанию — `malloc()`/`free()`
+ *   (выровненные блоки — `posix_memalign()`, на Windows — `_aligned_malloc()`,
+ *   обнуленные — `calloc()`).
+ * - Если `OFF`, функции аллокатора инициализируются как `nullptr` (требует явной настройки).
+ *
+ * @warning Память должна освобождаться тем же аллокатором, которым была выделена.
+ *          Замена аллокатора при наличии живых блоков допустима только если
+ *          новый аллокатор умеет освобождать блоки старого.
+ */
+
+#ifndef SE_RUNTIME_ALLOCATOR_H
+#define SE_RUNTIME_ALLOCATOR_H
+
+#include "memory_allocator.h"
+#include "attribute.h"
+
+/**
+ * @def SE_RUNTIME_ALLOCATOR_ALIGNMENT
+ * @brief Выравнивание, которое гарантирует функция `alloc` любого аллокатора.
+ *
+ * Запросы с таким или меньшим выравниванием обслуживаются функцией `alloc`,
+ * даже если аллокатор не предоставляет `alloc_aligned`.
+ */
+#define SE_RUNTIME_ALLOCATOR_ALIGNMENT (2 * sizeof(void *))
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Устанавливает аллокатор времени выполнения.
+ *
+ * @param[in] allocator Новый аллокатор (копируется).
+ * @return Предыдущий аллокатор.
+ *
+ * Пример использования:
+ * @code
+ * const se_memory_allocator_t my = {my_alloc, my_free};
+ * se_memory_allocator_t old = se_runtime_allocator_set(&my);
+ * // ...
+ * se_runtime_allocator_set(&old); // восстановление
+ * @endcode
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_allocator_t
+se_runtime_allocator_set(const se_memory_allocator_t *allocator);
+
+/**
+ * @brief Возвращает текущий аллокатор времени выполнения.
+ * @return Указатель на текущий аллокатор.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const se_memory_allocator_t *
+se_runtime_allocator_get(void);
+
+/**
+ * @brief Выделяет блок памяти через аллокатор времени выполнения.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @return Указатель на выделенный блок.
+ *
+ * @note Выбрасывает `SE_RUNTIME_ERROR_NULL_POINTER`, если аллокатор не установлен,
+ *       и `SE_RUNTIME_ERROR_OUT_OF_MEMORY`, если аллокатор вернул `nullptr`.
+ * @note При включенной опции `SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`
+ *       блок заполняется нулями (см. `se_runtime_allocator_alloc_zeroed()`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_runtime_allocator_alloc(se_usize_t size);
+
+/**
+ * @brief Выделяет заполненный нулями блок памяти через аллокатор времени выполнения.
+ *
+ * Если аллокатор предоставляет `alloc_zeroed`, обнуление поручается ему:
+ * он пропускает `se_memory_set` для памяти, о которой известно, что она
+ * уже нулевая (свежие страницы операционной системы). Иначе блок
+ * выделяется функцией `alloc` и обнуляется явно.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @return Указатель на выделенный блок.
+ *
+ * @note Выбрасывает те же исключения, что и `se_runtime_allocator_alloc()`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_runtime_allocator_alloc_zeroed(se_usize_t size);
+
+/**
+ * @brief Выделяет выровненный блок памяти через аллокатор времени выполнения.
+ *
+ * @param[in] size Размер блока в байтах.
+ * @param[in] alignment Выравнивание начала блока (степень двойки).
+ * @return Указатель на выделенный блок, кратный `alignment`.
+ *
+ * @note Блок освобождается через `se_runtime_allocator_dealloc()`.
+ * @note Выбрасывает `SE_RUNTIME_ERROR_INVALID_ARGUMENT`, если `alignment` не степень двойки,
+ *       `SE_RUNTIME_ERROR_NULL_POINTER`, если аллокатор не умеет выделять блоки
+ *       с выравниванием больше `SE_RUNTIME_ALLOCATOR_ALIGNMENT`,
+ *       и `SE_RUNTIME_ERROR_OUT_OF_MEMORY`, если аллокатор вернул `nullptr`.
+ * @note При включенной опции `SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`
+ *       блок заполняется нулями.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void *
+se_runtime_allocator_alloc_aligned(se_usize_t size, se_usize_t alignment);
+
+/**
+ * @brief Освобождает блок памяти через аллокатор времени выполнения.
+ * @param[in] ptr Указатель на блок (допускается `nullptr`).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_runtime_allocator_dealloc(void *ptr);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_RUNTIME_ALLOCATOR_H
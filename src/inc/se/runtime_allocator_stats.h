@@ -0,0 +1,106 @@
+/**
+ * @file runtime_allocator_stats.h
+ * @brief Статистика выделений аллокатора времени выполнения.
+ *
+ * При включенной опции `SE_LIBRARY_OPTION_ALLOC_STATS` аллокатор времени
+ * выполнения учитывает каждое выделение и освобождение: объем живой памяти,
+ * ее пиковое значение, количество операций и гистограмму размеров
+ * по степеням двойки.
+ *
+ * Счетчики ведутся раздельно для каждого потока: поток пишет только
+ * в собственный блок счетчиков, поэтому учет не требует атомарных
+ * read-modify-write операций и блокировок. Блоки потоков связаны
+ * в глобальный список и суммируются по запросу функцией
+ * `se_runtime_allocator_stats_snapshot()`.
+ *
+ * При выключенной опции учет полностью исключается из сборки,
+ * а функции снимков возвращают нулевую статистику.
+ *
+ * @note Учитываются только блоки, прошедшие через `se_runtime_allocator_*`.
+ * @see runtime_allocator.h
+ */
+
+#ifndef SE_RUNTIME_ALLOCATOR_STATS_H
+#define SE_RUNTIME_ALLOCATOR_STATS_H
+
+#include "attribute.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @def SE_RUNTIME_ALLOCATOR_STATS_HISTOGRAM_SIZE
+ * @brief Количество корзин гистограммы размеров.
+ *
+ * Корзина `i` считает выделения размером от `2^i` до `2^(i + 1) - 1` байт,
+ * выделения нулевого размера попадают в корзину 0.
+ */
+#define SE_RUNTIME_ALLOCATOR_STATS_HISTOGRAM_SIZE 64
+
+/**
+ * @def SE_RUNTIME_ALLOCATOR_STATS_PEAK_GRANULARITY
+ * @brief Точность учета пикового объема в байтах на один поток.
+ *
+ * Поток публикует изменение объема живой памяти в общий счетчик,
+ * когда накопленное изменение достигает этой величины.
+ */
+#define SE_RUNTIME_ALLOCATOR_STATS_PEAK_GRANULARITY (64 * 1024)
+
+/**
+ * @struct se_runtime_allocator_stats
+ * @brief Снимок статистики выделений.
+ */
+typedef struct se_runtime_allocator_stats
+{
+    se_u64_t live_bytes;    /**< Объем выделенной и еще не освобожденной памяти. */
+    se_u64_t peak_bytes;    /**< Наибольший наблюдавшийся объем живой памяти. */
+    se_u64_t alloc_count;   /**< Количество выделений. */
+    se_u64_t dealloc_count; /**< Количество освобождений. */
+    se_u64_t thread_count;  /**< Количество потоков, выполнявших выделения. */
+
+    /** Количество выделений по корзинам размеров (log2). */
+    se_u64_t histogram[SE_RUNTIME_ALLOCATOR_STATS_HISTOGRAM_SIZE];
+} se_runtime_allocator_stats_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Проверяет, включен ли учет статистики в сборке библиотеки.
+ * @return `true`, если библиотека собрана с `SE_LIBRARY_OPTION_ALLOC_STATS`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_runtime_allocator_stats_is_enabled(void);
+
+/**
+ * @brief Суммирует счетчики всех потоков.
+ *
+ * Счетчики читаются без остановки других потоков, поэтому снимок
+ * согласован лишь приблизительно: операции, выполняемые во время
+ * его построения, могут быть учтены частично.
+ *
+ * @param[out] stats Указатель на структуру для результата.
+ *
+ * @note Пиковое значение точно с погрешностью
+ *       `SE_RUNTIME_ALLOCATOR_STATS_PEAK_GRANULARITY` на каждый поток.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_runtime_allocator_stats_snapshot(se_runtime_allocator_stats_t *stats);
+
+/**
+ * @brief Возвращает счетчики текущего потока.
+ *
+ * Объем живой памяти потока равен разности выделенного им и освобожденного
+ * им же и может быть отрицательным в знаковой интерпретации, если поток
+ * освобождает блоки, выделенные другими потоками. Пиковое значение
+ * для отдельного потока не ведется и равно нулю.
+ *
+ * @param[out] stats Указатель на структуру для результата.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_runtime_allocator_stats_thread(se_runtime_allocator_stats_t *stats);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_RUNTIME_ALLOCATOR_STATS_H
@@ -16,11 +16,75 @@
 #define SE_RUNTIME_CHECK_H
 
 #include "runtime_throw_with_code.h"
+#include "runtime_error_code.h"
+
+/**
+ * @def SE_RUNTIME_CHECK_LEVEL_NONE
+ * @brief Проверки предусловий отключены.
+ *
+ * Остаются только проверки отказов окружения (нехватка памяти,
+ * ввод-вывод, прерывание), которые нельзя исключить проверкой входных данных.
+ */
+#define SE_RUNTIME_CHECK_LEVEL_NONE 0
+
+/**
+ * @def SE_RUNTIME_CHECK_LEVEL_BOUNDARY
+ * @brief Сохраняются только проверки границ.
+ *
+ * Дополнительно к уровню `SE_RUNTIME_CHECK_LEVEL_NONE` проверяются выход
+ * за пределы диапазона (`SE_RUNTIME_ERROR_OUT_OF_RANGE`) и недопустимый
+ * диапазон памяти (`SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE`).
+ */
+#define SE_RUNTIME_CHECK_LEVEL_BOUNDARY 1
+
+/**
+ * @def SE_RUNTIME_CHECK_LEVEL_FULL
+ * @brief Выполняются все проверки (уровень по умолчанию).
+ */
+#define SE_RUNTIME_CHECK_LEVEL_FULL 2
+
+/**
+ * @def SE_RUNTIME_CHECK_LEVEL
+ * @brief Уровень проверок, с которым собирается код.
+ *
+ * Задается опцией `SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL`; без нее
+ * выполняются все проверки.
+ */
+#ifdef SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL
+#    define SE_RUNTIME_CHECK_LEVEL SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL
+#else
+#    define SE_RUNTIME_CHECK_LEVEL SE_RUNTIME_CHECK_LEVEL_FULL
+#endif // SE_LIBRARY_OPTION_RUNTIME_CHECK_LEVEL
+
+/**
+ * @def se_runtime_check_is_enabled
+ * @brief Проверяет, выполняется ли проверка с кодом `code` на текущем уровне.
+ *
+ * Код ошибки в местах вызова — константа, поэтому отключенная проверка
+ * сворачивается компилятором вместе с вычислением условия.
+ *
+ * @param code Код ошибки проверки.
+ */
+#if SE_RUNTIME_CHECK_LEVEL >= SE_RUNTIME_CHECK_LEVEL_FULL
+#    define se_runtime_check_is_enabled(code) 1
+#elif SE_RUNTIME_CHECK_LEVEL == SE_RUNTIME_CHECK_LEVEL_BOUNDARY
+#    define se_runtime_check_is_enabled(code)                                                      \
+        ((code) != SE_RUNTIME_ERROR_NULL_POINTER && (code) != SE_RUNTIME_ERROR_INVALID_ARGUMENT)
+#else
+#    define se_runtime_check_is_enabled(code)                                                      \
+        ((code) != SE_RUNTIME_ERROR_NULL_POINTER && (code) != SE_RUNTIME_ERROR_INVALID_ARGUMENT && \
+         (code) != SE_RUNTIME_ERROR_OUT_OF_RANGE && (code) != SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)
+#endif // SE_RUNTIME_CHECK_LEVEL
 
 /**
  * @def se_runtime_check_if
  * @brief Проверяет условие и выбрасывает исключение, если оно истинно.
  *
+ * Условие помечено как маловероятное, а выброс — вызов холодной функции,
+ * поэтому в горячем пути остаются только сравнение и непройденный переход.
+ * Проверки, отключенные уровнем `SE_RUNTIME_CHECK_LEVEL`, не вычисляют
+ * условие вовсе.
+ *
  * @param expr Выражение для проверки.
  * @param code Код ошибки для выбрасывания, если условие истинно.
  *
@@ -33,7 +97,7 @@
  * @see se_runtime_throw_with_code
  */
 #define se_runtime_check_if(expr, code)                                                            \
-    if (expr)                                                                                      \
+    if (se_runtime_check_is_enabled(code) && se_compiler_unlikely(expr))                           \
     se_runtime_throw_with_code(code)
 
 /**
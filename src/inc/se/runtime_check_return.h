@@ -0,0 +1,79 @@
+/**
+ * @file runtime_check_return.h
+ * @brief Макросы проверок, сообщающих об ошибке кодом вместо исключения.
+ *
+ * Аналог runtime_check.h для функций с суффиксом `_r`: при нарушении
+ * условия код ошибки записывается в `se_error_t`, а функция возвращает
+ * заданное значение. Ни `se_runtime_try`, ни `longjmp` не нужны, поэтому
+ * вызывающий код остается обычным кодом с ранними выходами, который
+ * компилятор оптимизирует без ограничений.
+ *
+ * - `se_runtime_check_return_if`:
+ *   Сообщает об ошибке, если выражение истинно.
+ *
+ * - `se_runtime_check_return_ifn` и `se_runtime_check_return`:
+ *   Сообщают об ошибке, если выражение ложно.
+ *
+ * Проверки подчиняются уровню `SE_RUNTIME_CHECK_LEVEL` так же, как
+ * `se_runtime_check`.
+ *
+ * @see runtime_check.h
+ */
+
+#ifndef SE_RUNTIME_CHECK_RETURN_H
+#define SE_RUNTIME_CHECK_RETURN_H
+
+#include "runtime_return.h"
+#include "runtime_check.h"
+#include "nullptr.h"
+#include "error.h"
+
+/**
+ * @def se_runtime_check_return_if
+ * @brief Записывает код ошибки и выходит из функции, если условие истинно.
+ *
+ * @param expr Выражение для проверки.
+ * @param error Указатель на `se_error_t` для кода ошибки или `nullptr`,
+ *              если код не нужен. При успехе не изменяется.
+ * @param error_code Код ошибки.
+ * @param ... Значение, возвращаемое при ошибке (пусто для `void`).
+ *
+ * Пример использования:
+ * @code
+ * se_runtime_check_return_if(ptr == nullptr, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+ * @endcode
+ */
+#define se_runtime_check_return_if(expr, error, error_code, ...)                                   \
+    if (se_runtime_check_is_enabled(error_code) && se_compiler_unlikely(expr))                     \
+    {                                                                                              \
+        if (error)                                                                                 \
+        {                                                                                          \
+            (error)->code = (error_code);                                                          \
+            (error)->desc = nullptr;                                                               \
+        }                                                                                          \
+        se_runtime_return(__VA_ARGS__);                                                            \
+    }
+
+/**
+ * @def se_runtime_check_return_ifn
+ * @brief Записывает код ошибки и выходит из функции, если условие ложно.
+ *
+ * @see se_runtime_check_return_if
+ */
+#define se_runtime_check_return_ifn(expr, error, error_code, ...)                                  \
+    se_runtime_check_return_if(!(expr), error, error_code, __VA_ARGS__)
+
+/**
+ * @def se_runtime_check_return
+ * @brief Основной макрос проверки (псевдоним для se_runtime_check_return_ifn).
+ *
+ * Пример использования:
+ * @code
+ * se_runtime_check_return(index < size, error, SE_RUNTIME_ERROR_OUT_OF_RANGE, nullptr);
+ * @endcode
+ *
+ * @see se_runtime_check_return_ifn
+ */
+#define se_runtime_check_return(...) se_runtime_check_return_ifn(__VA_ARGS__)
+
+#endif // SE_RUNTIME_CHECK_RETURN_H
@@ -74,6 +74,26 @@ typedef enum se_runtime_error_code
      * обратиться к области памяти, которая недоступна или невалидна.
      */
     SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE,
+
+    /**
+     * @var SE_RUNTIME_ERROR_OUT_OF_MEMORY
+     * @brief Ошибка: недостаточно памяти.
+     *
+     * Этот код ошибки указывает на то, что запрос на выделение памяти
+     * не может быть удовлетворен: исчерпан буфер арены, пула
+     * или системный аллокатор вернул нулевой указатель.
+     */
+    SE_RUNTIME_ERROR_OUT_OF_MEMORY,
+
+    /**
+     * @var SE_RUNTIME_ERROR_IO
+     * @brief Ошибка: сбой ввода-вывода.
+     *
+     * Этот код ошибки указывает на то, что операционная система
+     * отказала в операции с файлом: файл не найден, недоступен
+     * или не может быть отображен в память.
+     */
+    SE_RUNTIME_ERROR_IO,
 } se_runtime_error_code_t;
 
 #endif // SE_RUNTIME_ERROR_CODE_H
\ No newline at end of file
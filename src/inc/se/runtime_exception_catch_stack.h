@@ -3,12 +3,16 @@
  * @brief Механизм обработки исключений времени выполнения.
  *
  * Данный модуль предоставляет:
- * - Стек фреймов исключений с ограниченной глубиной.
+ * - Стек фреймов исключений без ограничения глубины.
  * - Функции для управления контекстами исключений.
  * - Механизм нелокальных переходов при возникновении ошибок.
  * - Поддержку отладочной информации в DEBUG-сборках.
  *
- * @note Максимальная глубина стека определяется `SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX`.
+ * Фреймы (`se_exception_catch_t`) размещаются в автоматической памяти
+ * try-блоков и связываются через поле `prev`. В потоковой памяти хранятся
+ * лишь два указателя: вершина стека и последний снятый фрейм. Добавление
+ * и снятие фрейма выполняются за O(1).
+ *
  * @warning Требует аккуратного использования для поддержания целостности стека.
  */
 
@@ -24,9 +28,10 @@
  * @brief Макрос для захвата контекста выполнения
  *        и установки обработчика исключений.
  *
- * Объединяет операции `push` и `setjmp` в единую атомарную операцию:
+ * Объединяет операции `push` и `se_jump_buffer_save` в единую атомарную операцию:
  * 1. Помещает фрейм исключения в стек обработчиков.
- * 2. Захватывает текущий контекст выполнения с помощью `setjmp`.
+ * 2. Захватывает текущий контекст выполнения с помощью `se_jump_buffer_save`
+ *    (`setjmp` или сохранение регистров, см. jump_buffer.h).
  * 3. Возвращает точку входа для обработки исключений.
  *
  * @param x Указатель на фрейм исключения (`se_exception_catch_t*`).
@@ -47,99 +52,58 @@
  * @see se_runtime_exception_catch_stack_throw()
  */
 #define se_runtime_exception_catch_stack_capture(x)                                                \
-    setjmp(se_runtime_exception_catch_stack_push(x)->env)
+    se_jump_buffer_save(se_runtime_exception_catch_stack_push(x)->env)
 
 SE_COMPILER(EXTERN_C_BEGIN)
 
 /**
- * @brief Получить текущий активный фрейм исключения из стека обработки исключений.
+ * @brief Возвращает последний снятый со стека фрейм исключения.
  *
- * Функция возвращает указатель на текущий активный фрейм исключения в потоке.
- * Фрейм исключения представляет собой контекст обработки исключения
- * в текущей точке программы.
+ * После перехода в обработчик это фрейм, который перехватил исключение:
+ * из него `se_runtime_exception_catch_stack_rethrow()` берет исключение
+ * для повторного выбрасывания.
  *
- * @return se_exception_catch_t* Указатель на текущий фрейм исключения.
+ * @return se_exception_catch_t* Указатель на последний снятый фрейм
+ *         или nullptr, если фреймы еще не снимались.
  */
 se_exception_catch_t *
 se_runtime_exception_catch_stack_get_current(void);
 
 /**
- * @brief Проверяет, находится ли механизм обработки исключений в начальном состоянии.
- *
- * Функция проверяет, указывает ли текущий указатель исключения (`m_runtime_exception`)
- * на начало массива фреймов исключений (`m_runtime_exceptions`).
- * Это означает, что стек исключений пуст и нет активных обработчиков исключений.
+ * @brief Проверяет, пуст ли стек обработчиков исключений.
  *
- * @return true - если указатель исключения находится
- *                в начальной позиции (нет активных обработчиков).
+ * @return true - если в потоке нет активных обработчиков исключений.
  * @return false - если есть хотя бы один активный обработчик исключения.
  */
 bool
 se_runtime_exception_catch_stack_is_begin(void);
 
 /**
- * @brief Проверяет, достигнут ли максимальный уровень вложенности обработки исключений
- *
- * Функция определяет, достиг ли указатель текущего исключения (`m_runtime_exception`)
- * конца массива фреймов исключений. Это означает, что стек обработчиков исключений
- * заполнен до максимально возможного уровня (`SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX`).
- *
- * @return true - если достигнут максимальный уровень вложенности обработчиков исключений.
- * @return false - если есть возможность добавить новые обработчики исключений.
- */
-bool
-se_runtime_exception_catch_stack_is_end(void);
-
-/**
- * @brief Перемещает указатель на следующий фрейм исключения и возвращает его.
- *
- * Функция выполняет следующие действия:
- * 1. Проверяет возможность перемещения (не достигнут ли конец стека исключений).
- * 2. Если перемещение возможно - увеличивает указатель текущего исключения.
- * 3. Возвращает новый текущий фрейм исключения.
- *
- * @return Указатель на следующий фрейм исключения, если перемещение успешно.
- * @return nullptr если достигнут максимальный уровень вложенности (конец стека).
- *
- * @note Используется для установки нового обработчика исключений.
- * @warning Перед вызовом необходимо убедиться в доступности
- *          следующего фрейма с помощью `se_runtime_exception_catch_stack_is_end()`.
- */
-se_exception_catch_t *
-se_runtime_exception_catch_stack_next(void);
-
-/**
- * @brief Перемещает указатель на предыдущий фрейм исключения и возвращает его.
+ * @brief Снимает фрейм с вершины стека и возвращает его.
  *
- * Функция выполняет следующие действия:
- * 1. Проверяет, не находится ли указатель в начальном положении.
- * 2. Если перемещение возможно - уменьшает указатель текущего исключения.
- * 3. Возвращает новый текущий фрейм исключения.
+ * Вершиной становится внешний фрейм (`prev`), а снятый фрейм
+ * запоминается как текущий (см. `se_runtime_exception_catch_stack_get_current()`).
  *
- * @return Указатель на предыдущий фрейм исключения, если перемещение успешно.
- * @return nullptr если указатель находится в начальном положении (нет активных обработчиков).
+ * @return Указатель на снятый фрейм исключения.
+ * @return nullptr если стек пуст (нет активных обработчиков).
  *
- * @note Используется при завершении обработки исключения для возврата к предыдущему контексту.
- * @warning Перед вызовом необходимо убедиться, что указатель не в начальном положении.
- *          с помощью `se_runtime_exception_catch_stack_is_begin()`.
+ * @note Используется при завершении try-блока и при выбрасывании исключения.
  */
 se_exception_catch_t *
 se_runtime_exception_catch_stack_prev(void);
 
 /**
- * @brief Добавляет фрейм исключения в стек обработчиков.
+ * @brief Добавляет фрейм исключения на вершину стека обработчиков.
  *
- * Функция выполняет следующие действия:
- * 1. Проверяет доступность места в стеке исключений.
- * 2. Сохраняет переданный фрейм исключения в текущей позиции.
- * 3. Перемещает указатель на следующую позицию в стеке.
+ * Связывает фрейм с текущей вершиной через поле `prev`
+ * и делает его новой вершиной.
  *
  * @param e Указатель на фрейм исключения для добавления в стек.
- * @return Указатель на добавленный фрейм исключения в случае успеха.
- * @return nullptr если стек исключений заполнен (достигнут `SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX`).
+ * @return Указатель на добавленный фрейм исключения.
  *
  * @note Используется при входе в блок `try` для регистрации обработчика исключений.
- * @warning Необходимо гарантировать, что каждый `push` будет сбалансирован соответствующим `pop`.
+ * @warning Необходимо гарантировать, что каждый `push` будет сбалансирован
+ *          соответствующим `pop`, пока фрейм находится в области видимости.
  */
 se_exception_catch_t *
 se_runtime_exception_catch_stack_push(se_exception_catch_t *e);
@@ -149,10 +113,11 @@ se_runtime_exception_catch_stack_push(se_exception_catch_t *e);
  *
  * Функция выполняет нелокальный переход
  * к последнему зарегистрированному обработчику исключений:
- * 1. Получает предыдущий фрейм исключения из стека.
+ * 1. Снимает фрейм с вершины стека обработчиков.
  * 2. Копирует информацию об исключении в фрейм.
- * 3. Выполняет переход через `longjmp` к точке обработки.
- * 4. Если обработчиков нет - аварийно завершает программу.
+ * 3. Если к фрейму привязана арена - откатывает ее к отметке фрейма.
+ * 4. Выполняет переход через `se_jump_buffer_restore` к точке обработки.
+ * 5. Если обработчиков нет - аварийно завершает программу.
  *
  * @param exception Указатель на объект исключения для передачи обработчику.
  * @note Принудительно встраиваемая функция для оптимизации критичного пути.
@@ -168,16 +133,58 @@ se_runtime_exception_catch_stack_throw(const se_exception_t *exception)
     if (prev)
     {
         prev->exception = *exception;
-        longjmp(prev->env, se_error_get_code((se_error_t *)prev));
+        if (prev->arena)
+        {
+            prev->arena->cur = prev->arena_mark;
+        }
+        se_jump_buffer_restore(prev->env, se_error_get_code((se_error_t *)prev));
     }
     se_runtime_terminate();
 }
 
+/**
+ * @brief Выбрасывает исключение с кодом ошибки из одной внешней функции.
+ *
+ * Используется `se_runtime_throw_with_code` и, следовательно, всеми
+ * `se_runtime_check`: в месте вызова остается только передача кода
+ * и вызов, а сборка исключения и переход находятся в единственном теле
+ * функции, которое компилятор размещает вдали от горячего кода.
+ *
+ * @param code Код ошибки.
+ */
+SE_ATTRIBUTE(SYMBOL)
+SE_ATTRIBUTE(NOINLINE)
+SE_ATTRIBUTE(COLD)
+SE_ATTRIBUTE(NORETURN)
+void
+se_runtime_exception_catch_stack_throw_code(se_error_code_t code);
+
+/**
+ * @brief Выбрасывает исключение с кодом ошибки и местом выброса.
+ *
+ * Вариант `se_runtime_exception_catch_stack_throw_code()` для DEBUG-сборок:
+ * заполняет трассировку исключения (`se_exception_trace_t`).
+ *
+ * @param code Код ошибки.
+ * @param timestamp Значение `__TIMESTAMP__` в месте выброса.
+ * @param filename Значение `__FILE__` в месте выброса.
+ * @param function Значение `__FUNCTION__` в месте выброса.
+ */
+SE_ATTRIBUTE(SYMBOL)
+SE_ATTRIBUTE(NOINLINE)
+SE_ATTRIBUTE(COLD)
+SE_ATTRIBUTE(NORETURN)
+void
+se_runtime_exception_catch_stack_throw_trace(se_error_code_t code,
+                                             const char     *timestamp,
+                                             const char     *filename,
+                                             const char     *function);
+
 /**
  * @brief Повторно выбрасывает текущее исключение вверх по стеку обработчиков.
  *
  * Функция выполняет следующие действия:
- * 1. Получает текущий фрейм исключения из стека обработчиков.
+ * 1. Получает фрейм, перехвативший исключение (последний снятый).
  * 2. Повторно выбрасывает содержащееся в нем исключение с помощью
  *    `se_runtime_exception_catch_stack_throw()`.
  *
@@ -27,7 +27,9 @@
  * параметров, когда требуется передать только код ошибки без дополнительных данных.
  *
  * @param code Код ошибки типа se_error_code_t (например, `SE_ERROR_INVALID_ARGUMENT`).
- * @note Фактически является алиасом для вызова `se_runtime_throw(code)`.
+ * @note Действует как `se_runtime_throw(code)`, но вызывает внешнюю холодную
+ *       функцию `se_runtime_exception_catch_stack_throw_code()`: исключение
+ *       не собирается и переход не встраивается в каждое место вызова.
  *
  * Пример использования:
  * @code
@@ -40,6 +42,11 @@
  * @see se_runtime_throw
  * @see se_runtime_exception_catch_stack_throw_error
  */
-#define se_runtime_throw_with_code(code) se_runtime_throw(code)
+#ifdef SE_COMPILE_OPTION_DEBUG
+#    define se_runtime_throw_with_code(code)                                                       \
+        se_runtime_exception_catch_stack_throw_trace(code, __TIMESTAMP__, __FILE__, __FUNCTION__)
+#else
+#    define se_runtime_throw_with_code(code) se_runtime_exception_catch_stack_throw_code(code)
+#endif // SE_COMPILE_OPTION_DEBUG
 
 #endif // SE_RUNTIME_THROW_WITH_CODE_H
\ No newline at end of file
@@ -12,7 +12,8 @@
  * - Поддержка вложенных обработчиков
  * - Интеграция с системой возврата значений
  *
- * @note Максимальная глубина вложенности определяется `SE_RUNTIME_EXCEPTION_CATCH_STACK_MAX`.
+ * @note Глубина вложенности не ограничена: фреймы связываются в список
+ *       прямо в автоматической памяти try-блоков.
  * @warning Для корректной работы требуется парное использование `try/catch`.
  */
 
@@ -52,6 +53,39 @@
     se_exception_catch_t e = {};                                                                   \
     if (se_runtime_exception_catch_stack_capture(&e) == 0)
 
+/**
+ * @def se_runtime_try_with_arena
+ * @brief Макрос для организации try-блока, привязанного к арене памяти.
+ *
+ * Аналогичен `se_runtime_try`, но дополнительно запоминает отметку арены `a`
+ * во фрейме исключения. Если внутри блока будет выброшено исключение,
+ * арена автоматически откатится к этой отметке до перехода в обработчик,
+ * и вся память, выделенная из нее внутри блока, будет освобождена.
+ *
+ * @param e Имя переменной фрейма исключения (автоматически создаваемой)
+ * @param a Указатель на арену (`se_memory_arena_t*`), вычисляется один раз
+ *          и сохраняется в переменной `e_arena`
+ *
+ * @note При нормальном завершении блока арена не откатывается:
+ *       выделенные блоки остаются действительными.
+ *
+ * Пример использования:
+ * @code
+ * se_runtime_try_with_arena(frame, &scratch) {
+ *     void *tmp = se_memory_arena_alloc(&scratch, 256);
+ *     // Код, который может вызвать исключение
+ *     se_runtime_try_finalize();
+ * }
+ * @endcode
+ *
+ * @see se_runtime_try()
+ * @see se_memory_arena_get_mark()
+ */
+#define se_runtime_try_with_arena(e, a)                                                            \
+    se_memory_arena_t   *e##_arena = (a);                                                          \
+    se_exception_catch_t e = {.arena = e##_arena, .arena_mark = se_memory_arena_get_mark(e##_arena)}; \
+    if (se_runtime_exception_catch_stack_capture(&e) == 0)
+
 /**
  * @def se_runtime_try_finalize
  * @brief Макрос для завершения блока обработки исключений
@@ -0,0 +1,144 @@
+/**
+ * @file rwlock.h
+ * @brief Блокировка чтения-записи с приоритетом писателей.
+ *
+ * Состояние — одно 32-битное слово: число читателей (или особое значение
+ * «захвачено писателем») в младших 30 битах и флаги «ждут читатели»,
+ * «ждут писатели» в старших. Захват без конкуренции — один CAS,
+ * освобождение — одна атомарная операция без системного вызова,
+ * если никто не ждет.
+ *
+ * Приоритет писателей: пока хотя бы один писатель ждет, новые читатели
+ * не входят, даже если блокировка удерживается читателями. Поэтому
+ * непрерывный поток читателей не может бесконечно задерживать писателя.
+ * Освобождающий поток будит одного писателя, а читателей — только
+ * когда ждущих писателей нет.
+ *
+ * Перед засыпанием на futex (см. futex.h) потоки крутятся
+ * `SE_RWLOCK_SPIN_COUNT` итераций. Писатели спят на отдельном слове-счетчике,
+ * чтобы пробуждение одного писателя не будило читателей.
+ *
+ * Пример использования:
+ * @code
+ * se_rwlock_t lock;
+ * se_rwlock_init(&lock, nullptr);
+ *
+ * se_rwlock_read_lock(&lock);
+ * // чтение общих данных
+ * se_rwlock_read_unlock(&lock);
+ *
+ * se_rwlock_write_lock(&lock);
+ * // изменение общих данных
+ * se_rwlock_write_unlock(&lock);
+ * @endcode
+ *
+ * @note Блокировка не рекурсивна: повторный захват на чтение потоком,
+ *       который уже читает, может ждать писателя вечно.
+ * @see lock_stats.h
+ */
+
+#ifndef SE_RWLOCK_H
+#define SE_RWLOCK_H
+
+#include "lock_stats.h"
+#include "atomic_type.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "bool.h"
+
+/**
+ * @def SE_RWLOCK_SPIN_COUNT
+ * @brief Количество попыток с паузой перед засыпанием.
+ */
+#define SE_RWLOCK_SPIN_COUNT 128
+
+/**
+ * @def SE_RWLOCK_MAX_READERS
+ * @brief Наибольшее количество одновременных читателей.
+ */
+#define SE_RWLOCK_MAX_READERS ((1u << 30) - 2)
+
+/**
+ * @struct se_rwlock
+ * @brief Блокировка чтения-записи.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_rwlock
+{
+    se_atomic_u32_t  state;         /**< Читатели или писатель и флаги ожидающих. */
+    se_atomic_u32_t  writer_notify; /**< Счетчик пробуждений писателей (слово futex). */
+    se_atomic_u32_t  writer_count;  /**< Писатели на медленном пути захвата. */
+    se_lock_stats_t *stats;         /**< Счетчики конкуренции или `nullptr`. */
+} se_rwlock_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает свободную блокировку.
+ *
+ * @param[out] self Указатель на блокировку.
+ * @param[in] stats Счетчики конкуренции или `nullptr`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_rwlock_init(se_rwlock_t *self, se_lock_stats_t *stats);
+
+/**
+ * @brief Захватывает блокировку на чтение.
+ *
+ * @param[in] self Указатель на блокировку.
+ *
+ * @note При превышении `SE_RWLOCK_MAX_READERS` выбрасывает `SE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_rwlock_read_lock(se_rwlock_t *self);
+
+/**
+ * @brief Захватывает блокировку на чтение, если нет писателя и ждущих.
+ *
+ * @param[in] self Указатель на блокировку.
+ * @return `false`, если захват пришлось бы ждать.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_rwlock_try_read_lock(se_rwlock_t *self);
+
+/**
+ * @brief Освобождает блокировку, захваченную на чтение.
+ * @param[in] self Указатель на блокировку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_rwlock_read_unlock(se_rwlock_t *self);
+
+/**
+ * @brief Захватывает блокировку на запись.
+ * @param[in] self Указатель на блокировку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_rwlock_write_lock(se_rwlock_t *self);
+
+/**
+ * @brief Захватывает блокировку на запись, если она свободна.
+ *
+ * @param[in] self Указатель на блокировку.
+ * @return `false`, если блокировка захвачена.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_rwlock_try_write_lock(se_rwlock_t *self);
+
+/**
+ * @brief Освобождает блокировку, захваченную на запись.
+ * @param[in] self Указатель на блокировку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_rwlock_write_unlock(se_rwlock_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_RWLOCK_H
@@ -0,0 +1,246 @@
+/**
+ * @file string.h
+ * @brief Байтовая строка с оптимизацией коротких строк.
+ *
+ * Строка занимает три машинных слова. Строки длиной до
+ * `SE_STRING_INLINE_CAPACITY` байт (23 на 64-битных платформах) хранятся
+ * прямо в структуре и не требуют выделения памяти; более длинные — в блоке
+ * аллокатора времени выполнения, емкость которого растет геометрически
+ * с коэффициентом `SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000`.
+ *
+ * Последний байт структуры различает режимы: во встроенном режиме он хранит
+ * `SE_STRING_INLINE_CAPACITY - size` и при полностью заполненной строке
+ * служит ее нулевым терминатором; в режиме кучи он равен `SE_STRING_HEAP_TAG`.
+ * Емкость блока кучи хранится в заголовке перед данными, поэтому в самой
+ * структуре остаются только указатель и размер.
+ *
+ * Содержимое всегда завершено нулевым байтом и доступно как `se_memory_view_t`.
+ * Поиск и сравнение выполняются функциями memory.h (векторный поиск
+ * `se_memory_find`).
+ *
+ * Пример использования:
+ * @code
+ * se_string_t str;
+ * se_string_init(&str);
+ * se_string_append(&str, "hello", 5);
+ * se_usize_t pos = se_string_find(&str, "ll", 2);
+ * se_string_deinit(&str);
+ * @endcode
+ *
+ * @note Строка хранит произвольные байты, включая нулевые.
+ * @see memory_view.h
+ */
+
+#ifndef SE_STRING_H
+#define SE_STRING_H
+
+#include "memory_view.h"
+#include "attribute.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @def SE_STRING_INLINE_CAPACITY
+ * @brief Максимальная длина строки, хранимой без выделения памяти.
+ */
+#define SE_STRING_INLINE_CAPACITY (3 * sizeof(void *) - 1)
+
+/**
+ * @def SE_STRING_HEAP_TAG
+ * @brief Значение последнего байта структуры для строки в куче.
+ */
+#define SE_STRING_HEAP_TAG 0xFF
+
+/**
+ * @def SE_STRING_NPOS
+ * @brief Результат поиска, если вхождение не найдено.
+ */
+#define SE_STRING_NPOS SE_USIZE_T_MAX
+
+/**
+ * @struct se_string
+ * @brief Байтовая строка.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct se_string
+{
+    union
+    {
+        /** Представление строки, размещенной в куче. */
+        struct
+        {
+            char      *data;     /**< Данные (после заголовка с емкостью). */
+            se_usize_t size;     /**< Длина строки. */
+            se_usize_t reserved; /**< Не используется, кроме последнего байта-метки. */
+        } heap;
+
+        /** Встроенное хранилище; последний байт — метка режима. */
+        char buffer[SE_STRING_INLINE_CAPACITY + 1];
+    } storage;
+} se_string_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустую строку без выделения памяти.
+ * @param[out] self Указатель на строку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_init(se_string_t *self);
+
+/**
+ * @brief Освобождает память строки.
+ * @param[in,out] self Указатель на строку (после вызова пуста).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_deinit(se_string_t *self);
+
+/**
+ * @brief Заменяет содержимое строки.
+ *
+ * @param[in,out] self Указатель на строку.
+ * @param[in] data Новое содержимое (может быть `nullptr`, если `size == 0`).
+ * @param[in] size Длина в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_assign(se_string_t *self, const void *data, se_usize_t size);
+
+/**
+ * @brief Добавляет байты в конец строки.
+ *
+ * @param[in,out] self Указатель на строку.
+ * @param[in] data Добавляемые байты (не должны лежать внутри строки).
+ * @param[in] size Количество байт.
+ *
+ * @note При нехватке памяти выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_append(se_string_t *self, const void *data, se_usize_t size);
+
+/**
+ * @brief Гарантирует емкость не меньше заданной.
+ * @param[in,out] self Указатель на строку.
+ * @param[in] capacity Требуемая емкость в байтах (без терминатора).
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_reserve(se_string_t *self, se_usize_t capacity);
+
+/**
+ * @brief Удаляет содержимое, сохраняя емкость.
+ * @param[in,out] self Указатель на строку.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_string_clear(se_string_t *self);
+
+/**
+ * @brief Проверяет, хранится ли строка во встроенном буфере.
+ * @param[in] self Указатель на строку.
+ * @return `true`, если строка не использует кучу.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_string_is_inline(const se_string_t *self);
+
+/**
+ * @brief Возвращает длину строки.
+ * @param[in] self Указатель на строку.
+ * @return Длина в байтах.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_string_get_size(const se_string_t *self);
+
+/**
+ * @brief Возвращает емкость строки.
+ * @param[in] self Указатель на строку.
+ * @return Емкость в байтах (без терминатора).
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_string_get_capacity(const se_string_t *self);
+
+/**
+ * @brief Возвращает указатель на содержимое для изменения.
+ * @param[in] self Указатель на строку.
+ * @return Начало данных.
+ */
+SE_ATTRIBUTE(SYMBOL)
+char *
+se_string_get_data(se_string_t *self);
+
+/**
+ * @brief Возвращает содержимое как строку C.
+ * @param[in] self Указатель на строку.
+ * @return Указатель на данные, завершенные нулевым байтом.
+ */
+SE_ATTRIBUTE(SYMBOL)
+const char *
+se_string_get_cstr(const se_string_t *self);
+
+/**
+ * @brief Возвращает представление содержимого (без терминатора).
+ * @param[in] self Указатель на строку.
+ * @return Область `[data, data + size)`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_memory_view_t
+se_string_get_view(const se_string_t *self);
+
+/**
+ * @brief Ищет первое вхождение подстроки.
+ *
+ * @param[in] self Указатель на строку.
+ * @param[in] needle Искомые байты.
+ * @param[in] size Длина искомого в байтах.
+ * @return Позиция первого вхождения или `SE_STRING_NPOS`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_string_find(const se_string_t *self, const void *needle, se_usize_t size);
+
+/**
+ * @brief Ищет последнее вхождение подстроки.
+ *
+ * @param[in] self Указатель на строку.
+ * @param[in] needle Искомые байты.
+ * @param[in] size Длина искомого в байтах.
+ * @return Позиция последнего вхождения или `SE_STRING_NPOS`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_string_rfind(const se_string_t *self, const void *needle, se_usize_t size);
+
+/**
+ * @brief Проверяет, начинается ли строка с заданных байт.
+ *
+ * @param[in] self Указатель на строку.
+ * @param[in] prefix Префикс.
+ * @param[in] size Длина префикса в байтах.
+ * @return `true`, если строка начинается с `prefix`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_string_starts_with(const se_string_t *self, const void *prefix, se_usize_t size);
+
+/**
+ * @brief Проверяет, заканчивается ли строка заданными байтами.
+ *
+ * @param[in] self Указатель на строку.
+ * @param[in] suffix Суффикс.
+ * @param[in] size Длина суффикса в байтах.
+ * @return `true`, если строка заканчивается на `suffix`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+bool
+se_string_ends_with(const se_string_t *self, const void *suffix, se_usize_t size);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_STRING_H
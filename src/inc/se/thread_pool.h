@@ -0,0 +1,198 @@
+/**
+ * @file thread_pool.h
+ * @brief Пул рабочих потоков с планировщиком задач на основе кражи работы.
+ *
+ * У каждого рабочего потока есть своя двусторонняя очередь задач
+ * Чейза–Лева: владелец добавляет и забирает задачи с одного конца
+ * без атомарных операций чтения-модификации-записи (кроме случая
+ * последней задачи), остальные потоки крадут задачи с другого конца
+ * одним CAS. Задачи, созданные внутри задачи, попадают в очередь своего
+ * рабочего потока и выполняются в порядке LIFO, пока их не украдут,
+ * поэтому рекурсивное разбиение работы остается локальным по кэшу.
+ * Задачи из потоков вне пула попадают в общую очередь (см. mpmc_queue.h);
+ * если она заполнена, задача выполняется сразу в вызывающем потоке.
+ *
+ * Память задач выделяется из пула объектов своего рабочего потока
+ * (см. memory_pool.h); задачу, освобожденную другим потоком, владелец
+ * забирает обратно через список удаленного освобождения.
+ *
+ * Простаивающий рабочий поток некоторое время ищет работу, затем засыпает
+ * на futex (см. futex.h). Создание задачи будит спящих, только если они есть.
+ *
+ * Ожидание задачи (`se_thread_pool_wait`) не блокирует поток: пока задача
+ * не выполнена, поток выполняет другие задачи — сначала из своей очереди
+ * (чаще всего это и есть ожидаемая задача), затем украденные. Засыпает
+ * он, только если работы не осталось, а задачу выполняет другой поток.
+ *
+ * Пример использования:
+ * @code
+ * static void
+ * sum_range(void *context)
+ * {
+ *     range_t *range = context;
+ *     // ...
+ * }
+ *
+ * se_thread_pool_t pool;
+ * se_thread_pool_init(&pool, 0);
+ *
+ * se_thread_pool_task_t *left = se_thread_pool_spawn(&pool, sum_range, &ranges[0]);
+ * sum_range(&ranges[1]);
+ * se_thread_pool_wait(&pool, left);
+ *
+ * se_thread_pool_deinit(&pool);
+ * @endcode
+ *
+ * @see thread_pool_task_fn.h
+ */
+
+#ifndef SE_THREAD_POOL_H
+#define SE_THREAD_POOL_H
+
+#include "thread_pool_task_fn.h"
+#include "attribute.h"
+#include "cache_line.h"
+#include "size.h"
+
+/**
+ * @def SE_THREAD_POOL_DEQUE_CAPACITY
+ * @brief Начальная емкость очереди рабочего потока (удваивается при заполнении).
+ */
+#define SE_THREAD_POOL_DEQUE_CAPACITY 256
+
+/**
+ * @def SE_THREAD_POOL_INJECT_CAPACITY
+ * @brief Емкость общей очереди задач от потоков вне пула.
+ */
+#define SE_THREAD_POOL_INJECT_CAPACITY 1024
+
+/**
+ * @def SE_THREAD_POOL_SPIN_COUNT
+ * @brief Количество неудачных поисков работы перед засыпанием.
+ */
+#define SE_THREAD_POOL_SPIN_COUNT 64
+
+/**
+ * @def SE_THREAD_POOL_HELP_DEPTH
+ * @brief Глубина вложенности задач, выполняемых ожидающим потоком, после
+ *        которой он берет задачи только из своей очереди.
+ *
+ * Каждая задача, выполненная во время ожидания, занимает стек ожидающего
+ * потока. Без ограничения поток вне пула, помогающий через общую очередь,
+ * обходит дерево задач в ширину и переполняет стек.
+ */
+#define SE_THREAD_POOL_HELP_DEPTH 32
+
+/**
+ * @def SE_THREAD_POOL_NOT_WORKER
+ * @brief Индекс, возвращаемый `se_thread_pool_get_worker_index` вне рабочих потоков.
+ */
+#define SE_THREAD_POOL_NOT_WORKER ((se_usize_t)-1)
+
+/**
+ * @typedef se_thread_pool_task_t
+ * @brief Непрозрачный дескриптор созданной задачи.
+ */
+typedef struct se_thread_pool_task se_thread_pool_task_t;
+
+/**
+ * @struct se_thread_pool
+ * @brief Пул потоков.
+ *
+ * Поля не предназначены для прямого доступа: используйте функции модуля.
+ */
+typedef struct se_thread_pool
+{
+    void      *workers;      /**< Массив рабочих потоков, выровненных по кэш-линиям. */
+    se_usize_t worker_count; /**< Количество рабочих потоков. */
+    void      *control;      /**< Общая очередь, слово ожидания и флаг остановки. */
+} se_thread_pool_t;
+
+SE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Создает пул и запускает рабочие потоки.
+ *
+ * @param[out] self Указатель на пул.
+ * @param[in] worker_count Количество рабочих потоков или 0 для количества
+ *                         логических процессоров.
+ *
+ * @note Если поток не удалось создать, выбрасывает `SE_RUNTIME_ERROR_OUT_OF_MEMORY`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_thread_pool_init(se_thread_pool_t *self, se_usize_t worker_count);
+
+/**
+ * @brief Выполняет оставшиеся задачи, останавливает рабочие потоки и освобождает память.
+ *
+ * @param[in,out] self Указатель на пул.
+ *
+ * @note Вызывается из потока вне пула, когда новые задачи больше не создаются.
+ *       До вызова нужно дождаться всех задач, созданных `se_thread_pool_spawn`.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_thread_pool_deinit(se_thread_pool_t *self);
+
+/**
+ * @brief Создает задачу, которую нужно дождаться.
+ *
+ * @param[in] self Указатель на пул.
+ * @param[in] fn Функция задачи.
+ * @param[in] context Аргумент функции.
+ * @return Дескриптор задачи; он действителен до вызова `se_thread_pool_wait`,
+ *         который должен быть выполнен ровно один раз.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_thread_pool_task_t *
+se_thread_pool_spawn(se_thread_pool_t *self, se_thread_pool_task_fn *fn, void *context);
+
+/**
+ * @brief Создает задачу, которую никто не ожидает.
+ *
+ * Память задачи освобождается после ее выполнения.
+ *
+ * @param[in] self Указатель на пул.
+ * @param[in] fn Функция задачи.
+ * @param[in] context Аргумент функции.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_thread_pool_submit(se_thread_pool_t *self, se_thread_pool_task_fn *fn, void *context);
+
+/**
+ * @brief Ожидает выполнения задачи, выполняя другие задачи пула.
+ *
+ * @param[in] self Указатель на пул.
+ * @param[in] task Дескриптор из `se_thread_pool_spawn`; после вызова недействителен.
+ */
+SE_ATTRIBUTE(SYMBOL)
+void
+se_thread_pool_wait(se_thread_pool_t *self, se_thread_pool_task_t *task);
+
+/**
+ * @brief Возвращает количество рабочих потоков.
+ * @param[in] self Указатель на пул.
+ * @return Количество рабочих потоков.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_thread_pool_get_worker_count(const se_thread_pool_t *self);
+
+/**
+ * @brief Возвращает индекс текущего рабочего потока.
+ *
+ * Позволяет задачам вести данные по рабочим потокам без синхронизации.
+ *
+ * @param[in] self Указатель на пул.
+ * @return Индекс от 0 до `worker_count - 1` или `SE_THREAD_POOL_NOT_WORKER`,
+ *         если текущий поток не принадлежит пулу.
+ */
+SE_ATTRIBUTE(SYMBOL)
+se_usize_t
+se_thread_pool_get_worker_index(const se_thread_pool_t *self);
+
+SE_COMPILER(EXTERN_C_END)
+
+#endif // SE_THREAD_POOL_H
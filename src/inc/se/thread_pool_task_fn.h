@@ -0,0 +1,25 @@
+/**
+ * @file thread_pool_task_fn.h
+ * @brief Заголовочный файл для определения типа функции задачи пула потоков.
+ *
+ * @see thread_pool.h
+ */
+
+#ifndef SE_THREAD_POOL_TASK_FN_H
+#define SE_THREAD_POOL_TASK_FN_H
+
+/**
+ * @typedef se_thread_pool_task_fn
+ * @brief Тип функции задачи.
+ *
+ * Функция выполняется в одном из рабочих потоков пула или в потоке,
+ * который ожидает задачи (`se_thread_pool_wait`). Она может порождать
+ * новые задачи и ожидать их.
+ *
+ * @param context Контекст, переданный при создании задачи.
+ *
+ * @note Исключения не должны покидать функцию задачи.
+ */
+typedef void(se_thread_pool_task_fn)(void *context);
+
+#endif // SE_THREAD_POOL_TASK_FN_H
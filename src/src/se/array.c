@@ -0,0 +1,302 @@
+#include <se/array.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/memory.h>
+
+static void *
+se_array_alloc(const se_array_t *self, se_usize_t size)
+{
+    if (!self->allocator)
+    {
+        return se_runtime_allocator_alloc(size);
+    }
+
+    se_runtime_check(self->allocator->alloc, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    void *ptr = self->allocator->alloc(size);
+    se_runtime_check(ptr, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    return ptr;
+}
+
+static void
+se_array_dealloc(const se_array_t *self, void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    if (!self->allocator)
+    {
+        se_runtime_allocator_dealloc(ptr);
+        return;
+    }
+
+    se_runtime_check(self->allocator->dealloc, SE_RUNTIME_ERROR_NULL_POINTER);
+    self->allocator->dealloc(ptr);
+}
+
+static void *
+se_array_element(const se_array_t *self, se_usize_t index)
+{
+    return se_ptr_shift_unsafe(void, self->data, index * self->element_size);
+}
+
+static void
+se_array_set_capacity(se_array_t *self, se_usize_t capacity)
+{
+    se_runtime_check(capacity <= SE_USIZE_T_MAX / self->element_size, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    void *data = se_array_alloc(self, capacity * self->element_size);
+
+    if (self->size)
+    {
+        const se_usize_t bytes = self->size * self->element_size;
+        se_memory_copy(data, bytes, self->data, bytes);
+    }
+
+    se_array_dealloc(self, self->data);
+
+    self->data     = data;
+    self->capacity = capacity;
+}
+
+/**
+ * @brief Возвращает смещение указателя от начала хранилища.
+ *
+ * @return Смещение в байтах или `SE_USIZE_T_MAX`, если указатель
+ *         не указывает на занятую часть хранилища.
+ */
+static se_usize_t
+se_array_offset_of(const se_array_t *self, const void *ptr)
+{
+    const se_uaddr_t begin = se_ptr_to_addr(self->data);
+    const se_uaddr_t addr  = se_ptr_to_addr(ptr);
+
+    if (!self->data || addr < begin || addr - begin >= self->size * self->element_size)
+    {
+        return SE_USIZE_T_MAX;
+    }
+
+    return (se_usize_t)(addr - begin);
+}
+
+static void
+se_array_grow(se_array_t *self, se_usize_t required)
+{
+    if (required <= self->capacity)
+    {
+        return;
+    }
+
+    se_usize_t capacity = required;
+    if (self->capacity <= SE_USIZE_T_MAX / SE_DYNAMIC_BLOCK_GROWTH_FACTOR)
+    {
+        capacity = se_numeric_max(capacity, self->capacity * SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000);
+    }
+
+    se_array_set_capacity(self, se_numeric_max(capacity, SE_ARRAY_MIN_CAPACITY));
+}
+
+void
+se_array_init(se_array_t *self, se_usize_t element_size, const se_memory_allocator_t *allocator)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    self->data         = nullptr;
+    self->element_size = element_size;
+    self->size         = 0;
+    self->capacity     = 0;
+    self->allocator    = allocator;
+}
+
+void
+se_array_deinit(se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_array_dealloc(self, self->data);
+
+    self->data     = nullptr;
+    self->size     = 0;
+    self->capacity = 0;
+}
+
+void
+se_array_reserve(se_array_t *self, se_usize_t capacity)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (capacity > self->capacity)
+    {
+        se_array_set_capacity(self, capacity);
+    }
+}
+
+void *
+se_array_push(se_array_t *self, const void *element)
+{
+    se_runtime_check(self && element, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // An element of the array itself is re-read from the new storage
+    const se_usize_t offset = se_array_offset_of(self, element);
+
+    se_array_grow(self, self->size + 1);
+
+    if (offset != SE_USIZE_T_MAX)
+    {
+        element = se_ptr_shift_unsafe(const void, self->data, offset);
+    }
+
+    void *slot = se_array_element(self, self->size++);
+    se_memory_copy(slot, self->element_size, element, self->element_size);
+    return slot;
+}
+
+void
+se_array_pop(se_array_t *self, void *element)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(self->size, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    --self->size;
+
+    if (element)
+    {
+        se_memory_copy(element, self->element_size, se_array_element(self, self->size), self->element_size);
+    }
+}
+
+void
+se_array_insert(se_array_t *self, se_usize_t index, const void *elements, se_usize_t count)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(index <= self->size, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    if (!count)
+    {
+        return;
+    }
+
+    se_runtime_check(elements, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(count <= SE_USIZE_T_MAX - self->size, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    // Elements of the array itself are located by offset: the storage may
+    // be reallocated and the part behind the index is shifted below
+    se_usize_t offset = se_array_offset_of(self, elements);
+
+    se_array_grow(self, self->size + count);
+
+    const se_usize_t bytes = count * self->element_size;
+    const se_usize_t split = index * self->element_size;
+    void            *dst   = se_array_element(self, index);
+
+    // The tail is shifted with one overlapping move, not element by element
+    if (index < self->size)
+    {
+        const se_usize_t tail = (self->size - index) * self->element_size;
+        se_memory_move(se_array_element(self, index + count), tail, dst, tail);
+    }
+
+    if (offset != SE_USIZE_T_MAX)
+    {
+        if (offset >= split)
+        {
+            offset += bytes;
+        }
+        else if (bytes > split - offset)
+        {
+            // The source straddles the index: its head stayed in place
+            // and its rest moved along with the tail
+            const se_usize_t head = split - offset;
+            se_memory_copy(dst, head, se_ptr_shift_unsafe(void, self->data, offset), head);
+            se_memory_copy(se_ptr_shift_unsafe(void, dst, head), bytes - head,
+                           se_ptr_shift_unsafe(void, self->data, split + bytes), bytes - head);
+            self->size += count;
+            return;
+        }
+
+        elements = se_ptr_shift_unsafe(const void, self->data, offset);
+    }
+
+    se_memory_copy(dst, bytes, elements, bytes);
+    self->size += count;
+}
+
+void
+se_array_erase(se_array_t *self, se_usize_t index, se_usize_t count)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(index <= self->size && count <= self->size - index, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    const se_usize_t tail_index = index + count;
+    if (count && tail_index < self->size)
+    {
+        const se_usize_t tail = (self->size - tail_index) * self->element_size;
+        se_memory_move(se_array_element(self, index), tail, se_array_element(self, tail_index), tail);
+    }
+
+    self->size -= count;
+}
+
+void
+se_array_append_view(se_array_t *self, const se_memory_view_t *view)
+{
+    se_runtime_check(self && view, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_runtime_check(se_memory_view_is_multiple_of(view, self->element_size), SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_array_insert(self, self->size, view->begin, se_memory_view_get_size(view) / self->element_size);
+}
+
+void
+se_array_clear(se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    self->size = 0;
+}
+
+void *
+se_array_at(const se_array_t *self, se_usize_t index)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(index < self->size, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+    return se_array_element(self, index);
+}
+
+se_usize_t
+se_array_get_size(const se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->size;
+}
+
+se_usize_t
+se_array_get_capacity(const se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->capacity;
+}
+
+void *
+se_array_get_data(const se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->data;
+}
+
+se_memory_view_t
+se_array_get_view(const se_array_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // An array without storage has no data; the array itself stands in as an empty range
+    const void *begin = self->data ? self->data : (const void *)self;
+    const se_memory_view_t view = {begin, se_ptr_shift_unsafe(void, begin, self->size * self->element_size)};
+    return view;
+}
@@ -0,0 +1,17 @@
+#include <se/atomic.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <sched.h>
+#endif
+
+void
+se_atomic_yield(void)
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
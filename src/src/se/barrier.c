@@ -0,0 +1,93 @@
+#include <se/barrier.h>
+
+#include <se/runtime_check.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+#define SE_BARRIER_SLEEPERS 1u
+#define SE_BARRIER_PHASE    2u
+
+#define SE_BARRIER_YIELD_PERIOD 64
+
+static void
+se_barrier_wait(se_barrier_t *self, se_u32_t phase)
+{
+    se_usize_t spins = 0;
+    se_u32_t   state = se_atomic_u32_load(&self->generation, SE_ATOMIC_ORDER_ACQUIRE);
+
+    while ((state & ~SE_BARRIER_SLEEPERS) == phase && spins < SE_BARRIER_SPIN_COUNT)
+    {
+        // Late threads may share this core: give them the processor now and then
+        if (++spins % SE_BARRIER_YIELD_PERIOD)
+        {
+            se_atomic_pause();
+        }
+        else
+        {
+            se_atomic_yield();
+        }
+        state = se_atomic_u32_load(&self->generation, SE_ATOMIC_ORDER_ACQUIRE);
+    }
+
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_u64_fetch_add(&self->stats->spin_count, spins, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    while ((state & ~SE_BARRIER_SLEEPERS) == phase)
+    {
+        // The last arrival swaps the whole word: it either sees the flag or
+        // the CAS fails on the new phase (and leaves the flag clear for it)
+        if (!(state & SE_BARRIER_SLEEPERS) &&
+            !se_atomic_u32_compare_exchange_strong(
+                &self->generation, &state, phase | SE_BARRIER_SLEEPERS, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_ACQUIRE))
+        {
+            continue;
+        }
+
+        if (self->stats)
+        {
+            se_atomic_u64_fetch_add(&self->stats->wait_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        }
+        se_futex_wait(&self->generation, phase | SE_BARRIER_SLEEPERS);
+        state = se_atomic_u32_load(&self->generation, SE_ATOMIC_ORDER_ACQUIRE);
+    }
+}
+
+void
+se_barrier_init(se_barrier_t *self, se_u32_t count, se_lock_stats_t *stats)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(count, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_atomic_u32_store(&self->arrived, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&self->generation, 0, SE_ATOMIC_ORDER_RELAXED);
+    self->count = count;
+    self->stats = stats;
+}
+
+bool
+se_barrier_arrive_and_wait(se_barrier_t *self)
+{
+    // The phase cannot advance before this thread arrives
+    const se_u32_t phase = se_atomic_u32_load(&self->generation, SE_ATOMIC_ORDER_RELAXED) & ~SE_BARRIER_SLEEPERS;
+
+    // acq_rel: the last arrival acquires everyone's writes before publishing them
+    if (se_atomic_u32_fetch_add(&self->arrived, 1, SE_ATOMIC_ORDER_ACQ_REL) + 1 != self->count)
+    {
+        se_barrier_wait(self, phase);
+        return false;
+    }
+
+    // Reset before the release: the next phase starts counting only after
+    // its threads observe the new generation
+    se_atomic_u32_store(&self->arrived, 0, SE_ATOMIC_ORDER_RELAXED);
+    if (se_atomic_u32_exchange(&self->generation, phase + SE_BARRIER_PHASE, SE_ATOMIC_ORDER_RELEASE) &
+        SE_BARRIER_SLEEPERS)
+    {
+        se_futex_wake(&self->generation, SE_FUTEX_WAKE_ALL);
+    }
+    return true;
+}
@@ -0,0 +1,437 @@
+#include <se/ebr.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/memory_page.h>
+#include <se/memory_raw.h>
+#include <se/cache_line.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+#include <se/bool.h>
+
+/** Количество списков эпох: узлы эпохи `e` ждут эпохи `e + 2`. */
+#define SE_EBR_LIMBO_COUNT 3
+
+/** Младший бит состояния записи: поток находится в критической секции. */
+#define SE_EBR_ACTIVE 1u
+
+/**
+ * @brief Отложенный узел.
+ */
+typedef struct se_ebr_entry
+{
+    void                           *ptr;     /**< Указатель на узел. */
+    se_memory_allocator_dealloc_fn *dealloc; /**< Функция освобождения или `nullptr`. */
+} se_ebr_entry_t;
+
+/**
+ * @brief Растущий массив отложенных узлов.
+ */
+typedef struct se_ebr_list
+{
+    se_ebr_entry_t *entries;
+    se_usize_t      count;
+    se_usize_t      capacity;
+} se_ebr_list_t;
+
+/**
+ * @brief Запись потока.
+ *
+ * Первая кэш-линия читается другими потоками при продвижении эпохи
+ * и сканировании указателей опасности, остальное принадлежит потоку.
+ */
+typedef struct se_ebr_record
+{
+    /** Эпоха входа, сдвинутая на бит, и флаг `SE_EBR_ACTIVE`; ноль вне секции. */
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_u64_t       state;
+    se_atomic_ptr_t       hazards[SE_EBR_HAZARD_COUNT];
+    se_atomic_u32_t       in_use; /**< Запись занята живым потоком. */
+    struct se_ebr_record *next;   /**< Следующая запись глобального списка. */
+
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_usize_t    nesting; /**< Глубина вложенности критических секций. */
+    se_usize_t    retired; /**< Узлов эпох, отложенных с последней сборки. */
+    se_ebr_list_t limbo[SE_EBR_LIMBO_COUNT];
+    se_u64_t      limbo_epoch[SE_EBR_LIMBO_COUNT];
+    se_ebr_list_t protected_list;
+} se_ebr_record_t;
+
+/** Глобальная эпоха. */
+static se_atomic_u64_t m_ebr_epoch;
+
+/**
+ * @brief Список записей всех потоков.
+ *
+ * Список только растет: записи отсоединенных потоков переиспользуются.
+ */
+static se_atomic_ptr_t   m_ebr_records;
+static se_atomic_usize_t m_ebr_record_count;
+
+/**
+ * @brief Запись текущего потока.
+ *
+ * Потоковая независимо от SE_LIBRARY_OPTION_THREAD_LOCAL: общая запись
+ * смешала бы критические секции и указатели опасности разных потоков.
+ */
+static SE_COMPILER(ATTRIBUTE_THREAD_LOCAL)
+se_ebr_record_t *m_ebr_record;
+
+static se_ebr_record_t *
+se_ebr_get_record(void)
+{
+    se_ebr_record_t *record = m_ebr_record;
+    if (record)
+    {
+        return record;
+    }
+
+    // Acquire pairs with the detaching thread: its lists come along with the record
+    for (record = se_atomic_ptr_load(&m_ebr_records, SE_ATOMIC_ORDER_ACQUIRE); record; record = record->next)
+    {
+        se_u32_t expected = 0;
+        if (se_atomic_u32_compare_exchange_strong(
+                &record->in_use, &expected, 1, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            m_ebr_record = record;
+            return record;
+        }
+    }
+
+    // Records are taken from the pages directly: fresh pages are already
+    // zero and the allocator may itself be built on this module
+    record = se_memory_page_alloc(sizeof(se_ebr_record_t));
+    se_runtime_check(record, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    se_atomic_u32_store(&record->in_use, 1, SE_ATOMIC_ORDER_RELAXED);
+
+    void *head = se_atomic_ptr_load(&m_ebr_records, SE_ATOMIC_ORDER_RELAXED);
+    do
+    {
+        record->next = head;
+    } while (!se_atomic_ptr_compare_exchange_weak(
+        &m_ebr_records, &head, record, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED));
+    se_atomic_usize_fetch_add(&m_ebr_record_count, 1, SE_ATOMIC_ORDER_RELAXED);
+
+    m_ebr_record = record;
+    return record;
+}
+
+static void
+se_ebr_list_push(se_ebr_list_t *list, void *ptr, se_memory_allocator_dealloc_fn *dealloc)
+{
+    if (list->count == list->capacity)
+    {
+        const se_usize_t capacity = list->capacity ? list->capacity * 2 : SE_EBR_BATCH_SIZE;
+        se_ebr_entry_t  *entries  = se_runtime_allocator_alloc(capacity * sizeof(se_ebr_entry_t));
+
+        if (list->entries)
+        {
+            se_memory_raw_copy(entries, entries + list->count, list->entries, list->entries + list->count);
+            se_runtime_allocator_dealloc(list->entries);
+        }
+        list->entries  = entries;
+        list->capacity = capacity;
+    }
+
+    list->entries[list->count].ptr     = ptr;
+    list->entries[list->count].dealloc = dealloc;
+    ++list->count;
+}
+
+static void
+se_ebr_entry_free(const se_ebr_entry_t *entry)
+{
+    if (entry->dealloc)
+    {
+        entry->dealloc(entry->ptr);
+    }
+    else
+    {
+        se_runtime_allocator_dealloc(entry->ptr);
+    }
+}
+
+/**
+ * @brief Забирает массив из списка, чтобы функции освобождения могли
+ *        безопасно откладывать новые узлы в тот же список.
+ */
+static se_ebr_list_t
+se_ebr_list_take(se_ebr_list_t *list)
+{
+    const se_ebr_list_t batch = *list;
+
+    list->entries  = nullptr;
+    list->count    = 0;
+    list->capacity = 0;
+    return batch;
+}
+
+/**
+ * @brief Возвращает массив в список, если за время освобождения
+ *        в него ничего не отложили, иначе освобождает массив.
+ */
+static void
+se_ebr_list_restore(se_ebr_list_t *list, se_ebr_list_t *batch)
+{
+    if (list->entries)
+    {
+        for (se_usize_t i = 0; i < batch->count; ++i)
+        {
+            se_ebr_list_push(list, batch->entries[i].ptr, batch->entries[i].dealloc);
+        }
+        se_runtime_allocator_dealloc(batch->entries);
+    }
+    else
+    {
+        *list = *batch;
+    }
+}
+
+static se_usize_t
+se_ebr_list_release(se_ebr_list_t *list)
+{
+    se_ebr_list_t batch = se_ebr_list_take(list);
+
+    for (se_usize_t i = 0; i < batch.count; ++i)
+    {
+        se_ebr_entry_free(&batch.entries[i]);
+    }
+
+    const se_usize_t freed = batch.count;
+    batch.count            = 0;
+    se_ebr_list_restore(list, &batch);
+    return freed;
+}
+
+/**
+ * @brief Продвигает глобальную эпоху, если все активные потоки дошли до нее.
+ * @return Текущая глобальная эпоха.
+ */
+static se_u64_t
+se_ebr_try_advance(void)
+{
+    se_u64_t epoch = se_atomic_u64_load(&m_ebr_epoch, SE_ATOMIC_ORDER_SEQ_CST);
+
+    for (se_ebr_record_t *record = se_atomic_ptr_load(&m_ebr_records, SE_ATOMIC_ORDER_ACQUIRE); record;
+         record = record->next)
+    {
+        const se_u64_t state = se_atomic_u64_load(&record->state, SE_ATOMIC_ORDER_SEQ_CST);
+        if ((state & SE_EBR_ACTIVE) && (state >> 1) != epoch)
+        {
+            return epoch;
+        }
+    }
+
+    // On failure someone else advanced it: the loaded value is just as good
+    if (se_atomic_u64_compare_exchange_strong(
+            &m_ebr_epoch, &epoch, epoch + 1, SE_ATOMIC_ORDER_SEQ_CST, SE_ATOMIC_ORDER_SEQ_CST))
+    {
+        ++epoch;
+    }
+    return epoch;
+}
+
+static bool
+se_ebr_is_protected(const void *ptr)
+{
+    for (se_ebr_record_t *record = se_atomic_ptr_load(&m_ebr_records, SE_ATOMIC_ORDER_ACQUIRE); record;
+         record = record->next)
+    {
+        for (se_usize_t slot = 0; slot < SE_EBR_HAZARD_COUNT; ++slot)
+        {
+            if (se_atomic_ptr_load(&record->hazards[slot], SE_ATOMIC_ORDER_SEQ_CST) == ptr)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static se_usize_t
+se_ebr_scan(se_ebr_record_t *self)
+{
+    if (!self->protected_list.count)
+    {
+        return 0;
+    }
+
+    // The unlinking stores must be ordered before the hazard loads
+    se_atomic_thread_fence(SE_ATOMIC_ORDER_SEQ_CST);
+
+    se_ebr_list_t batch = se_ebr_list_take(&self->protected_list);
+    se_usize_t    kept  = 0;
+
+    for (se_usize_t i = 0; i < batch.count; ++i)
+    {
+        if (se_ebr_is_protected(batch.entries[i].ptr))
+        {
+            batch.entries[kept++] = batch.entries[i];
+        }
+        else
+        {
+            se_ebr_entry_free(&batch.entries[i]);
+        }
+    }
+
+    const se_usize_t freed = batch.count - kept;
+    batch.count            = kept;
+    se_ebr_list_restore(&self->protected_list, &batch);
+    return freed;
+}
+
+void
+se_ebr_enter(void)
+{
+    se_ebr_record_t *record = se_ebr_get_record();
+    if (record->nesting++)
+    {
+        return;
+    }
+
+    // Until the published epoch is seen together with an unchanged global
+    // one, a concurrent advance could have missed this thread
+    se_u64_t epoch = se_atomic_u64_load(&m_ebr_epoch, SE_ATOMIC_ORDER_RELAXED);
+    for (;;)
+    {
+        se_atomic_u64_exchange(&record->state, (epoch << 1) | SE_EBR_ACTIVE, SE_ATOMIC_ORDER_SEQ_CST);
+
+        const se_u64_t current = se_atomic_u64_load(&m_ebr_epoch, SE_ATOMIC_ORDER_SEQ_CST);
+        if (current == epoch)
+        {
+            break;
+        }
+        epoch = current;
+    }
+}
+
+void
+se_ebr_leave(void)
+{
+    se_ebr_record_t *record = m_ebr_record;
+    se_runtime_check(record && record->nesting, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    if (!--record->nesting)
+    {
+        se_atomic_u64_store(&record->state, 0, SE_ATOMIC_ORDER_RELEASE);
+    }
+}
+
+void
+se_ebr_retire(void *ptr, se_memory_allocator_dealloc_fn *dealloc)
+{
+    se_ebr_record_t *record = se_ebr_get_record();
+
+    const se_u64_t epoch = se_atomic_u64_load(&m_ebr_epoch, SE_ATOMIC_ORDER_SEQ_CST);
+    const se_usize_t index = epoch % SE_EBR_LIMBO_COUNT;
+
+    // A list stamped with another epoch is at least three epochs old
+    if (record->limbo_epoch[index] != epoch)
+    {
+        record->limbo_epoch[index] = epoch;
+        se_ebr_list_release(&record->limbo[index]);
+    }
+    se_ebr_list_push(&record->limbo[index], ptr, dealloc);
+
+    if (++record->retired >= SE_EBR_BATCH_SIZE)
+    {
+        se_ebr_collect();
+    }
+}
+
+void *
+se_ebr_protect(se_usize_t slot, se_atomic_ptr_t *source)
+{
+    se_runtime_check(slot < SE_EBR_HAZARD_COUNT, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    se_ebr_record_t *record = se_ebr_get_record();
+    void            *ptr    = se_atomic_ptr_load(source, SE_ATOMIC_ORDER_RELAXED);
+
+    for (;;)
+    {
+        se_atomic_ptr_store(&record->hazards[slot], ptr, SE_ATOMIC_ORDER_SEQ_CST);
+
+        void *current = se_atomic_ptr_load(source, SE_ATOMIC_ORDER_SEQ_CST);
+        if (current == ptr)
+        {
+            return ptr;
+        }
+        ptr = current;
+    }
+}
+
+void
+se_ebr_clear(se_usize_t slot)
+{
+    se_runtime_check(slot < SE_EBR_HAZARD_COUNT, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    se_atomic_ptr_store(&se_ebr_get_record()->hazards[slot], nullptr, SE_ATOMIC_ORDER_RELEASE);
+}
+
+void
+se_ebr_retire_protected(void *ptr, se_memory_allocator_dealloc_fn *dealloc)
+{
+    se_ebr_record_t *record = se_ebr_get_record();
+    se_ebr_list_push(&record->protected_list, ptr, dealloc);
+
+    // Each scan keeps at most one node per hazard slot, so a threshold of
+    // twice the slot count frees at least half of the list every time
+    const se_usize_t slots = se_atomic_usize_load(&m_ebr_record_count, SE_ATOMIC_ORDER_RELAXED) * SE_EBR_HAZARD_COUNT;
+    if (record->protected_list.count >= SE_EBR_BATCH_SIZE + 2 * slots)
+    {
+        se_ebr_scan(record);
+    }
+}
+
+se_usize_t
+se_ebr_collect(void)
+{
+    se_ebr_record_t *record = se_ebr_get_record();
+    record->retired         = 0;
+
+    const se_u64_t epoch = se_ebr_try_advance();
+    se_usize_t     freed = 0;
+
+    for (se_usize_t i = 0; i < SE_EBR_LIMBO_COUNT; ++i)
+    {
+        if (record->limbo[i].count && record->limbo_epoch[i] + 2 <= epoch)
+        {
+            freed += se_ebr_list_release(&record->limbo[i]);
+        }
+    }
+    return freed + se_ebr_scan(record);
+}
+
+se_usize_t
+se_ebr_get_pending(void)
+{
+    const se_ebr_record_t *record  = se_ebr_get_record();
+    se_usize_t             pending = record->protected_list.count;
+
+    for (se_usize_t i = 0; i < SE_EBR_LIMBO_COUNT; ++i)
+    {
+        pending += record->limbo[i].count;
+    }
+    return pending;
+}
+
+void
+se_ebr_thread_detach(void)
+{
+    se_ebr_record_t *record = m_ebr_record;
+    if (!record)
+    {
+        return;
+    }
+    se_runtime_check(!record->nesting, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    for (se_usize_t slot = 0; slot < SE_EBR_HAZARD_COUNT; ++slot)
+    {
+        se_atomic_ptr_store(&record->hazards[slot], nullptr, SE_ATOMIC_ORDER_RELEASE);
+    }
+    se_ebr_collect();
+
+    // Release hands the remaining lists over to the next owner
+    m_ebr_record = nullptr;
+    se_atomic_u32_store(&record->in_use, 0, SE_ATOMIC_ORDER_RELEASE);
+}
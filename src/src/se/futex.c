@@ -0,0 +1,55 @@
+#include <se/futex.h>
+
+#include <se/nullptr.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#elif defined(__linux__)
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#else
+#    include <time.h>
+#endif
+
+void
+se_futex_wait(const void *address, se_u32_t expected)
+{
+#if defined(_WIN32)
+    WaitOnAddress((volatile VOID *)address, &expected, sizeof(expected), INFINITE);
+#elif defined(__linux__)
+    // EAGAIN (the word already changed) and EINTR both mean "check again"
+    syscall(SYS_futex, address, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    // No portable address wait: sleep briefly and let the caller re-check
+    if (*(const volatile se_u32_t *)address == expected)
+    {
+        const struct timespec delay = {0, 50000};
+        nanosleep(&delay, nullptr);
+    }
+#endif
+}
+
+void
+se_futex_wake(const void *address, se_u32_t count)
+{
+#if defined(_WIN32)
+    if (count == SE_FUTEX_WAKE_ALL)
+    {
+        WakeByAddressAll((PVOID)address);
+        return;
+    }
+
+    while (count--)
+    {
+        WakeByAddressSingle((PVOID)address);
+    }
+#elif defined(__linux__)
+    // The kernel takes the count as int
+    const int wake = count > 0x7FFFFFFF ? 0x7FFFFFFF : (int)count;
+    syscall(SYS_futex, address, FUTEX_WAKE_PRIVATE, wake, nullptr, nullptr, 0);
+#else
+    (void)address;
+    (void)count;
+#endif
+}
@@ -0,0 +1,93 @@
+#include <se/hash.h>
+
+#include <se/runtime_check.h>
+#include <se/ptr_util.h>
+
+#define SE_HASH_P0 0xA0761D6478BD642FULL
+#define SE_HASH_P1 0xE7037ED1A0B428DBULL
+
+static void
+se_hash_multiply(se_u64_t *lo, se_u64_t *hi)
+{
+#if defined(SE_INT128_T_SIZE) && SE_INT128_T_SIZE == 16
+    const se_u128_t product = (se_u128_t)*lo * *hi;
+    *lo                     = (se_u64_t)product;
+    *hi                     = (se_u64_t)(product >> 64);
+#else
+    const se_u64_t a_lo = *lo & 0xFFFFFFFF, a_hi = *lo >> 32;
+    const se_u64_t b_lo = *hi & 0xFFFFFFFF, b_hi = *hi >> 32;
+
+    const se_u64_t ll  = a_lo * b_lo;
+    const se_u64_t lh  = a_lo * b_hi;
+    const se_u64_t hl  = a_hi * b_lo;
+    const se_u64_t hh  = a_hi * b_hi;
+    const se_u64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+
+    *lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+static se_u64_t
+se_hash_mix(se_u64_t a, se_u64_t b)
+{
+    se_hash_multiply(&a, &b);
+    return a ^ b;
+}
+
+static se_u64_t
+se_hash_read64(const se_u8_t *p)
+{
+    return *(const se_u64_t *)p;
+}
+
+static se_u64_t
+se_hash_read32(const se_u8_t *p)
+{
+    return *(const se_u32_t *)p;
+}
+
+se_u64_t
+se_hash_bytes(const void *data, se_usize_t size)
+{
+    se_runtime_check(data || !size, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_u8_t *p    = se_ptr_cast(const se_u8_t, data);
+    se_u64_t       seed = se_hash_mix(SE_HASH_P0 ^ size, SE_HASH_P1);
+    se_u64_t       a    = 0;
+    se_u64_t       b    = 0;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // Two pairs of overlapping 4-byte reads cover every length from 4 to 16
+            const se_usize_t shift = (size >> 3) << 2;
+            a = (se_hash_read32(p) << 32) | se_hash_read32(p + shift);
+            b = (se_hash_read32(p + size - 4) << 32) | se_hash_read32(p + size - 4 - shift);
+        }
+        else if (size)
+        {
+            a = ((se_u64_t)p[0] << 16) | ((se_u64_t)p[size >> 1] << 8) | p[size - 1];
+        }
+    }
+    else
+    {
+        se_usize_t left = size;
+        while (left > 16)
+        {
+            seed = se_hash_mix(se_hash_read64(p) ^ SE_HASH_P1, se_hash_read64(p + 8) ^ seed);
+            p += 16;
+            left -= 16;
+        }
+
+        // The last block may overlap the bytes already mixed in
+        a = se_hash_read64(p + left - 16);
+        b = se_hash_read64(p + left - 8);
+    }
+
+    a ^= SE_HASH_P1;
+    b ^= seed;
+    se_hash_multiply(&a, &b);
+    return se_hash_mix(a ^ SE_HASH_P0 ^ size, b ^ SE_HASH_P1);
+}
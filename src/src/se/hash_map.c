@@ -0,0 +1,564 @@
+#include <se/hash_map.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/memory_std.h>
+#include <se/addr_util.h>
+#include <se/bit_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/hash.h>
+
+#if defined(SE_COMPILE_OPTION_SSE2) || defined(SE_COMPILE_OPTION_AVX2)
+
+#    include <immintrin.h> // Для AVX2 и SSE2
+
+#endif
+
+// Number of control bytes compared with one instruction
+#if defined(SE_COMPILE_OPTION_AVX2)
+#    define SE_HASH_MAP_GROUP_WIDTH 32
+#elif defined(SE_COMPILE_OPTION_SSE2)
+#    define SE_HASH_MAP_GROUP_WIDTH 16
+#else
+#    define SE_HASH_MAP_GROUP_WIDTH 8
+#endif
+
+// Full slots store the low 7 hash bits, free slots have the high bit set
+#define SE_HASH_MAP_CTRL_EMPTY   0x80
+#define SE_HASH_MAP_CTRL_DELETED 0xFE
+
+#define SE_HASH_MAP_SLOT_MAX_ALIGNMENT 8
+
+#if defined(SE_COMPILE_OPTION_AVX2)
+
+static se_u32_t
+se_hash_map_group_match(const se_u8_t *group, se_u8_t h2)
+{
+    const __m256i ctrl = _mm256_loadu_si256((const __m256i *)group);
+    return (se_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ctrl, _mm256_set1_epi8((char)h2)));
+}
+
+static se_u32_t
+se_hash_map_group_match_empty(const se_u8_t *group)
+{
+    return se_hash_map_group_match(group, SE_HASH_MAP_CTRL_EMPTY);
+}
+
+static se_u32_t
+se_hash_map_group_match_free(const se_u8_t *group)
+{
+    return (se_u32_t)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *)group));
+}
+
+#elif defined(SE_COMPILE_OPTION_SSE2)
+
+static se_u32_t
+se_hash_map_group_match(const se_u8_t *group, se_u8_t h2)
+{
+    const __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+    return (se_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+}
+
+static se_u32_t
+se_hash_map_group_match_empty(const se_u8_t *group)
+{
+    return se_hash_map_group_match(group, SE_HASH_MAP_CTRL_EMPTY);
+}
+
+static se_u32_t
+se_hash_map_group_match_free(const se_u8_t *group)
+{
+    return (se_u32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+}
+
+#else
+
+static se_u32_t
+se_hash_map_group_match(const se_u8_t *group, se_u8_t h2)
+{
+    se_u32_t mask = 0;
+    for (se_u32_t i = 0; i < SE_HASH_MAP_GROUP_WIDTH; ++i)
+    {
+        mask |= (se_u32_t)(group[i] == h2) << i;
+    }
+    return mask;
+}
+
+static se_u32_t
+se_hash_map_group_match_empty(const se_u8_t *group)
+{
+    return se_hash_map_group_match(group, SE_HASH_MAP_CTRL_EMPTY);
+}
+
+static se_u32_t
+se_hash_map_group_match_free(const se_u8_t *group)
+{
+    se_u32_t mask = 0;
+    for (se_u32_t i = 0; i < SE_HASH_MAP_GROUP_WIDTH; ++i)
+    {
+        mask |= (se_u32_t)(group[i] >> 7) << i;
+    }
+    return mask;
+}
+
+#endif
+
+static se_usize_t
+se_hash_map_growth_limit(se_usize_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+static se_usize_t
+se_hash_map_alignment(se_usize_t size)
+{
+    // The largest power of two dividing the size, as for scalar and array types
+    return size ? se_numeric_min(size & (~size + 1), SE_HASH_MAP_SLOT_MAX_ALIGNMENT) : 1;
+}
+
+static void *
+se_hash_map_alloc(const se_hash_map_t *self, se_usize_t size)
+{
+    if (!self->allocator)
+    {
+        return se_runtime_allocator_alloc(size);
+    }
+
+    se_runtime_check(self->allocator->alloc, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    void *ptr = self->allocator->alloc(size);
+    se_runtime_check(ptr, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    return ptr;
+}
+
+static void
+se_hash_map_dealloc(const se_hash_map_t *self, void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    if (!self->allocator)
+    {
+        se_runtime_allocator_dealloc(ptr);
+        return;
+    }
+
+    se_runtime_check(self->allocator->dealloc, SE_RUNTIME_ERROR_NULL_POINTER);
+    self->allocator->dealloc(ptr);
+}
+
+static se_u64_t
+se_hash_map_hash(const se_hash_map_t *self, const void *key)
+{
+    return self->hash ? self->hash(key, self->key_size) : se_hash_bytes(key, self->key_size);
+}
+
+// Keys carry no alignment guarantee, so fixed-size keys are copied into locals
+// instead of being read through a typed pointer
+static SE_ATTRIBUTE(FORCE_INLINE)
+void
+se_hash_map_load_key(void *dst, const void *src, se_usize_t size)
+{
+#if (SE_COMPILER_TYPE == SE_COMPILER_TYPE_GCC || SE_COMPILER_TYPE == SE_COMPILER_TYPE_CLANG)
+    __builtin_memcpy(dst, src, size);
+#else
+    se_memory_std_copy_unchecked(dst, src, size);
+#endif
+}
+
+static bool
+se_hash_map_keys_equal(const se_hash_map_t *self, const void *lhs, const void *rhs)
+{
+    if (self->equal)
+    {
+        return self->equal(lhs, rhs, self->key_size) != 0;
+    }
+
+    switch (self->key_size)
+    {
+    case 4:
+    {
+        se_u32_t lhs_key, rhs_key;
+        se_hash_map_load_key(&lhs_key, lhs, sizeof(lhs_key));
+        se_hash_map_load_key(&rhs_key, rhs, sizeof(rhs_key));
+        return lhs_key == rhs_key;
+    }
+    case 8:
+    {
+        se_u64_t lhs_key, rhs_key;
+        se_hash_map_load_key(&lhs_key, lhs, sizeof(lhs_key));
+        se_hash_map_load_key(&rhs_key, rhs, sizeof(rhs_key));
+        return lhs_key == rhs_key;
+    }
+    default:
+        return !se_memory_std_compare(lhs, rhs, self->key_size);
+    }
+}
+
+static void *
+se_hash_map_slot(const se_hash_map_t *self, se_usize_t index)
+{
+    return se_ptr_shift_unsafe(void, self->slots, index * self->slot_size);
+}
+
+static void *
+se_hash_map_slot_value(const se_hash_map_t *self, se_usize_t index)
+{
+    return se_ptr_shift_unsafe(void, se_hash_map_slot(self, index), self->value_offset);
+}
+
+static void
+se_hash_map_set_ctrl(se_hash_map_t *self, se_usize_t index, se_u8_t ctrl)
+{
+    // The first group is mirrored after the last slot so that a group
+    // can be loaded at any position without wrapping around
+    const se_usize_t mirror = ((index - SE_HASH_MAP_GROUP_WIDTH) & (self->capacity - 1)) + SE_HASH_MAP_GROUP_WIDTH;
+
+    self->ctrl[index]  = ctrl;
+    self->ctrl[mirror] = ctrl;
+}
+
+static se_usize_t
+se_hash_map_find_index(const se_hash_map_t *self, const void *key, se_u64_t hash)
+{
+    const se_usize_t mask = self->capacity - 1;
+    const se_u8_t    h2   = (se_u8_t)(hash & 0x7F);
+    se_usize_t       pos  = (se_usize_t)(hash >> 7) & mask;
+
+    // Triangular steps over groups visit every group of a power-of-two table
+    for (se_usize_t step = SE_HASH_MAP_GROUP_WIDTH;; step += SE_HASH_MAP_GROUP_WIDTH)
+    {
+        const se_u8_t *group = self->ctrl + pos;
+
+        for (se_u32_t match = se_hash_map_group_match(group, h2); match; match &= match - 1)
+        {
+            se_ulong_t bit;
+            se_bit_scan_forward32(&bit, match);
+
+            const se_usize_t index = (pos + bit) & mask;
+            if (se_hash_map_keys_equal(self, se_hash_map_slot(self, index), key))
+            {
+                return index;
+            }
+        }
+
+        // A group with an empty slot ends every probe sequence passing through it
+        if (se_hash_map_group_match_empty(group))
+        {
+            return SE_USIZE_T_MAX;
+        }
+
+        pos = (pos + step) & mask;
+    }
+}
+
+static se_usize_t
+se_hash_map_find_free(const se_hash_map_t *self, se_u64_t hash)
+{
+    const se_usize_t mask = self->capacity - 1;
+    se_usize_t       pos  = (se_usize_t)(hash >> 7) & mask;
+
+    for (se_usize_t step = SE_HASH_MAP_GROUP_WIDTH;; step += SE_HASH_MAP_GROUP_WIDTH)
+    {
+        const se_u32_t free = se_hash_map_group_match_free(self->ctrl + pos);
+        if (free)
+        {
+            se_ulong_t bit;
+            se_bit_scan_forward32(&bit, free);
+            return (pos + bit) & mask;
+        }
+
+        pos = (pos + step) & mask;
+    }
+}
+
+static void
+se_hash_map_rehash(se_hash_map_t *self, se_usize_t capacity)
+{
+    se_runtime_check(capacity <= (SE_USIZE_T_MAX - SE_HASH_MAP_GROUP_WIDTH) / (self->slot_size + 1),
+                     SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    const se_usize_t slots_size = capacity * self->slot_size;
+    void            *block      = se_hash_map_alloc(self, slots_size + capacity + SE_HASH_MAP_GROUP_WIDTH);
+
+    se_hash_map_t old = *self;
+
+    self->slots       = block;
+    self->ctrl        = se_ptr_shift_unsafe(se_u8_t, block, slots_size);
+    self->capacity    = capacity;
+    self->growth_left = se_hash_map_growth_limit(capacity) - old.size;
+    se_memory_std_set(self->ctrl, capacity + SE_HASH_MAP_GROUP_WIDTH, SE_HASH_MAP_CTRL_EMPTY);
+
+    // Tombstones are dropped and every element lands at its first free slot
+    for (se_usize_t i = 0; i < old.capacity; ++i)
+    {
+        if (old.ctrl[i] & 0x80)
+        {
+            continue;
+        }
+
+        const void      *slot  = se_hash_map_slot(&old, i);
+        const se_u64_t   hash  = se_hash_map_hash(self, slot);
+        const se_usize_t index = se_hash_map_find_free(self, hash);
+
+        se_hash_map_set_ctrl(self, index, (se_u8_t)(hash & 0x7F));
+        se_memory_std_copy(se_hash_map_slot(self, index), slot, self->slot_size);
+    }
+
+    se_hash_map_dealloc(self, old.slots);
+}
+
+static void
+se_hash_map_grow(se_hash_map_t *self)
+{
+    if (!self->capacity)
+    {
+        se_hash_map_rehash(self, SE_HASH_MAP_GROUP_WIDTH);
+    }
+    else if (self->size * 32 <= self->capacity * 25)
+    {
+        // Mostly tombstones: reclaim them without doubling
+        se_hash_map_rehash(self, self->capacity);
+    }
+    else
+    {
+        se_runtime_check(self->capacity <= SE_USIZE_T_MAX / 2, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        se_hash_map_rehash(self, self->capacity * 2);
+    }
+}
+
+void
+se_hash_map_init(se_hash_map_t               *self,
+                 se_usize_t                   key_size,
+                 se_usize_t                   value_size,
+                 se_hash_map_hash_fn         *hash,
+                 se_hash_map_equal_fn        *equal,
+                 const se_memory_allocator_t *allocator)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(key_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+    se_runtime_check(key_size <= SE_USIZE_T_MAX / 4 && value_size <= SE_USIZE_T_MAX / 4,
+                     SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const se_usize_t key_alignment   = se_hash_map_alignment(key_size);
+    const se_usize_t value_alignment = se_hash_map_alignment(value_size);
+
+    self->ctrl         = nullptr;
+    self->slots        = nullptr;
+    self->key_size     = key_size;
+    self->value_size   = value_size;
+    self->value_offset = se_addr_align_up(key_size, value_alignment);
+    self->slot_size    = se_addr_align_up(self->value_offset + value_size,
+                                          se_numeric_max(key_alignment, value_alignment));
+    self->size         = 0;
+    self->capacity     = 0;
+    self->growth_left  = 0;
+    self->hash         = hash;
+    self->equal        = equal;
+    self->allocator    = allocator;
+}
+
+void
+se_hash_map_deinit(se_hash_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_hash_map_dealloc(self, self->slots);
+
+    self->ctrl        = nullptr;
+    self->slots       = nullptr;
+    self->size        = 0;
+    self->capacity    = 0;
+    self->growth_left = 0;
+}
+
+void
+se_hash_map_reserve(se_hash_map_t *self, se_usize_t count)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_usize_t capacity = se_numeric_max(self->capacity, SE_HASH_MAP_GROUP_WIDTH);
+    while (se_hash_map_growth_limit(capacity) < count)
+    {
+        se_runtime_check(capacity <= SE_USIZE_T_MAX / 2, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        capacity *= 2;
+    }
+
+    if (capacity > self->capacity)
+    {
+        se_hash_map_rehash(self, capacity);
+    }
+}
+
+bool
+se_hash_map_emplace(se_hash_map_t *self, const void *key, void **value)
+{
+    se_runtime_check(self && key, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_u64_t hash = se_hash_map_hash(self, key);
+
+    if (self->capacity)
+    {
+        const se_usize_t index = se_hash_map_find_index(self, key, hash);
+        if (index != SE_USIZE_T_MAX)
+        {
+            if (value)
+            {
+                *value = se_hash_map_slot_value(self, index);
+            }
+            return false;
+        }
+    }
+
+    se_usize_t index = self->capacity ? se_hash_map_find_free(self, hash) : 0;
+
+    // Reusing a tombstone does not consume the growth budget
+    if (!self->capacity || (!self->growth_left && self->ctrl[index] == SE_HASH_MAP_CTRL_EMPTY))
+    {
+        se_hash_map_grow(self);
+        index = se_hash_map_find_free(self, hash);
+    }
+
+    self->growth_left -= self->ctrl[index] == SE_HASH_MAP_CTRL_EMPTY;
+    ++self->size;
+
+    se_hash_map_set_ctrl(self, index, (se_u8_t)(hash & 0x7F));
+    se_memory_std_copy(se_hash_map_slot(self, index), key, self->key_size);
+
+    if (value)
+    {
+        *value = se_hash_map_slot_value(self, index);
+    }
+    return true;
+}
+
+void *
+se_hash_map_insert(se_hash_map_t *self, const void *key, const void *value)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(value || !self->value_size, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    void *slot;
+    se_hash_map_emplace(self, key, &slot);
+
+    if (self->value_size)
+    {
+        se_memory_std_copy(slot, value, self->value_size);
+    }
+    return slot;
+}
+
+void *
+se_hash_map_find(const se_hash_map_t *self, const void *key)
+{
+    se_runtime_check(self && key, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (!self->size)
+    {
+        return nullptr;
+    }
+
+    const se_usize_t index = se_hash_map_find_index(self, key, se_hash_map_hash(self, key));
+    return index != SE_USIZE_T_MAX ? se_hash_map_slot_value(self, index) : nullptr;
+}
+
+bool
+se_hash_map_erase(se_hash_map_t *self, const void *key)
+{
+    se_runtime_check(self && key, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (!self->size)
+    {
+        return false;
+    }
+
+    const se_usize_t index = se_hash_map_find_index(self, key, se_hash_map_hash(self, key));
+    if (index == SE_USIZE_T_MAX)
+    {
+        return false;
+    }
+
+    // The slot may become empty again if no group window that contains it
+    // was ever full: then no probe sequence has continued past this slot
+    const se_usize_t before       = (index - SE_HASH_MAP_GROUP_WIDTH) & (self->capacity - 1);
+    const se_u32_t   empty_before = se_hash_map_group_match_empty(self->ctrl + before);
+    const se_u32_t   empty_after  = se_hash_map_group_match_empty(self->ctrl + index);
+
+    bool was_never_full = false;
+    if (empty_before && empty_after)
+    {
+        se_ulong_t first_after;
+        se_ulong_t last_before;
+        se_bit_scan_forward32(&first_after, empty_after);
+        se_bit_scan_reverse32(&last_before, empty_before);
+
+        const se_usize_t full_run = first_after + (SE_HASH_MAP_GROUP_WIDTH - 1 - last_before);
+        was_never_full            = full_run < SE_HASH_MAP_GROUP_WIDTH;
+    }
+
+    se_hash_map_set_ctrl(self, index, was_never_full ? SE_HASH_MAP_CTRL_EMPTY : SE_HASH_MAP_CTRL_DELETED);
+    self->growth_left += was_never_full;
+    --self->size;
+    return true;
+}
+
+void
+se_hash_map_clear(se_hash_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (self->capacity)
+    {
+        se_memory_std_set(self->ctrl, self->capacity + SE_HASH_MAP_GROUP_WIDTH, SE_HASH_MAP_CTRL_EMPTY);
+    }
+
+    self->size        = 0;
+    self->growth_left = self->capacity ? se_hash_map_growth_limit(self->capacity) : 0;
+}
+
+bool
+se_hash_map_next(const se_hash_map_t *self, se_usize_t *cursor, const void **key, void **value)
+{
+    se_runtime_check(self && cursor, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    for (se_usize_t i = *cursor; i < self->capacity; ++i)
+    {
+        if (self->ctrl[i] & 0x80)
+        {
+            continue;
+        }
+
+        if (key)
+        {
+            *key = se_hash_map_slot(self, i);
+        }
+        if (value)
+        {
+            *value = se_hash_map_slot_value(self, i);
+        }
+
+        *cursor = i + 1;
+        return true;
+    }
+
+    *cursor = self->capacity;
+    return false;
+}
+
+se_usize_t
+se_hash_map_get_size(const se_hash_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->size;
+}
+
+se_usize_t
+se_hash_map_get_capacity(const se_hash_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->capacity;
+}
@@ -0,0 +1,92 @@
+#include <se/jump_buffer.h>
+
+#ifdef SE_JUMP_BUFFER_ASM
+
+// Indirect branch tracking wants a landing pad at every exported entry
+#    if defined(__x86_64__) && defined(__CET__)
+#        define SE_JUMP_BUFFER_ENTRY "endbr64\n"
+#    elif defined(__aarch64__) && defined(__ARM_FEATURE_BTI_DEFAULT)
+#        define SE_JUMP_BUFFER_ENTRY "hint #34\n"
+#    else
+#        define SE_JUMP_BUFFER_ENTRY
+#    endif
+
+#    define SE_JUMP_BUFFER_FUNCTION(name)                                                          \
+        ".globl " #name "\n"                                                                       \
+        ".type " #name ", %function\n"                                                             \
+        ".p2align 4\n" #name ":\n" SE_JUMP_BUFFER_ENTRY
+
+#    if defined(__x86_64__)
+// env: rbx, rbp, r12, r13, r14, r15, rsp after return, return address
+__asm__(".text\n"
+        SE_JUMP_BUFFER_FUNCTION(se_jump_buffer_save_asm)
+        "movq %rbx, 0(%rdi)\n"
+        "movq %rbp, 8(%rdi)\n"
+        "movq %r12, 16(%rdi)\n"
+        "movq %r13, 24(%rdi)\n"
+        "movq %r14, 32(%rdi)\n"
+        "movq %r15, 40(%rdi)\n"
+        "leaq 8(%rsp), %rdx\n"
+        "movq %rdx, 48(%rdi)\n"
+        "movq (%rsp), %rdx\n"
+        "movq %rdx, 56(%rdi)\n"
+        "xorl %eax, %eax\n"
+        "ret\n"
+        ".size se_jump_buffer_save_asm, .-se_jump_buffer_save_asm\n"
+
+        SE_JUMP_BUFFER_FUNCTION(se_jump_buffer_restore_asm)
+        "movl %esi, %eax\n"
+        "testl %eax, %eax\n"
+        "jnz 1f\n"
+        "incl %eax\n"
+        "1:\n"
+        "movq 0(%rdi), %rbx\n"
+        "movq 8(%rdi), %rbp\n"
+        "movq 16(%rdi), %r12\n"
+        "movq 24(%rdi), %r13\n"
+        "movq 32(%rdi), %r14\n"
+        "movq 40(%rdi), %r15\n"
+        "movq 48(%rdi), %rsp\n"
+        "jmpq *56(%rdi)\n"
+        ".size se_jump_buffer_restore_asm, .-se_jump_buffer_restore_asm\n");
+
+#    else
+// env: x19-x28, x29, x30, sp, d8-d15
+__asm__(".text\n"
+        SE_JUMP_BUFFER_FUNCTION(se_jump_buffer_save_asm)
+        "stp x19, x20, [x0, #0]\n"
+        "stp x21, x22, [x0, #16]\n"
+        "stp x23, x24, [x0, #32]\n"
+        "stp x25, x26, [x0, #48]\n"
+        "stp x27, x28, [x0, #64]\n"
+        "stp x29, x30, [x0, #80]\n"
+        "mov x2, sp\n"
+        "str x2, [x0, #96]\n"
+        "stp d8, d9, [x0, #104]\n"
+        "stp d10, d11, [x0, #120]\n"
+        "stp d12, d13, [x0, #136]\n"
+        "stp d14, d15, [x0, #152]\n"
+        "mov w0, #0\n"
+        "ret\n"
+        ".size se_jump_buffer_save_asm, .-se_jump_buffer_save_asm\n"
+
+        SE_JUMP_BUFFER_FUNCTION(se_jump_buffer_restore_asm)
+        "ldp x19, x20, [x0, #0]\n"
+        "ldp x21, x22, [x0, #16]\n"
+        "ldp x23, x24, [x0, #32]\n"
+        "ldp x25, x26, [x0, #48]\n"
+        "ldp x27, x28, [x0, #64]\n"
+        "ldp x29, x30, [x0, #80]\n"
+        "ldr x2, [x0, #96]\n"
+        "mov sp, x2\n"
+        "ldp d8, d9, [x0, #104]\n"
+        "ldp d10, d11, [x0, #120]\n"
+        "ldp d12, d13, [x0, #136]\n"
+        "ldp d14, d15, [x0, #152]\n"
+        "cmp w1, #0\n"
+        "csinc w0, w1, wzr, ne\n"
+        "ret\n"
+        ".size se_jump_buffer_restore_asm, .-se_jump_buffer_restore_asm\n");
+#    endif
+
+#endif
@@ -0,0 +1,100 @@
+#include <se/latch.h>
+
+#include <se/runtime_check.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+#define SE_LATCH_COUNT_MASK SE_LATCH_MAX_COUNT
+#define SE_LATCH_SLEEPERS   0x80000000u
+
+static void
+se_latch_release(se_latch_t *self, se_u32_t count)
+{
+    // Release publishes this thread's writes, acquire chains earlier
+    // count-downs into the thread that opens the latch
+    const se_u32_t state = se_atomic_u32_fetch_sub(&self->state, count, SE_ATOMIC_ORDER_ACQ_REL);
+    se_runtime_check((state & SE_LATCH_COUNT_MASK) >= count, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    if ((state & SE_LATCH_COUNT_MASK) == count && (state & SE_LATCH_SLEEPERS))
+    {
+        se_futex_wake(&self->state, SE_FUTEX_WAKE_ALL);
+    }
+}
+
+static void
+se_latch_block(se_latch_t *self)
+{
+    se_u32_t state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_ACQUIRE);
+    if (!(state & SE_LATCH_COUNT_MASK))
+    {
+        return;
+    }
+
+    se_usize_t spins = 0;
+    while ((state & SE_LATCH_COUNT_MASK) && spins < SE_LATCH_SPIN_COUNT)
+    {
+        se_atomic_pause();
+        ++spins;
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_ACQUIRE);
+    }
+
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_u64_fetch_add(&self->stats->spin_count, spins, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    while (state & SE_LATCH_COUNT_MASK)
+    {
+        // The flag is set in the same word the count-down reads: the last
+        // count-down either sees it or happens before this update
+        state = se_atomic_u32_fetch_or(&self->state, SE_LATCH_SLEEPERS, SE_ATOMIC_ORDER_ACQUIRE) | SE_LATCH_SLEEPERS;
+        if (!(state & SE_LATCH_COUNT_MASK))
+        {
+            break;
+        }
+
+        if (self->stats)
+        {
+            se_atomic_u64_fetch_add(&self->stats->wait_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        }
+        se_futex_wait(&self->state, state);
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_ACQUIRE);
+    }
+}
+
+void
+se_latch_init(se_latch_t *self, se_u32_t count, se_lock_stats_t *stats)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(count <= SE_LATCH_MAX_COUNT, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_atomic_u32_store(&self->state, count, SE_ATOMIC_ORDER_RELAXED);
+    self->stats = stats;
+}
+
+void
+se_latch_count_down(se_latch_t *self, se_u32_t count)
+{
+    se_latch_release(self, count);
+}
+
+bool
+se_latch_try_wait(const se_latch_t *self)
+{
+    return !(se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_ACQUIRE) & SE_LATCH_COUNT_MASK);
+}
+
+void
+se_latch_wait(se_latch_t *self)
+{
+    se_latch_block(self);
+}
+
+void
+se_latch_arrive_and_wait(se_latch_t *self, se_u32_t count)
+{
+    se_latch_release(self, count);
+    se_latch_block(self);
+}
@@ -0,0 +1,121 @@
+#include <se/mcs_lock.h>
+
+#include <se/runtime_check.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+#define SE_MCS_LOCK_GRANTED  0
+#define SE_MCS_LOCK_WAITING  1
+#define SE_MCS_LOCK_SLEEPING 2
+
+static void
+se_mcs_lock_wait(se_mcs_lock_t *self, se_mcs_lock_node_t *node)
+{
+    se_usize_t spins = 0;
+    while (se_atomic_u32_load(&node->state, SE_ATOMIC_ORDER_ACQUIRE) != SE_MCS_LOCK_GRANTED &&
+           spins < SE_MCS_LOCK_SPIN_COUNT)
+    {
+        se_atomic_pause();
+        ++spins;
+    }
+
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_u64_fetch_add(&self->stats->spin_count, spins, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    // Only this thread moves its node from WAITING to SLEEPING; the CAS fails
+    // once the predecessor has granted the lock
+    se_u32_t state = SE_MCS_LOCK_WAITING;
+    if (!se_atomic_u32_compare_exchange_strong(
+            &node->state, &state, SE_MCS_LOCK_SLEEPING, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_ACQUIRE))
+    {
+        return;
+    }
+
+    while (se_atomic_u32_load(&node->state, SE_ATOMIC_ORDER_ACQUIRE) != SE_MCS_LOCK_GRANTED)
+    {
+        if (self->stats)
+        {
+            se_atomic_u64_fetch_add(&self->stats->wait_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        }
+        se_futex_wait(&node->state, SE_MCS_LOCK_SLEEPING);
+    }
+}
+
+void
+se_mcs_lock_init(se_mcs_lock_t *self, se_lock_stats_t *stats)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_atomic_ptr_store(&self->tail, nullptr, SE_ATOMIC_ORDER_RELAXED);
+    self->stats = stats;
+}
+
+void
+se_mcs_lock_lock(se_mcs_lock_t *self, se_mcs_lock_node_t *node)
+{
+    se_atomic_ptr_store(&node->next, nullptr, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&node->state, SE_MCS_LOCK_WAITING, SE_ATOMIC_ORDER_RELAXED);
+
+    // Release publishes the initialized node to the successor, acquire pairs
+    // with the unlock that emptied the queue
+    se_mcs_lock_node_t *prev = se_atomic_ptr_exchange(&self->tail, node, SE_ATOMIC_ORDER_ACQ_REL);
+    if (!prev)
+    {
+        return;
+    }
+
+    se_atomic_ptr_store(&prev->next, node, SE_ATOMIC_ORDER_RELEASE);
+    se_mcs_lock_wait(self, node);
+}
+
+bool
+se_mcs_lock_try_lock(se_mcs_lock_t *self, se_mcs_lock_node_t *node)
+{
+    se_atomic_ptr_store(&node->next, nullptr, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&node->state, SE_MCS_LOCK_GRANTED, SE_ATOMIC_ORDER_RELAXED);
+
+    void *expected = nullptr;
+    return se_atomic_ptr_compare_exchange_strong(
+        &self->tail, &expected, node, SE_ATOMIC_ORDER_ACQ_REL, SE_ATOMIC_ORDER_RELAXED);
+}
+
+void
+se_mcs_lock_unlock(se_mcs_lock_t *self, se_mcs_lock_node_t *node)
+{
+    se_mcs_lock_node_t *next = se_atomic_ptr_load(&node->next, SE_ATOMIC_ORDER_ACQUIRE);
+    if (!next)
+    {
+        void *expected = node;
+        if (se_atomic_ptr_compare_exchange_strong(
+                &self->tail, &expected, nullptr, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return;
+        }
+
+        // A successor swapped the tail but has not linked itself yet; it may
+        // have been preempted between the two steps
+        se_usize_t spins = 0;
+        while (!(next = se_atomic_ptr_load(&node->next, SE_ATOMIC_ORDER_ACQUIRE)))
+        {
+            if (++spins < SE_MCS_LOCK_SPIN_COUNT)
+            {
+                se_atomic_pause();
+            }
+            else
+            {
+                se_atomic_yield();
+            }
+        }
+    }
+
+    // The successor may return and reuse its node right after the exchange:
+    // the wake then hits a stale address, which futex tolerates as spurious
+    if (se_atomic_u32_exchange(&next->state, SE_MCS_LOCK_GRANTED, SE_ATOMIC_ORDER_RELEASE) == SE_MCS_LOCK_SLEEPING)
+    {
+        se_futex_wake(&next->state, 1);
+    }
+}
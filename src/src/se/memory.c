@@ -1,5 +1,6 @@
 #include <se/memory.h>
 
+#include <se/runtime_check_return.h>
 #include <se/memory_std.h>
 #include <se/memory_raw.h>
 #include <se/ptr_util.h>
@@ -47,17 +48,13 @@ se_memory_compare_rev(const void *lhs, se_usize_t lhs_size, const void *rhs, se_
 const void *
 se_memory_find(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size)
 {
-    const void *lhs_end = se_ptr_add(const void *, lhs, lhs_size);
-    const void *rhs_end = se_ptr_add(const void *, rhs, rhs_size);
-    return se_memory_raw_find(lhs, lhs_end, rhs, rhs_end);
+    return se_memory_std_find(lhs, lhs_size, rhs, rhs_size);
 }
 
 const void *
 se_memory_find_rev(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size)
 {
-    const void *lhs_end = se_ptr_add(const void *, lhs, lhs_size);
-    const void *rhs_end = se_ptr_add(const void *, rhs, rhs_size);
-    return se_memory_raw_find_rev(lhs, lhs_end, rhs, rhs_end);
+    return se_memory_std_find_reverse(lhs, lhs_size, rhs, rhs_size);
 }
 
 void *
@@ -72,4 +69,47 @@ void *
 se_memory_set(void *dst, se_usize_t len, se_u8_t val)
 {
     return se_memory_std_set(dst, len, val);;
-}
\ No newline at end of file
+}
+
+void *
+se_memory_copy_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error)
+{
+    se_runtime_check_return(dst && src, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const se_usize_t n = se_numeric_min(dst_size, src_size);
+    return se_memory_std_copy_unchecked(dst, src, n);
+}
+
+void *
+se_memory_copy_rev_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error)
+{
+    se_runtime_check_return(dst && src, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const se_usize_t n = se_numeric_min(dst_size, src_size);
+    return se_memory_std_copy_reverse_unchecked(dst, src, n);
+}
+
+void *
+se_memory_move_r(void *dst, se_usize_t dst_size, const void *src, se_usize_t src_size, se_error_t *error)
+{
+    se_runtime_check_return(dst && src, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const se_usize_t n = se_numeric_min(dst_size, src_size);
+    return se_memory_std_move_unchecked(dst, src, n);
+}
+
+const void *
+se_memory_compare_r(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size, se_error_t *error)
+{
+    se_runtime_check_return(lhs && rhs, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const se_usize_t n = se_numeric_min(lhs_size, rhs_size);
+    return se_memory_std_compare_unchecked(lhs, rhs, n);
+}
+
+void *
+se_memory_set_r(void *dst, se_usize_t len, se_u8_t val, se_error_t *error)
+{
+    se_runtime_check_return(dst, error, SE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return se_memory_std_set_unchecked(dst, len, val);
+}
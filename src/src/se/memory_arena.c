@@ -0,0 +1,83 @@
+#include <se/memory_arena.h>
+
+#include <se/runtime_check.h>
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/bit_util.h>
+#include <se/memory.h>
+
+void
+se_memory_arena_init(se_memory_arena_t *self, void *buffer, se_usize_t size)
+{
+    se_runtime_check(self && buffer, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    self->begin = buffer;
+    self->end   = se_ptr_shift_unsafe(void, buffer, size);
+    self->cur   = buffer;
+}
+
+void *
+se_memory_arena_alloc(se_memory_arena_t *self, se_usize_t size)
+{
+    return se_memory_arena_alloc_aligned(self, size, SE_MEMORY_ARENA_ALIGNMENT);
+}
+
+void *
+se_memory_arena_alloc_aligned(se_memory_arena_t *self, se_usize_t size, se_usize_t alignment)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(se_bit_is_one(alignment), SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const se_uaddr_t cur  = se_ptr_to_addr(self->cur);
+    const se_uaddr_t end  = se_ptr_to_addr(self->end);
+    const se_uaddr_t addr = se_addr_align_up(cur, alignment);
+
+    // Both conditions are needed: the alignment itself may step past the end
+    se_runtime_check(addr <= end && size <= end - addr, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    void *ptr = se_addr_to_ptr(void, addr);
+    self->cur = se_addr_to_ptr(void, addr + size);
+
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    se_memory_set(ptr, size, 0);
+#endif
+
+    return ptr;
+}
+
+se_memory_arena_mark_t
+se_memory_arena_get_mark(const se_memory_arena_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->cur;
+}
+
+void
+se_memory_arena_rewind(se_memory_arena_t *self, se_memory_arena_mark_t mark)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(se_ptr_within_range(self->begin, self->cur, mark),
+                     SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
+    self->cur = mark;
+}
+
+void
+se_memory_arena_reset(se_memory_arena_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    self->cur = self->begin;
+}
+
+se_usize_t
+se_memory_arena_get_used(const se_memory_arena_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_ptr_to_addr_diff(self->cur, self->begin);
+}
+
+se_usize_t
+se_memory_arena_get_available(const se_memory_arena_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_ptr_to_addr_diff(self->end, self->cur);
+}
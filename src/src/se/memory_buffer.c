@@ -0,0 +1,217 @@
+#include <se/memory_buffer.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/memory_page.h>
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/memory.h>
+#include <se/bool.h>
+
+static bool
+se_memory_buffer_is_paged(se_usize_t capacity)
+{
+    return capacity >= SE_MEMORY_BUFFER_PAGED_THRESHOLD;
+}
+
+static void
+se_memory_buffer_release(void *data, se_usize_t capacity)
+{
+    if (se_memory_buffer_is_paged(capacity))
+    {
+        se_memory_page_dealloc(data, capacity);
+    }
+    else
+    {
+        se_runtime_allocator_dealloc(data);
+    }
+}
+
+/**
+ * @brief Переносит содержимое в хранилище заданной емкости.
+ *
+ * Вид хранилища однозначно определяется емкостью, поэтому отдельный флаг
+ * не нужен: страничным является буфер с емкостью от порога.
+ */
+static void
+se_memory_buffer_set_capacity(se_memory_buffer_t *self, se_usize_t capacity)
+{
+    if (se_memory_buffer_is_paged(capacity))
+    {
+        capacity = se_addr_align_up(capacity, se_memory_page_get_size());
+    }
+
+    if (capacity == self->capacity)
+    {
+        return;
+    }
+
+    void *data;
+
+    if (se_memory_buffer_is_paged(self->capacity) && se_memory_buffer_is_paged(capacity))
+    {
+        // Page-backed storage is resized in place of a copy (mremap on Linux)
+        data = se_memory_page_realloc(self->data, self->capacity, capacity);
+        se_runtime_check(data, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    }
+    else
+    {
+        data = nullptr;
+
+        if (se_memory_buffer_is_paged(capacity))
+        {
+            data = se_memory_page_alloc(capacity);
+            se_runtime_check(data, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        }
+        else if (capacity)
+        {
+            data = se_runtime_allocator_alloc(capacity);
+        }
+
+        if (self->size)
+        {
+            se_memory_copy(data, capacity, self->data, self->size);
+        }
+
+        se_memory_buffer_release(self->data, self->capacity);
+    }
+
+    self->data     = data;
+    self->capacity = capacity;
+}
+
+static void
+se_memory_buffer_grow(se_memory_buffer_t *self, se_usize_t required)
+{
+    if (required <= self->capacity)
+    {
+        return;
+    }
+
+    // Geometric growth keeps appends amortized O(1)
+    se_usize_t capacity = required;
+    if (self->capacity <= SE_USIZE_T_MAX / SE_DYNAMIC_BLOCK_GROWTH_FACTOR)
+    {
+        capacity = se_numeric_max(capacity, self->capacity * SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000);
+    }
+
+    se_memory_buffer_set_capacity(self, se_numeric_max(capacity, SE_MEMORY_BUFFER_MIN_CAPACITY));
+}
+
+void
+se_memory_buffer_init(se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    self->data     = nullptr;
+    self->size     = 0;
+    self->capacity = 0;
+}
+
+void
+se_memory_buffer_deinit(se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_memory_buffer_release(self->data, self->capacity);
+    se_memory_buffer_init(self);
+}
+
+void
+se_memory_buffer_reserve(se_memory_buffer_t *self, se_usize_t capacity)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (capacity > self->capacity)
+    {
+        se_memory_buffer_set_capacity(self, capacity);
+    }
+}
+
+void *
+se_memory_buffer_extend(se_memory_buffer_t *self, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(size <= SE_USIZE_T_MAX - self->size, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_memory_buffer_grow(self, self->size + size);
+
+    void *ptr = se_ptr_shift_unsafe(void, self->data, self->size);
+    self->size += size;
+    return ptr;
+}
+
+void
+se_memory_buffer_append(se_memory_buffer_t *self, const void *data, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (!size)
+    {
+        return;
+    }
+
+    se_runtime_check(data, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // The source may lie in the buffer itself: its offset survives
+    // a reallocation, its address does not
+    const se_uaddr_t begin  = se_ptr_to_addr(self->data);
+    const se_uaddr_t source = se_ptr_to_addr(data);
+    const bool       alias  = self->data && source >= begin && source < begin + self->size;
+
+    void *ptr = se_memory_buffer_extend(self, size);
+    if (alias)
+    {
+        data = se_ptr_shift_unsafe(const void, self->data, source - begin);
+    }
+
+    se_memory_copy(ptr, size, data, size);
+}
+
+void
+se_memory_buffer_shrink_to_fit(se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_memory_buffer_set_capacity(self, self->size);
+}
+
+void
+se_memory_buffer_clear(se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    self->size = 0;
+}
+
+se_usize_t
+se_memory_buffer_get_size(const se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->size;
+}
+
+se_usize_t
+se_memory_buffer_get_capacity(const se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->capacity;
+}
+
+void *
+se_memory_buffer_get_data(const se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->data;
+}
+
+se_memory_view_t
+se_memory_buffer_get_view(const se_memory_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // A buffer without storage has no data; the buffer itself stands in as an empty range
+    const void *begin = self->data ? self->data : (const void *)self;
+    const se_memory_view_t view = {begin, se_ptr_shift_unsafe(void, begin, self->size)};
+    return view;
+}
@@ -0,0 +1,785 @@
+#include <se/memory_heap.h>
+
+#include <se/memory_page.h>
+#include <se/cache_line.h>
+#include <se/static_assert.h>
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/bit_util.h>
+#include <se/compiler_expect.h>
+#include <se/nullptr.h>
+#include <se/memory.h>
+#include <se/atomic.h>
+#include <se/bool.h>
+
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+#    if defined(_WIN32)
+#        include <windows.h>
+#    else
+#        include <pthread.h>
+#    endif
+#endif
+
+/**
+ * @def SE_MEMORY_HEAP_SPAN_HEADER
+ * @brief Размер области заголовка в начале спана (кэш-линия).
+ */
+#define SE_MEMORY_HEAP_SPAN_HEADER 64
+
+/**
+ * @def SE_MEMORY_HEAP_LARGE
+ * @brief Значение класса размеров в заголовке спана большого блока.
+ */
+#define SE_MEMORY_HEAP_LARGE SE_MEMORY_HEAP_CLASS_COUNT
+
+/**
+ * @def SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT
+ * @brief Логарифм размера наименьшей корзины кэша больших блоков.
+ */
+#define SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT 16
+
+/**
+ * @def SE_MEMORY_HEAP_LARGE_CACHE_MAX_SHIFT
+ * @brief Логарифм размера наибольшего блока, попадающего в кэш больших блоков.
+ */
+#define SE_MEMORY_HEAP_LARGE_CACHE_MAX_SHIFT 25
+
+/**
+ * @def SE_MEMORY_HEAP_LARGE_CACHE_SLOTS
+ * @brief Количество блоков в одной корзине кэша больших блоков.
+ */
+#define SE_MEMORY_HEAP_LARGE_CACHE_SLOTS 8
+
+/**
+ * @def SE_MEMORY_HEAP_BATCH_BYTES
+ * @brief Целевой объем пачки, передаваемой между магазином и хранилищем.
+ */
+#define SE_MEMORY_HEAP_BATCH_BYTES 16384
+
+/**
+ * @def SE_MEMORY_HEAP_BATCH_MIN
+ * @brief Минимальное количество объектов в пачке.
+ */
+#define SE_MEMORY_HEAP_BATCH_MIN 4
+
+/**
+ * @def SE_MEMORY_HEAP_BATCH_MAX
+ * @brief Максимальное количество объектов в пачке.
+ */
+#define SE_MEMORY_HEAP_BATCH_MAX 64
+
+/**
+ * @brief Узел интрузивного списка свободных объектов (или спанов).
+ *
+ * Поле `count` заполнено только у головы списка, переданного в хранилище.
+ */
+typedef struct se_memory_heap_node
+{
+    struct se_memory_heap_node *next;  /**< Следующий узел списка. */
+    se_usize_t                  count; /**< Длина списка, начинающегося с этого узла. */
+} se_memory_heap_node_t;
+
+/**
+ * @brief Заголовок спана.
+ *
+ * Поля `node`, `fresh` и `fresh_end` спана класса размеров используются
+ * только пока спан лежит в хранилище частично нарезанных спанов.
+ */
+typedef struct se_memory_heap_span
+{
+    se_memory_heap_node_t node;       /**< Связь в хранилище частично нарезанных спанов. */
+    se_usize_t            size_class; /**< Класс размеров или `SE_MEMORY_HEAP_LARGE`. */
+    se_usize_t            size;       /**< Размер отображения в байтах. */
+    se_usize_t            offset;     /**< Смещение большого блока от начала спана. */
+    se_usize_t            cached;     /**< Большой блок возвращается в кэш при освобождении. */
+    se_u8_t              *fresh;      /**< Первый ни разу не выданный объект. */
+    se_u8_t              *fresh_end;  /**< Конец нарезаемой области. */
+} se_memory_heap_span_t;
+
+se_static_assert(sizeof(se_memory_heap_span_t) <= SE_MEMORY_HEAP_SPAN_HEADER,
+                 "Span header does not fit into the reserved area");
+
+/**
+ * @brief Магазин одного класса размеров в кэше потока.
+ */
+typedef struct se_memory_heap_bin
+{
+    se_memory_heap_node_t *head;      /**< Голова списка свободных объектов. */
+    se_usize_t             count;     /**< Количество объектов в списке. */
+    se_usize_t             limit;     /**< Порог сброса пачки в хранилище (0 — не вычислен). */
+    se_u8_t               *fresh;     /**< Нарезаемая область текущего спана потока. */
+    se_u8_t               *fresh_end; /**< Конец нарезаемой области. */
+} se_memory_heap_bin_t;
+
+/**
+ * @brief Кэш потока: магазины всех классов размеров.
+ */
+typedef struct se_memory_heap_cache
+{
+    se_memory_heap_bin_t bins[SE_MEMORY_HEAP_CLASS_COUNT];
+    bool                 registered; /**< Сброс при завершении потока зарегистрирован. */
+} se_memory_heap_cache_t;
+
+/**
+ * @brief Набор атомарных слотов центрального хранилища одного класса.
+ *
+ * Слот либо пуст, либо владеет целым списком узлов. Передача выполняется
+ * одной атомарной операцией над указателем, поэтому содержимое списка
+ * никогда не читается другим потоком до получения владения и проблема ABA
+ * не возникает.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_memory_heap_depot
+{
+    se_atomic_ptr_t slots[SE_MEMORY_HEAP_DEPOT_SLOTS];
+} se_memory_heap_depot_t;
+
+/**
+ * @brief Корзина кэша освобожденных больших блоков одного размера.
+ *
+ * Блоки лежат в кэше со сброшенными страницами (`se_memory_page_reset`):
+ * они не занимают физическую память, а при повторном использовании
+ * читаются как нули.
+ */
+typedef struct SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE)) se_memory_heap_large_cache
+{
+    se_atomic_ptr_t slots[SE_MEMORY_HEAP_LARGE_CACHE_SLOTS];
+} se_memory_heap_large_cache_t;
+
+static SE_ATTRIBUTE(THREAD_LOCAL)
+se_memory_heap_cache_t m_memory_heap_cache;
+
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+/**
+ * @brief Ключ локального хранилища потока, деструктор которого сбрасывает
+ * магазины при завершении потока.
+ */
+#    if defined(_WIN32)
+static INIT_ONCE m_memory_heap_exit_once = INIT_ONCE_STATIC_INIT;
+static DWORD     m_memory_heap_exit_key  = FLS_OUT_OF_INDEXES;
+#    else
+static pthread_once_t m_memory_heap_exit_once = PTHREAD_ONCE_INIT;
+static pthread_key_t  m_memory_heap_exit_key;
+static bool           m_memory_heap_exit_key_valid;
+#    endif
+#endif
+
+/**
+ * @brief Пачки свободных объектов по классам размеров.
+ */
+static se_memory_heap_depot_t m_memory_heap_batches[SE_MEMORY_HEAP_CLASS_COUNT];
+
+/**
+ * @brief Частично нарезанные спаны, оставленные завершившимися потоками.
+ */
+static se_memory_heap_depot_t m_memory_heap_spans[SE_MEMORY_HEAP_CLASS_COUNT];
+
+se_static_assert(SE_MEMORY_HEAP_HUGE_THRESHOLD > SE_MEMORY_HEAP_SMALL_MAX,
+                 "SE_MEMORY_HEAP_HUGE_THRESHOLD must exceed SE_MEMORY_HEAP_SMALL_MAX");
+
+/**
+ * @brief Размер блока, начиная с которого используются большие страницы.
+ */
+static se_usize_t m_memory_heap_huge_threshold = SE_MEMORY_HEAP_HUGE_THRESHOLD;
+
+/**
+ * @brief Кэш больших блоков по степеням двойки размера.
+ */
+static se_memory_heap_large_cache_t
+    m_memory_heap_large_cache[SE_MEMORY_HEAP_LARGE_CACHE_MAX_SHIFT - SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT + 1];
+
+static const se_memory_allocator_t m_memory_heap_allocator = {
+    .alloc         = se_memory_heap_alloc,
+    .dealloc       = se_memory_heap_dealloc,
+    .alloc_aligned = se_memory_heap_alloc_aligned,
+    .alloc_zeroed  = se_memory_heap_alloc_zeroed,
+};
+
+static inline se_usize_t
+se_memory_heap_class_index(se_usize_t size)
+{
+    if (size <= 128)
+    {
+        return size ? (size - 1) >> 4 : 0;
+    }
+
+    // Four classes per power of two: the two bits below the leading one select the step
+    unsigned long lg;
+    se_bit_scan_reverse64(&lg, (se_u64_t)(size - 1));
+    return 8 + ((lg - 7) << 2) + ((size - 1) >> (lg - 2)) - 4;
+}
+
+static inline se_usize_t
+se_memory_heap_class_size(se_usize_t index)
+{
+    if (index < 8)
+    {
+        return (index + 1) << 4;
+    }
+
+    const se_usize_t k  = index - 8;
+    const se_usize_t lg = 7 + (k >> 2);
+    return ((se_usize_t)1 << lg) + ((k & 3) + 1) * ((se_usize_t)1 << (lg - 2));
+}
+
+static inline se_usize_t
+se_memory_heap_class_batch(se_usize_t index)
+{
+    const se_usize_t batch = SE_MEMORY_HEAP_BATCH_BYTES / se_memory_heap_class_size(index);
+    return se_numeric_min(se_numeric_max(batch, SE_MEMORY_HEAP_BATCH_MIN), SE_MEMORY_HEAP_BATCH_MAX);
+}
+
+static inline se_memory_heap_span_t *
+se_memory_heap_span_of(const void *ptr)
+{
+    return se_addr_to_ptr(se_memory_heap_span_t,
+                          se_addr_align_down(se_ptr_to_addr(ptr), SE_MEMORY_HEAP_SPAN_SIZE));
+}
+
+static inline se_usize_t
+se_memory_heap_depot_hint(void)
+{
+    // Threads start scanning at different slots to spread contention
+    return (se_ptr_to_addr(&m_memory_heap_cache) >> 6) % SE_MEMORY_HEAP_DEPOT_SLOTS;
+}
+
+static void
+se_memory_heap_depot_push(se_memory_heap_depot_t *depot, se_memory_heap_node_t *list)
+{
+    const se_usize_t hint = se_memory_heap_depot_hint();
+
+    for (;;)
+    {
+        for (se_usize_t i = 0; i < SE_MEMORY_HEAP_DEPOT_SLOTS; ++i)
+        {
+            se_atomic_ptr_t *slot = &depot->slots[(hint + i) % SE_MEMORY_HEAP_DEPOT_SLOTS];
+
+            void *expected = nullptr;
+            if (!se_atomic_ptr_load(slot, SE_ATOMIC_ORDER_RELAXED) &&
+                se_atomic_ptr_compare_exchange_strong(
+                    slot, &expected, list, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED))
+            {
+                return;
+            }
+        }
+
+        // Every slot is occupied: take over one of the lists and append it
+        // to ours, so a push never fails and never waits for a consumer
+        se_memory_heap_node_t *other = se_atomic_ptr_exchange(&depot->slots[hint], nullptr, SE_ATOMIC_ORDER_ACQUIRE);
+        if (other)
+        {
+            se_memory_heap_node_t *tail = list;
+            while (tail->next)
+            {
+                tail = tail->next;
+            }
+
+            tail->next   = other;
+            list->count += other->count;
+        }
+    }
+}
+
+static se_memory_heap_node_t *
+se_memory_heap_depot_pop(se_memory_heap_depot_t *depot)
+{
+    const se_usize_t hint = se_memory_heap_depot_hint();
+
+    for (se_usize_t i = 0; i < SE_MEMORY_HEAP_DEPOT_SLOTS; ++i)
+    {
+        se_atomic_ptr_t *slot = &depot->slots[(hint + i) % SE_MEMORY_HEAP_DEPOT_SLOTS];
+
+        if (se_atomic_ptr_load(slot, SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_memory_heap_node_t *list = se_atomic_ptr_exchange(slot, nullptr, SE_ATOMIC_ORDER_ACQUIRE);
+            if (list)
+            {
+                return list;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Отделяет от магазина пачку из не более чем `batch` объектов.
+ */
+static se_memory_heap_node_t *
+se_memory_heap_bin_take_batch(se_memory_heap_bin_t *bin, se_usize_t batch)
+{
+    se_memory_heap_node_t *first = bin->head;
+    se_memory_heap_node_t *last  = first;
+    se_usize_t             count = 1;
+
+    while (count < batch && last->next)
+    {
+        last = last->next;
+        ++count;
+    }
+
+    bin->head   = last->next;
+    bin->count -= count;
+
+    last->next   = nullptr;
+    first->count = count;
+    return first;
+}
+
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+#    if defined(_WIN32)
+static void WINAPI
+se_memory_heap_thread_exit(void *value)
+{
+    if (value)
+    {
+        se_memory_heap_thread_flush();
+    }
+}
+
+static BOOL CALLBACK
+se_memory_heap_exit_key_create(PINIT_ONCE once, void *parameter, void **context)
+{
+    (void)once;
+    (void)parameter;
+    (void)context;
+
+    m_memory_heap_exit_key = FlsAlloc(se_memory_heap_thread_exit);
+    return TRUE;
+}
+#    else
+static void
+se_memory_heap_thread_exit(void *value)
+{
+    (void)value;
+    se_memory_heap_thread_flush();
+}
+
+static void
+se_memory_heap_exit_key_create(void)
+{
+    m_memory_heap_exit_key_valid = pthread_key_create(&m_memory_heap_exit_key, se_memory_heap_thread_exit) == 0;
+}
+#    endif
+#endif
+
+/**
+ * @brief Регистрирует сброс магазинов при завершении текущего потока.
+ *
+ * Вызывается на медленных путях, после которых в магазинах потока могут
+ * остаться объекты. Без локального хранилища потока магазины общие, и
+ * сбрасывать их при завершении отдельного потока нельзя.
+ */
+static inline void
+se_memory_heap_thread_register(void)
+{
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+    if (se_compiler_likely(m_memory_heap_cache.registered))
+    {
+        return;
+    }
+
+    m_memory_heap_cache.registered = true;
+
+#    if defined(_WIN32)
+    InitOnceExecuteOnce(&m_memory_heap_exit_once, se_memory_heap_exit_key_create, nullptr, nullptr);
+    if (m_memory_heap_exit_key != FLS_OUT_OF_INDEXES)
+    {
+        FlsSetValue(m_memory_heap_exit_key, &m_memory_heap_cache);
+    }
+#    else
+    pthread_once(&m_memory_heap_exit_once, se_memory_heap_exit_key_create);
+    if (m_memory_heap_exit_key_valid)
+    {
+        pthread_setspecific(m_memory_heap_exit_key, &m_memory_heap_cache);
+    }
+#    endif
+#endif
+}
+
+static void
+se_memory_heap_drain(se_memory_heap_bin_t *bin, se_usize_t index)
+{
+    const se_usize_t batch = se_memory_heap_class_batch(index);
+
+    if (!bin->limit)
+    {
+        // First free of this class in the thread
+        se_memory_heap_thread_register();
+
+        bin->limit = batch * 2;
+        if (bin->count < bin->limit)
+        {
+            return;
+        }
+    }
+
+    se_memory_heap_depot_push(&m_memory_heap_batches[index], se_memory_heap_bin_take_batch(bin, batch));
+}
+
+static se_memory_heap_span_t *
+se_memory_heap_span_pop(se_usize_t index)
+{
+    se_memory_heap_node_t *list = se_memory_heap_depot_pop(&m_memory_heap_spans[index]);
+    if (list && list->next)
+    {
+        list->next->count = list->count - 1;
+        se_memory_heap_depot_push(&m_memory_heap_spans[index], list->next);
+    }
+
+    return (se_memory_heap_span_t *)list;
+}
+
+static void *
+se_memory_heap_refill(se_memory_heap_bin_t *bin, se_usize_t index, bool *zero)
+{
+    se_memory_heap_thread_register();
+
+    // A popped list may hold several merged batches: all of it goes
+    // to the magazine and the surplus is drained back batch by batch
+    se_memory_heap_node_t *items = se_memory_heap_depot_pop(&m_memory_heap_batches[index]);
+    if (items)
+    {
+        bin->head  = items->next;
+        bin->count = items->count - 1;
+        *zero      = false;
+        return items;
+    }
+
+    const se_usize_t size = se_memory_heap_class_size(index);
+
+    if (bin->fresh == bin->fresh_end)
+    {
+        se_memory_heap_span_t *span = se_memory_heap_span_pop(index);
+        if (span)
+        {
+            bin->fresh     = span->fresh;
+            bin->fresh_end = span->fresh_end;
+        }
+        else
+        {
+            span = se_memory_page_alloc_aligned(SE_MEMORY_HEAP_SPAN_SIZE, SE_MEMORY_HEAP_SPAN_SIZE);
+            if (!span)
+            {
+                return nullptr;
+            }
+
+            const se_usize_t count = (SE_MEMORY_HEAP_SPAN_SIZE - SE_MEMORY_HEAP_SPAN_HEADER) / size;
+
+            span->size_class = index;
+            span->size       = SE_MEMORY_HEAP_SPAN_SIZE;
+            bin->fresh       = se_ptr_shift_unsafe(se_u8_t, span, SE_MEMORY_HEAP_SPAN_HEADER);
+            bin->fresh_end   = bin->fresh + count * size;
+        }
+    }
+
+    // Objects are carved lazily so untouched pages of the span stay unbacked;
+    // a never handed out object still holds the zeroes of the fresh mapping
+    void *ptr   = bin->fresh;
+    bin->fresh += size;
+    *zero       = true;
+    return ptr;
+}
+
+static bool
+se_memory_heap_large_cache_push(se_usize_t bucket, se_memory_heap_span_t *span)
+{
+    se_memory_heap_large_cache_t *cache = &m_memory_heap_large_cache[bucket];
+
+    for (se_usize_t i = 0; i < SE_MEMORY_HEAP_LARGE_CACHE_SLOTS; ++i)
+    {
+        void *expected = nullptr;
+        if (se_atomic_ptr_compare_exchange_strong(
+                &cache->slots[i], &expected, span, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static se_memory_heap_span_t *
+se_memory_heap_large_cache_pop(se_usize_t bucket)
+{
+    se_memory_heap_large_cache_t *cache = &m_memory_heap_large_cache[bucket];
+
+    for (se_usize_t i = 0; i < SE_MEMORY_HEAP_LARGE_CACHE_SLOTS; ++i)
+    {
+        if (se_atomic_ptr_load(&cache->slots[i], SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_memory_heap_span_t *span = se_atomic_ptr_exchange(&cache->slots[i], nullptr, SE_ATOMIC_ORDER_ACQUIRE);
+            if (span)
+            {
+                return span;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+static void *
+se_memory_heap_alloc_large(se_usize_t size, se_usize_t alignment, se_u32_t flags)
+{
+    // The header sits right below the block and must stay reachable
+    // by masking the user pointer down to the span alignment
+    const se_usize_t offset = se_numeric_max(alignment, SE_MEMORY_HEAP_SPAN_HEADER);
+    if (offset >= SE_MEMORY_HEAP_SPAN_SIZE || size > SE_USIZE_T_MAX / 2)
+    {
+        return nullptr;
+    }
+
+    if (size >= m_memory_heap_huge_threshold)
+    {
+        flags |= SE_MEMORY_PAGE_FLAG_HUGE;
+    }
+
+    se_memory_heap_span_t *span   = nullptr;
+    se_usize_t             mapped = size + offset;
+    se_usize_t             cached = 0;
+
+    if (flags == SE_MEMORY_PAGE_FLAG_NONE && mapped <= ((se_usize_t)1 << SE_MEMORY_HEAP_LARGE_CACHE_MAX_SHIFT))
+    {
+        // Cached blocks are rounded up to a power of two, so any block
+        // of a bucket fits; the unused tail is never touched and stays unbacked
+        unsigned long lg;
+        se_bit_scan_reverse64(&lg, (se_u64_t)(mapped - 1));
+
+        const se_usize_t shift = se_numeric_max(lg + 1, SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT);
+
+        mapped = (se_usize_t)1 << shift;
+        cached = 1;
+        span   = se_memory_heap_large_cache_pop(shift - SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT);
+    }
+    else
+    {
+        const se_usize_t granularity = (flags & SE_MEMORY_PAGE_FLAG_HUGE) ? se_memory_page_get_huge_size()
+                                                                           : se_memory_page_get_size();
+        mapped = se_addr_align_up(mapped, granularity);
+    }
+
+    // Both a fresh mapping and a cached block (reset on free) read as zeroes
+    if (!span)
+    {
+        span = se_memory_page_alloc_with_flags(mapped, SE_MEMORY_HEAP_SPAN_SIZE, flags);
+        if (!span)
+        {
+            return nullptr;
+        }
+    }
+
+    span->size_class = SE_MEMORY_HEAP_LARGE;
+    span->size       = mapped;
+    span->offset     = offset;
+    span->cached     = cached;
+    return se_ptr_shift_unsafe(void, span, offset);
+}
+
+static void
+se_memory_heap_dealloc_large(se_memory_heap_span_t *span)
+{
+    const se_usize_t mapped = span->size;
+
+    if (span->cached)
+    {
+        unsigned long lg;
+        se_bit_scan_reverse64(&lg, (se_u64_t)mapped);
+
+        // The pages go back to the system right away and fault in
+        // as zeroes when the block is reused
+        se_memory_page_reset(span, mapped);
+        if (se_memory_heap_large_cache_push(lg - SE_MEMORY_HEAP_LARGE_CACHE_MIN_SHIFT, span))
+        {
+            return;
+        }
+    }
+
+    se_memory_page_dealloc(span, mapped);
+}
+
+static inline void *
+se_memory_heap_alloc_class(se_usize_t index, bool *zero)
+{
+    se_memory_heap_bin_t  *bin  = &m_memory_heap_cache.bins[index];
+    se_memory_heap_node_t *node = bin->head;
+    if (node)
+    {
+        bin->head = node->next;
+        --bin->count;
+        *zero     = false;
+        return node;
+    }
+
+    return se_memory_heap_refill(bin, index, zero);
+}
+
+/**
+ * @brief Общая часть всех функций выделения.
+ *
+ * @param[out] zero Признак того, что блок заведомо заполнен нулями.
+ */
+static inline void *
+se_memory_heap_alloc_block(se_usize_t size, se_usize_t alignment, se_u32_t flags, bool *zero)
+{
+    if (alignment && !se_bit_is_one(alignment))
+    {
+        return nullptr;
+    }
+
+    if (flags != SE_MEMORY_PAGE_FLAG_NONE || size > SE_MEMORY_HEAP_SMALL_MAX ||
+        alignment > SE_MEMORY_HEAP_SPAN_HEADER)
+    {
+        *zero = true;
+        return se_memory_heap_alloc_large(size, alignment, flags);
+    }
+
+    if (alignment <= SE_MEMORY_HEAP_ALIGNMENT)
+    {
+        return se_memory_heap_alloc_class(se_memory_heap_class_index(size), zero);
+    }
+
+    // Objects start at the cache-line sized header of an aligned span, so a class
+    // whose size is a multiple of the alignment yields only aligned objects
+    se_usize_t index = se_memory_heap_class_index(se_addr_align_up(size, alignment));
+    while (se_memory_heap_class_size(index) & (alignment - 1))
+    {
+        ++index;
+    }
+
+    return se_memory_heap_alloc_class(index, zero);
+}
+
+void *
+se_memory_heap_alloc(se_usize_t size)
+{
+    bool zero;
+    return se_memory_heap_alloc_block(size, 0, SE_MEMORY_PAGE_FLAG_NONE, &zero);
+}
+
+void *
+se_memory_heap_alloc_aligned(se_usize_t size, se_usize_t alignment)
+{
+    bool zero;
+    return se_memory_heap_alloc_block(size, alignment, SE_MEMORY_PAGE_FLAG_NONE, &zero);
+}
+
+void *
+se_memory_heap_alloc_with_flags(se_usize_t size, se_usize_t alignment, se_u32_t flags)
+{
+    bool zero;
+    return se_memory_heap_alloc_block(size, alignment, flags, &zero);
+}
+
+void *
+se_memory_heap_alloc_zeroed(se_usize_t size, se_usize_t alignment)
+{
+    bool  zero;
+    void *ptr = se_memory_heap_alloc_block(size, alignment, SE_MEMORY_PAGE_FLAG_NONE, &zero);
+
+    // Only recycled objects need clearing: fresh pages are zeroed by the system
+    if (ptr && !zero)
+    {
+        se_memory_set(ptr, size, 0);
+    }
+
+    return ptr;
+}
+
+void
+se_memory_heap_dealloc(void *ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    se_memory_heap_span_t *span  = se_memory_heap_span_of(ptr);
+    const se_usize_t       index = span->size_class;
+
+    if (index == SE_MEMORY_HEAP_LARGE)
+    {
+        se_memory_heap_dealloc_large(span);
+        return;
+    }
+
+    // The object goes to the cache of the freeing thread: no lock is taken
+    // even when it was allocated by another thread
+    se_memory_heap_bin_t  *bin  = &m_memory_heap_cache.bins[index];
+    se_memory_heap_node_t *node = ptr;
+
+    node->next = bin->head;
+    bin->head  = node;
+
+    if (++bin->count >= bin->limit)
+    {
+        se_memory_heap_drain(bin, index);
+    }
+}
+
+se_usize_t
+se_memory_heap_get_size(const void *ptr)
+{
+    const se_memory_heap_span_t *span = se_memory_heap_span_of(ptr);
+
+    if (span->size_class == SE_MEMORY_HEAP_LARGE)
+    {
+        return span->size - span->offset;
+    }
+
+    return se_memory_heap_class_size(span->size_class);
+}
+
+void
+se_memory_heap_thread_flush(void)
+{
+    for (se_usize_t index = 0; index < SE_MEMORY_HEAP_CLASS_COUNT; ++index)
+    {
+        se_memory_heap_bin_t *bin = &m_memory_heap_cache.bins[index];
+
+        if (bin->head)
+        {
+            se_memory_heap_depot_push(&m_memory_heap_batches[index], se_memory_heap_bin_take_batch(bin, bin->count));
+        }
+
+        // The uncarved tail of the thread's span is handed over as a whole,
+        // without touching its pages
+        if (bin->fresh != bin->fresh_end)
+        {
+            se_memory_heap_span_t *span = se_memory_heap_span_of(bin->fresh);
+            span->node.next             = nullptr;
+            span->node.count            = 1;
+            span->fresh                 = bin->fresh;
+            span->fresh_end             = bin->fresh_end;
+
+            se_memory_heap_depot_push(&m_memory_heap_spans[index], &span->node);
+        }
+
+        bin->fresh     = nullptr;
+        bin->fresh_end = nullptr;
+    }
+
+    // A later allocation in the same thread (e.g. from another TLS
+    // destructor) registers the exit flush again
+    m_memory_heap_cache.registered = false;
+}
+
+se_usize_t
+se_memory_heap_set_huge_threshold(se_usize_t threshold)
+{
+    const se_usize_t prev        = m_memory_heap_huge_threshold;
+    m_memory_heap_huge_threshold = threshold;
+    return prev;
+}
+
+se_usize_t
+se_memory_heap_get_huge_threshold(void)
+{
+    return m_memory_heap_huge_threshold;
+}
+
+const se_memory_allocator_t *
+se_memory_heap_get_allocator(void)
+{
+    return &m_memory_heap_allocator;
+}
@@ -0,0 +1,201 @@
+#include <se/memory_map.h>
+
+#include <se/runtime_check.h>
+#include <se/memory_page.h>
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/bool.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+static void *
+se_memory_map_create(const char *path, se_usize_t *size, se_u32_t flags)
+{
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    se_runtime_check(file != INVALID_HANDLE_VALUE, SE_RUNTIME_ERROR_IO);
+
+    LARGE_INTEGER file_size;
+    const BOOL    sized = GetFileSizeEx(file, &file_size);
+    if (!sized || (se_u64_t)file_size.QuadPart > SE_USIZE_T_MAX || !file_size.QuadPart)
+    {
+        CloseHandle(file);
+        se_runtime_check(sized && (se_u64_t)file_size.QuadPart <= SE_USIZE_T_MAX, SE_RUNTIME_ERROR_IO);
+
+        *size = 0;
+        return nullptr;
+    }
+
+    const bool cow     = flags & SE_MEMORY_MAP_FLAG_COPY_ON_WRITE;
+    HANDLE     mapping = CreateFileMappingA(file, nullptr, cow ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    se_runtime_check(mapping, SE_RUNTIME_ERROR_IO);
+
+    // The view keeps the mapping object alive after its handle is closed
+    void *data = MapViewOfFile(mapping, cow ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    se_runtime_check(data, SE_RUNTIME_ERROR_IO);
+
+    *size = (se_usize_t)file_size.QuadPart;
+
+    if (flags & SE_MEMORY_MAP_FLAG_POPULATE)
+    {
+        // There is no MAP_POPULATE: read one byte per page to fault the file in
+        const se_usize_t page = se_memory_page_get_size();
+        for (se_usize_t offset = 0; offset < *size; offset += page)
+        {
+            (void)((volatile const se_u8_t *)data)[offset];
+        }
+    }
+
+    return data;
+}
+
+static void
+se_memory_map_destroy(void *data, se_usize_t size)
+{
+    (void)size;
+    UnmapViewOfFile(data);
+}
+
+#else
+
+static void *
+se_memory_map_create(const char *path, se_usize_t *size, se_u32_t flags)
+{
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    se_runtime_check(fd >= 0, SE_RUNTIME_ERROR_IO);
+
+    struct stat st;
+    const bool  stated = !fstat(fd, &st);
+    if (!stated || (se_u64_t)st.st_size > SE_USIZE_T_MAX || !st.st_size)
+    {
+        close(fd);
+        se_runtime_check(stated && (se_u64_t)st.st_size <= SE_USIZE_T_MAX, SE_RUNTIME_ERROR_IO);
+
+        // mmap() rejects zero-length mappings, an empty file maps to an empty view
+        *size = 0;
+        return nullptr;
+    }
+
+    int prot      = PROT_READ;
+    int map_flags = MAP_SHARED;
+
+    if (flags & SE_MEMORY_MAP_FLAG_COPY_ON_WRITE)
+    {
+        // Private writable pages are copied on the first write and never reach the file
+        prot |= PROT_WRITE;
+        map_flags = MAP_PRIVATE;
+    }
+
+#    ifdef MAP_POPULATE
+    if (flags & SE_MEMORY_MAP_FLAG_POPULATE)
+    {
+        map_flags |= MAP_POPULATE;
+    }
+#    endif
+
+    void *data = mmap(nullptr, (se_usize_t)st.st_size, prot, map_flags, fd, 0);
+    close(fd);
+    se_runtime_check(data != MAP_FAILED, SE_RUNTIME_ERROR_IO);
+
+#    ifndef MAP_POPULATE
+    if (flags & SE_MEMORY_MAP_FLAG_POPULATE)
+    {
+        madvise(data, (se_usize_t)st.st_size, MADV_WILLNEED);
+    }
+#    endif
+
+    *size = (se_usize_t)st.st_size;
+    return data;
+}
+
+static void
+se_memory_map_destroy(void *data, se_usize_t size)
+{
+    munmap(data, size);
+}
+
+#endif
+
+void
+se_memory_map_file(se_memory_map_t *self, const char *path, se_u32_t flags)
+{
+    se_runtime_check(self && path, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    self->data = se_memory_map_create(path, &self->size, flags);
+}
+
+void
+se_memory_map_advise(const se_memory_map_t *self,
+                     se_uoffset_t           offset,
+                     se_usize_t             size,
+                     se_memory_map_advice_t advice)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (offset >= self->size)
+    {
+        return;
+    }
+
+    // madvise() needs a page-aligned start address
+    const se_uoffset_t begin = se_addr_align_down(offset, se_memory_page_get_size());
+    const se_usize_t   end   = offset + se_numeric_min(size, self->size - offset);
+    void              *ptr   = se_ptr_shift_unsafe(void, self->data, begin);
+
+#ifdef _WIN32
+    if (advice == SE_MEMORY_MAP_ADVICE_WILLNEED)
+    {
+        WIN32_MEMORY_RANGE_ENTRY range = {ptr, end - begin};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    static const int advices[] = {
+        [SE_MEMORY_MAP_ADVICE_NORMAL]     = MADV_NORMAL,
+        [SE_MEMORY_MAP_ADVICE_SEQUENTIAL] = MADV_SEQUENTIAL,
+        [SE_MEMORY_MAP_ADVICE_RANDOM]     = MADV_RANDOM,
+        [SE_MEMORY_MAP_ADVICE_WILLNEED]   = MADV_WILLNEED,
+    };
+
+    se_runtime_check((se_usize_t)advice < sizeof(advices) / sizeof(advices[0]),
+                     SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+    madvise(ptr, end - begin, advices[advice]);
+#endif
+}
+
+se_memory_view_t
+se_memory_map_get_view(const se_memory_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // An empty file is not mapped; the map itself stands in as an empty range
+    const void *begin = self->data ? self->data : (const void *)self;
+    const se_memory_view_t view = {begin, se_ptr_shift_unsafe(void, begin, self->size)};
+    return view;
+}
+
+void
+se_memory_map_unmap(se_memory_map_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (self->data)
+    {
+        se_memory_map_destroy(self->data, self->size);
+    }
+
+    self->data = nullptr;
+    self->size = 0;
+}
@@ -0,0 +1,470 @@
+// mremap() is a GNU extension and is only declared with _GNU_SOURCE
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE
+#endif
+
+#include <se/memory_page.h>
+
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/memory.h>
+#include <se/atomic.h>
+#include <se/bool.h>
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#    ifndef __linux__
+#        include <stdio.h>
+#    endif
+#endif
+
+se_usize_t
+se_memory_page_get_size(void)
+{
+    // Racing threads store the same value, so a relaxed cache is enough
+    static se_atomic_usize_t cached_size;
+
+    se_usize_t page_size = se_atomic_usize_load(&cached_size, SE_ATOMIC_ORDER_RELAXED);
+    if (!page_size)
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        page_size = info.dwPageSize;
+#else
+        page_size = (se_usize_t)sysconf(_SC_PAGESIZE);
+#endif
+        se_atomic_usize_store(&cached_size, page_size, SE_ATOMIC_ORDER_RELAXED);
+    }
+    return page_size;
+}
+
+se_usize_t
+se_memory_page_get_huge_size(void)
+{
+#ifdef _WIN32
+    const se_usize_t huge_size = GetLargePageMinimum();
+    return huge_size ? huge_size : SE_MEMORY_PAGE_HUGE_SIZE;
+#else
+    return SE_MEMORY_PAGE_HUGE_SIZE;
+#endif
+}
+
+/**
+ * @brief Отображает страницы в физическую память записью в каждую из них.
+ *
+ * Используется там, где отображение нельзя заполнить при создании
+ * (обрезка под выравнивание, Windows).
+ */
+static void
+se_memory_page_populate(void *ptr, se_usize_t size)
+{
+#if defined(MADV_POPULATE_WRITE)
+    if (!madvise(ptr, size, MADV_POPULATE_WRITE))
+    {
+        return;
+    }
+#endif
+
+    // Fresh pages are zero-filled, so writing zero keeps the contents
+    const se_usize_t page = se_memory_page_get_size();
+    for (se_usize_t offset = 0; offset < size; offset += page)
+    {
+        ((volatile se_u8_t *)ptr)[offset] = 0;
+    }
+}
+
+#ifdef _WIN32
+
+static void *
+se_memory_page_map(se_usize_t size, se_usize_t alignment, DWORD type)
+{
+    if (alignment <= 64 * 1024)
+    {
+        // VirtualAlloc already aligns to the 64K allocation granularity
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | type, PAGE_READWRITE);
+    }
+
+    // VirtualFree cannot release part of a reservation: reserve an oversized
+    // range to find an aligned address, release it and commit exactly there.
+    // Another thread may take the range in between, hence the retries;
+    // they are bounded because a large-page commit may fail for good.
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        void *probe = VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+        if (!probe)
+        {
+            return nullptr;
+        }
+
+        VirtualFree(probe, 0, MEM_RELEASE);
+
+        void *aligned = se_addr_to_ptr(void, se_addr_align_up(se_ptr_to_addr(probe), alignment));
+        void *ptr     = VirtualAlloc(aligned, size, MEM_RESERVE | MEM_COMMIT | type, PAGE_READWRITE);
+        if (ptr)
+        {
+            return ptr;
+        }
+    }
+
+    return nullptr;
+}
+
+void *
+se_memory_page_alloc_with_flags(se_usize_t size, se_usize_t alignment, se_u32_t flags)
+{
+    alignment = se_numeric_max(alignment, se_memory_page_get_size());
+    size      = se_addr_align_up(size, se_memory_page_get_size());
+
+    void *ptr = nullptr;
+
+    if (flags & SE_MEMORY_PAGE_FLAG_HUGE)
+    {
+        // Large pages need SeLockMemoryPrivilege; without it fall back to small pages
+        const se_usize_t huge_size = se_memory_page_get_huge_size();
+
+        size      = se_addr_align_up(size, huge_size);
+        alignment = se_numeric_max(alignment, huge_size);
+        ptr       = se_memory_page_map(size, alignment, MEM_LARGE_PAGES);
+    }
+
+    if (!ptr)
+    {
+        ptr = se_memory_page_map(size, alignment, 0);
+    }
+
+    // Committed memory is still faulted in lazily, touch it to populate
+    if (ptr && (flags & SE_MEMORY_PAGE_FLAG_POPULATE))
+    {
+        se_memory_page_populate(ptr, size);
+    }
+
+    return ptr;
+}
+
+#else
+
+static void *
+se_memory_page_map(se_usize_t size, se_usize_t alignment, int flags)
+{
+    if (alignment <= se_memory_page_get_size())
+    {
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    // Map with slack and unmap the misaligned head and the unused tail
+    const se_usize_t mapped = size + alignment;
+
+    se_u8_t *raw = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    se_u8_t         *ptr  = se_addr_to_ptr(se_u8_t, se_addr_align_up(se_ptr_to_addr(raw), alignment));
+    const se_usize_t head = ptr - raw;
+    const se_usize_t tail = mapped - head - size;
+
+    if (head)
+    {
+        munmap(raw, head);
+    }
+
+    if (tail)
+    {
+        munmap(ptr + size, tail);
+    }
+
+    return ptr;
+}
+
+void *
+se_memory_page_alloc_with_flags(se_usize_t size, se_usize_t alignment, se_u32_t flags)
+{
+    const se_usize_t page_size = se_memory_page_get_size();
+
+    alignment = se_numeric_max(alignment, page_size);
+    size      = se_addr_align_up(size, page_size);
+
+    int map_flags = 0;
+
+#ifdef MAP_NORESERVE
+    if (flags & SE_MEMORY_PAGE_FLAG_LAZY)
+    {
+        map_flags |= MAP_NORESERVE;
+    }
+#endif
+
+    // MAP_POPULATE would also fault in the slack trimmed off for alignment,
+    // so it is only passed when the mapping is used as is
+    const bool populate = flags & SE_MEMORY_PAGE_FLAG_POPULATE;
+
+    if (flags & SE_MEMORY_PAGE_FLAG_HUGE)
+    {
+        const se_usize_t huge_size = se_memory_page_get_huge_size();
+
+        size      = se_addr_align_up(size, huge_size);
+        alignment = se_numeric_max(alignment, huge_size);
+
+#ifdef MAP_HUGETLB
+        // Explicit huge pages come from the hugetlbfs pool and are naturally
+        // aligned to their size; the pool is often empty, so failure is expected
+        if (alignment == huge_size)
+        {
+            int huge_flags = map_flags | MAP_HUGETLB;
+#    ifdef MAP_POPULATE
+            if (populate)
+            {
+                huge_flags |= MAP_POPULATE;
+            }
+#    endif
+            void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | huge_flags, -1, 0);
+            if (ptr != MAP_FAILED)
+            {
+                return ptr;
+            }
+        }
+#endif
+    }
+
+#ifdef MAP_POPULATE
+    if (populate && alignment == page_size)
+    {
+        return se_memory_page_map(size, alignment, map_flags | MAP_POPULATE);
+    }
+#endif
+
+    void *ptr = se_memory_page_map(size, alignment, map_flags);
+    if (!ptr)
+    {
+        return nullptr;
+    }
+
+#ifdef MADV_HUGEPAGE
+    // Transparent huge pages: advise before populating so the faults
+    // are served with huge pages
+    if (flags & SE_MEMORY_PAGE_FLAG_HUGE)
+    {
+        madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    if (populate)
+    {
+        se_memory_page_populate(ptr, size);
+    }
+
+    return ptr;
+}
+
+#endif
+
+void *
+se_memory_page_alloc(se_usize_t size)
+{
+    return se_memory_page_alloc_with_flags(size, 0, SE_MEMORY_PAGE_FLAG_NONE);
+}
+
+void *
+se_memory_page_alloc_aligned(se_usize_t size, se_usize_t alignment)
+{
+    return se_memory_page_alloc_with_flags(size, alignment, SE_MEMORY_PAGE_FLAG_NONE);
+}
+
+void *
+se_memory_page_realloc(void *ptr, se_usize_t old_size, se_usize_t new_size)
+{
+    if (!ptr)
+    {
+        return se_memory_page_alloc(new_size);
+    }
+
+    const se_usize_t page_size = se_memory_page_get_size();
+
+    old_size = se_addr_align_up(old_size, page_size);
+    new_size = se_addr_align_up(new_size, page_size);
+
+    if (old_size == new_size)
+    {
+        return ptr;
+    }
+
+#ifdef MREMAP_MAYMOVE
+    // The kernel moves the page table entries, the data itself is not copied
+    void *moved = mremap(ptr, old_size, new_size, MREMAP_MAYMOVE);
+    return moved == MAP_FAILED ? nullptr : moved;
+#else
+    void *moved = se_memory_page_alloc(new_size);
+    if (moved)
+    {
+        se_memory_copy(moved, new_size, ptr, old_size);
+        se_memory_page_dealloc(ptr, old_size);
+    }
+    return moved;
+#endif
+}
+
+void
+se_memory_page_reset(void *ptr, se_usize_t size)
+{
+    size = se_addr_align_up(size, se_memory_page_get_size());
+
+#ifdef _WIN32
+    // Re-committing after a decommit yields zero pages without physical backing
+    VirtualFree(ptr, size, MEM_DECOMMIT);
+    VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE);
+#else
+    madvise(ptr, size, MADV_DONTNEED);
+#endif
+}
+
+void
+se_memory_page_dealloc(void *ptr, se_usize_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    (void)size;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, se_addr_align_up(size, se_memory_page_get_size()));
+#endif
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Создает безымянный объект разделяемой памяти заданного размера.
+ * @return Дескриптор объекта или -1 при ошибке.
+ */
+static int
+se_memory_page_shared_object(se_usize_t size)
+{
+#    ifdef __linux__
+    const int fd = memfd_create("se_memory_page_mirrored", MFD_CLOEXEC);
+#    else
+    // The name is only needed until the object is unlinked right below
+    static unsigned counter = 0;
+    char            name[64];
+    snprintf(name, sizeof(name), "/se_mirrored_%ld_%u", (long)getpid(), counter++);
+
+    const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0)
+    {
+        shm_unlink(name);
+    }
+#    endif
+
+    if (fd >= 0 && ftruncate(fd, (off_t)size))
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+#endif
+
+void *
+se_memory_page_alloc_mirrored(se_usize_t size)
+{
+    if (!size || size > SE_USIZE_T_MAX / 2)
+    {
+        return nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        (DWORD)((se_u64_t)size >> 32), (DWORD)size, nullptr);
+    if (!mapping)
+    {
+        return nullptr;
+    }
+
+    // Another thread may take the released range before both views are mapped
+    for (int attempt = 0; attempt < 16; ++attempt)
+    {
+        void *base = VirtualAlloc(nullptr, 2 * size, MEM_RESERVE, PAGE_NOACCESS);
+        if (!base)
+        {
+            break;
+        }
+        VirtualFree(base, 0, MEM_RELEASE);
+
+        void *lower = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size, base);
+        void *upper = lower ? MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size,
+                                              se_ptr_shift_unsafe(void, base, size))
+                            : nullptr;
+        if (upper)
+        {
+            CloseHandle(mapping);
+            return base;
+        }
+
+        if (lower)
+        {
+            UnmapViewOfFile(lower);
+        }
+    }
+
+    CloseHandle(mapping);
+    return nullptr;
+#else
+    if (size % se_memory_page_get_size())
+    {
+        return nullptr;
+    }
+
+    const int fd = se_memory_page_shared_object(size);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    // Reserve both halves first so that the fixed mappings cannot clobber anything
+    void *base = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        close(fd);
+        return nullptr;
+    }
+
+    void *upper_half = se_ptr_shift_unsafe(void, base, size);
+    void *lower      = mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void *upper      = mmap(upper_half, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+
+    if (lower == MAP_FAILED || upper == MAP_FAILED)
+    {
+        munmap(base, 2 * size);
+        return nullptr;
+    }
+    return base;
+#endif
+}
+
+void
+se_memory_page_dealloc_mirrored(void *ptr, se_usize_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(se_ptr_shift_unsafe(void, ptr, size));
+    UnmapViewOfFile(ptr);
+#else
+    munmap(ptr, 2 * size);
+#endif
+}
@@ -0,0 +1,157 @@
+#include <se/memory_pool.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/addr_util.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/bit_util.h>
+#include <se/nullptr.h>
+#include <se/memory.h>
+
+/**
+ * @brief Заголовок сляба, расположенный в начале каждого выделенного блока.
+ */
+typedef struct se_memory_pool_slab
+{
+    struct se_memory_pool_slab *next; /**< Следующий сляб пула. */
+} se_memory_pool_slab_t;
+
+static void
+se_memory_pool_grow(se_memory_pool_t *self)
+{
+    const se_usize_t header_size = sizeof(se_memory_pool_slab_t) + self->alignment - 1;
+
+    // A slab that does not fit in se_usize_t would wrap to a short block
+    se_runtime_check(self->slab_capacity <= (SE_USIZE_T_MAX - header_size) / self->element_size,
+                     SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    const se_usize_t slots_size = self->element_size * self->slab_capacity;
+    const se_usize_t slab_size  = header_size + slots_size;
+
+    se_memory_pool_slab_t *slab;
+
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    // An allocator that knows where its memory comes from hands out a zeroed
+    // slab for free (fresh pages), and its slots then skip the per-slot memset.
+    // Slabs always go through se_runtime_allocator_*: the runtime allocator
+    // may keep a header in front of each block (SE_LIBRARY_OPTION_ALLOC_STATS).
+    slab             = se_runtime_allocator_alloc_zeroed(slab_size);
+    self->end_zeroed = true;
+#else
+    slab             = se_runtime_allocator_alloc(slab_size);
+    self->end_zeroed = false;
+#endif
+
+    slab->next  = self->slabs;
+    self->slabs = slab;
+
+    const se_uaddr_t slots = se_addr_align_up(se_ptr_to_addr(slab + 1), self->alignment);
+    self->cur              = se_addr_to_ptr(void, slots);
+    self->end              = se_addr_to_ptr(void, slots + slots_size);
+}
+
+void
+se_memory_pool_init(se_memory_pool_t *self,
+                    se_usize_t        element_size,
+                    se_usize_t        alignment,
+                    se_usize_t        slab_capacity)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    if (!alignment)
+    {
+        alignment = SE_MEMORY_POOL_ALIGNMENT;
+    }
+
+    se_runtime_check(se_bit_is_one(alignment), SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    // The slot must be able to hold the free list link
+    element_size = se_numeric_max(element_size, sizeof(void *));
+    se_runtime_check(element_size <= SE_USIZE_T_MAX - (alignment - 1), SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    self->element_size  = se_addr_align_up(element_size, alignment);
+    self->alignment     = alignment;
+    self->slab_capacity = slab_capacity ? slab_capacity : SE_MEMORY_POOL_SLAB_CAPACITY;
+    self->free_list     = nullptr;
+    self->slabs         = nullptr;
+    self->cur           = nullptr;
+    self->end           = nullptr;
+    self->end_zeroed    = false;
+}
+
+void
+se_memory_pool_deinit(se_memory_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_memory_pool_slab_t *slab = self->slabs;
+    while (slab)
+    {
+        se_memory_pool_slab_t *next = slab->next;
+        se_runtime_allocator_dealloc(slab);
+        slab = next;
+    }
+
+    self->free_list = nullptr;
+    self->slabs     = nullptr;
+    self->cur       = nullptr;
+    self->end       = nullptr;
+}
+
+void *
+se_memory_pool_alloc(se_memory_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    void *ptr = self->free_list;
+    if (ptr)
+    {
+        self->free_list = *(void **)ptr;
+
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+        se_memory_set(ptr, self->element_size, 0);
+#endif
+    }
+    else
+    {
+        // Slots of the current slab are handed out lazily, so a fresh slab
+        // is never touched beyond the elements actually requested
+        if (self->cur == self->end)
+        {
+            se_memory_pool_grow(self);
+        }
+
+        ptr       = self->cur;
+        self->cur = se_ptr_shift_unsafe(void, self->cur, self->element_size);
+
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+        if (!self->end_zeroed)
+        {
+            se_memory_set(ptr, self->element_size, 0);
+        }
+#endif
+    }
+
+    return ptr;
+}
+
+void
+se_memory_pool_dealloc(se_memory_pool_t *self, void *ptr)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (ptr)
+    {
+        *(void **)ptr   = self->free_list;
+        self->free_list = ptr;
+    }
+}
+
+se_usize_t
+se_memory_pool_get_element_size(const se_memory_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->element_size;
+}
@@ -53,33 +53,23 @@ se_memory_raw_compare_rev(const void *lhs,
 const void *
 se_memory_raw_find(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
 {
-    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(se_ptr_range_is_valid(lhs, lhs_end) && se_ptr_range_is_valid(rhs, rhs_end),
+                     SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
 
-    const se_u8_t *_lhs_end = se_ptr_cast(se_u8_t, lhs_end);
-    for (const se_u8_t *_lhs = lhs; _lhs < _lhs_end; ++_lhs)
-    {
-        if (!se_memory_raw_compare(_lhs, lhs_end, rhs, rhs_end))
-        {
-            return _lhs;
-        }
-    }
-    return nullptr;
+    se_usize_t lhs_size = se_ptr_to_addr_diff(lhs_end, lhs);
+    se_usize_t rhs_size = se_ptr_to_addr_diff(rhs_end, rhs);
+    return se_memory_find(lhs, lhs_size, rhs, rhs_size);
 }
 
 const void *
 se_memory_raw_find_rev(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
 {
-    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(se_ptr_range_is_valid(lhs, lhs_end) && se_ptr_range_is_valid(rhs, rhs_end),
+                     SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
 
-    const se_u8_t *_lhs = se_ptr_cast(se_u8_t, lhs);
-    for (const se_u8_t *_lhs_end = lhs_end; _lhs_end > _lhs; --_lhs_end)
-    {
-        if (!se_memory_raw_compare_rev(lhs, _lhs_end, rhs, rhs_end))
-        {
-            return se_ptr_subtract_unsafe(void, _lhs_end, se_ptr_to_addr_diff(rhs_end, rhs));
-        }
-    }
-    return nullptr;
+    se_usize_t lhs_size = se_ptr_to_addr_diff(lhs_end, lhs);
+    se_usize_t rhs_size = se_ptr_to_addr_diff(rhs_end, rhs);
+    return se_memory_find_rev(lhs, lhs_size, rhs, rhs_size);
 }
 
 void *
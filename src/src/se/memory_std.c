@@ -4,6 +4,7 @@
 #include <se/runtime_check.h>
 #include <se/bit_util.h>
 #include <se/ptr_util.h>
+#include <se/bool.h>
 
 #if defined(SE_COMPILE_OPTION_SSE2) || defined(SE_COMPILE_OPTION_AVX2) ||                          \
     defined(SE_COMPILE_OPTION_AVX512)
@@ -13,10 +14,8 @@
 #endif
 
 void *
-se_memory_std_copy(void *dst, const void *src, se_usize_t n)
+se_memory_std_copy_unchecked(void *dst, const void *src, se_usize_t n)
 {
-    se_runtime_check(dst && src, SE_RUNTIME_ERROR_NULL_POINTER);
-
     se_u8_t       *d = se_ptr_cast(se_u8_t, dst);
     const se_u8_t *s = se_ptr_cast(const se_u8_t, src);
 
@@ -104,10 +103,15 @@ se_memory_std_copy(void *dst, const void *src, se_usize_t n)
 }
 
 void *
-se_memory_std_copy_reverse(void *dst, const void *src, se_usize_t n)
+se_memory_std_copy(void *dst, const void *src, se_usize_t n)
 {
     se_runtime_check(dst && src, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_std_copy_unchecked(dst, src, n);
+}
 
+void *
+se_memory_std_copy_reverse_unchecked(void *dst, const void *src, se_usize_t n)
+{
     se_u8_t       *d = se_ptr_shift_unsafe(se_u8_t, dst, n);
     const se_u8_t *s = se_ptr_shift_unsafe(const se_u8_t, src, n);
 
@@ -195,22 +199,34 @@ se_memory_std_copy_reverse(void *dst, const void *src, se_usize_t n)
 }
 
 void *
-se_memory_std_move(void *dst, const void *src, se_usize_t n)
+se_memory_std_copy_reverse(void *dst, const void *src, se_usize_t n)
+{
+    se_runtime_check(dst && src, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_std_copy_reverse_unchecked(dst, src, n);
+}
+
+void *
+se_memory_std_move_unchecked(void *dst, const void *src, se_usize_t n)
 {
     const void *_src_end = se_ptr_add(const void *, src, n);
     if (se_ptr_ranges_is_overlap(dst, src, _src_end))
     {
-        void *_dst = se_memory_std_copy_reverse(dst, src, n);
+        void *_dst = se_memory_std_copy_reverse_unchecked(dst, src, n);
         return se_ptr_add(void *, _dst, n);
     }
-    return se_memory_std_copy(dst, src, n);
+    return se_memory_std_copy_unchecked(dst, src, n);
 }
 
-const void *
-se_memory_std_compare(const void *lhs, const void *rhs, se_usize_t n)
+void *
+se_memory_std_move(void *dst, const void *src, se_usize_t n)
 {
-    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(dst && src, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_std_move_unchecked(dst, src, n);
+}
 
+const void *
+se_memory_std_compare_unchecked(const void *lhs, const void *rhs, se_usize_t n)
+{
     const se_u8_t *l = se_ptr_cast(const se_u8_t, lhs);
     const se_u8_t *r = se_ptr_cast(const se_u8_t, rhs);
 
@@ -363,6 +379,13 @@ se_memory_std_compare(const void *lhs, const void *rhs, se_usize_t n)
     return nullptr;
 }
 
+const void *
+se_memory_std_compare(const void *lhs, const void *rhs, se_usize_t n)
+{
+    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_std_compare_unchecked(lhs, rhs, n);
+}
+
 const void *
 se_memory_std_compare_reverse(const void *lhs, const void *rhs, se_usize_t n)
 {
@@ -489,11 +512,167 @@ se_memory_std_compare_reverse(const void *lhs, const void *rhs, se_usize_t n)
     return nullptr;
 }
 
-void *
-se_memory_std_set(void *dst, se_usize_t len, se_u8_t val)
+/**
+ * @brief Проверяет кандидата, у которого уже совпали первый и последний байты.
+ */
+static bool
+se_memory_std_find_match(const se_u8_t *l, const se_u8_t *r, se_usize_t m)
 {
-    se_runtime_check(dst, SE_RUNTIME_ERROR_NULL_POINTER);
+    return m <= 2 || !se_memory_std_compare_unchecked(l + 1, r + 1, m - 2);
+}
+
+const void *
+se_memory_std_find(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size)
+{
+    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (rhs_size > lhs_size)
+    {
+        return nullptr;
+    }
 
+    if (!rhs_size)
+    {
+        return lhs;
+    }
+
+    const se_u8_t   *l     = se_ptr_cast(const se_u8_t, lhs);
+    const se_u8_t   *r     = se_ptr_cast(const se_u8_t, rhs);
+    const se_usize_t last  = rhs_size - 1;
+    const se_usize_t count = lhs_size - last; // Number of candidate positions
+    se_usize_t       i     = 0;
+
+    // Candidates are filtered by the first and the last byte of the needle
+    // for a whole vector of positions at once; only survivors are compared.
+#ifdef SE_COMPILE_OPTION_AVX2
+    const __m256i first32 = _mm256_set1_epi8((char)r[0]);
+    const __m256i last32  = _mm256_set1_epi8((char)r[last]);
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i head = _mm256_loadu_si256((__m256i const *)(l + i));
+        const __m256i tail = _mm256_loadu_si256((__m256i const *)(l + i + last));
+        se_uint_t     mask = (se_uint_t)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, first32), _mm256_cmpeq_epi8(tail, last32)));
+        while (mask)
+        {
+            se_ulong_t bit;
+            se_bit_scan_forward32(&bit, mask);
+            if (se_memory_std_find_match(l + i + bit, r, rhs_size))
+            {
+                return l + i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+#ifdef SE_COMPILE_OPTION_SSE2
+    const __m128i first16 = _mm_set1_epi8((char)r[0]);
+    const __m128i last16  = _mm_set1_epi8((char)r[last]);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i head = _mm_loadu_si128((__m128i const *)(l + i));
+        const __m128i tail = _mm_loadu_si128((__m128i const *)(l + i + last));
+        se_uint_t     mask = (se_uint_t)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, first16), _mm_cmpeq_epi8(tail, last16)));
+        while (mask)
+        {
+            se_ulong_t bit;
+            se_bit_scan_forward32(&bit, mask);
+            if (se_memory_std_find_match(l + i + bit, r, rhs_size))
+            {
+                return l + i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        if (l[i] == r[0] && l[i + last] == r[last] && se_memory_std_find_match(l + i, r, rhs_size))
+        {
+            return l + i;
+        }
+    }
+    return nullptr;
+}
+
+const void *
+se_memory_std_find_reverse(const void *lhs, se_usize_t lhs_size, const void *rhs, se_usize_t rhs_size)
+{
+    se_runtime_check(lhs && rhs, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (rhs_size > lhs_size)
+    {
+        return nullptr;
+    }
+
+    if (!rhs_size)
+    {
+        return se_ptr_shift_unsafe(const void, lhs, lhs_size);
+    }
+
+    const se_u8_t   *l    = se_ptr_cast(const se_u8_t, lhs);
+    const se_u8_t   *r    = se_ptr_cast(const se_u8_t, rhs);
+    const se_usize_t last = rhs_size - 1;
+    se_usize_t       i    = lhs_size - last; // Candidates [0, i) are left
+
+#ifdef SE_COMPILE_OPTION_AVX2
+    const __m256i first32 = _mm256_set1_epi8((char)r[0]);
+    const __m256i last32  = _mm256_set1_epi8((char)r[last]);
+    for (; i >= 32; i -= 32)
+    {
+        const se_u8_t *block = l + i - 32;
+        const __m256i  head  = _mm256_loadu_si256((__m256i const *)block);
+        const __m256i  tail  = _mm256_loadu_si256((__m256i const *)(block + last));
+        se_uint_t      mask  = (se_uint_t)_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, first32), _mm256_cmpeq_epi8(tail, last32)));
+        while (mask)
+        {
+            se_ulong_t bit;
+            se_bit_scan_reverse32(&bit, mask);
+            if (se_memory_std_find_match(block + bit, r, rhs_size))
+            {
+                return block + bit;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+#ifdef SE_COMPILE_OPTION_SSE2
+    const __m128i first16 = _mm_set1_epi8((char)r[0]);
+    const __m128i last16  = _mm_set1_epi8((char)r[last]);
+    for (; i >= 16; i -= 16)
+    {
+        const se_u8_t *block = l + i - 16;
+        const __m128i  head  = _mm_loadu_si128((__m128i const *)block);
+        const __m128i  tail  = _mm_loadu_si128((__m128i const *)(block + last));
+        se_uint_t      mask  = (se_uint_t)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, first16), _mm_cmpeq_epi8(tail, last16)));
+        while (mask)
+        {
+            se_ulong_t bit;
+            se_bit_scan_reverse32(&bit, mask);
+            if (se_memory_std_find_match(block + bit, r, rhs_size))
+            {
+                return block + bit;
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+    while (i--)
+    {
+        if (l[i] == r[0] && l[i + last] == r[last] && se_memory_std_find_match(l + i, r, rhs_size))
+        {
+            return l + i;
+        }
+    }
+    return nullptr;
+}
+
+void *
+se_memory_std_set_unchecked(void *dst, se_usize_t len, se_u8_t val)
+{
     se_u8_t *d = (se_u8_t *)dst;
 
     // Precompute values once
@@ -641,4 +820,11 @@ se_memory_std_set(void *dst, se_usize_t len, se_u8_t val)
         *d++ = val;
     }
     return d;
-}
\ No newline at end of file
+}
+
+void *
+se_memory_std_set(void *dst, se_usize_t len, se_u8_t val)
+{
+    se_runtime_check(dst, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_memory_std_set_unchecked(dst, len, val);
+}
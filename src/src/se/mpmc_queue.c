@@ -0,0 +1,432 @@
+#include <se/mpmc_queue.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/memory_std.h>
+#include <se/ptr_util.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+/**
+ * @brief Слово ожидания одной стороны очереди: эпоха в старших битах
+ *        и флаг «есть спящие» в младшем.
+ *
+ * Засыпающий поток устанавливает флаг и спит, пока слово не изменится;
+ * противоположная сторона после публикации будит всех спящих, только
+ * если флаг установлен, и одновременно сбрасывает его, увеличивая эпоху.
+ * Поэтому, пока разбуженный поток не получил процессор, следующие
+ * публикации не делают системных вызовов.
+ */
+typedef se_atomic_u32_t se_mpmc_queue_waiters_t;
+
+typedef struct se_mpmc_queue_control
+{
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t enqueue_position;
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t dequeue_position;
+
+    // Producers wait for free cells, consumers for published ones
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_mpmc_queue_waiters_t not_full;
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_mpmc_queue_waiters_t not_empty;
+} se_mpmc_queue_control_t;
+
+static se_mpmc_queue_control_t *
+se_mpmc_queue_control(const se_mpmc_queue_t *self)
+{
+    return se_ptr_cast(se_mpmc_queue_control_t, self->control);
+}
+
+static se_atomic_usize_t *
+se_mpmc_queue_sequence(const se_mpmc_queue_t *self, se_usize_t position)
+{
+    const se_usize_t offset = (position & (self->capacity - 1)) * self->cell_size;
+    return se_ptr_shift_unsafe(se_atomic_usize_t, self->cells, offset);
+}
+
+static void *
+se_mpmc_queue_data(const se_mpmc_queue_t *self, se_usize_t position)
+{
+    return se_ptr_shift_unsafe(void, se_mpmc_queue_sequence(self, position), sizeof(se_usize_t));
+}
+
+/**
+ * @brief Захватывает до `count` подряд идущих ячеек своей стороны.
+ *
+ * Ячейка готова для позиции `p`, если ее номер равен `p + ready`
+ * (0 для производителей, 1 для потребителей).
+ *
+ * @return Количество захваченных ячеек; первая позиция записывается в `first`.
+ */
+static se_usize_t
+se_mpmc_queue_claim(se_mpmc_queue_t   *self,
+                    se_atomic_usize_t *position,
+                    se_usize_t         ready,
+                    se_usize_t         count,
+                    se_usize_t        *first)
+{
+    se_usize_t current = se_atomic_usize_load(position, SE_ATOMIC_ORDER_RELAXED);
+
+    for (;;)
+    {
+        se_usize_t claimed = 0;
+        se_ssize_t diff    = 0;
+
+        while (claimed < count)
+        {
+            const se_usize_t sequence =
+                se_atomic_usize_load(se_mpmc_queue_sequence(self, current + claimed), SE_ATOMIC_ORDER_ACQUIRE);
+
+            diff = (se_ssize_t)(sequence - (current + claimed + ready));
+            if (diff)
+            {
+                break;
+            }
+            ++claimed;
+        }
+
+        if (!claimed)
+        {
+            // Behind by a lap: full for producers, empty for consumers
+            if (diff < 0)
+            {
+                return 0;
+            }
+
+            // Another thread took the cell first
+            current = se_atomic_usize_load(position, SE_ATOMIC_ORDER_RELAXED);
+            continue;
+        }
+
+        // Cells after a successful CAS stay ready: only their owner advances them.
+        // seq_cst orders the claim before the waiter check in se_mpmc_queue_notify.
+        if (se_atomic_usize_compare_exchange_weak(
+                position, &current, current + claimed, SE_ATOMIC_ORDER_SEQ_CST, SE_ATOMIC_ORDER_RELAXED))
+        {
+            *first = current;
+            return claimed;
+        }
+    }
+}
+
+static void
+se_mpmc_queue_notify(se_mpmc_queue_waiters_t *waiters)
+{
+    // The claiming CAS and this load are both seq_cst, as are the waiter's
+    // flag update and its position check: either the waiter sees the claimed
+    // cells or this side sees the flag. On x86 the load is a plain move.
+    se_u32_t state = se_atomic_u32_load(waiters, SE_ATOMIC_ORDER_SEQ_CST);
+
+    while (state & 1)
+    {
+        // Next epoch with the flag cleared
+        if (se_atomic_u32_compare_exchange_weak(
+                waiters, &state, state + 1, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_futex_wake(waiters, SE_FUTEX_WAKE_ALL);
+            return;
+        }
+    }
+}
+
+static se_u32_t
+se_mpmc_queue_prepare_park(se_mpmc_queue_waiters_t *waiters)
+{
+    return se_atomic_u32_fetch_or(waiters, 1, SE_ATOMIC_ORDER_SEQ_CST) | 1;
+}
+
+/**
+ * @brief Возвращает количество ячеек, захваченных производителями и еще
+ *        не захваченных потребителями (включая записываемые прямо сейчас).
+ */
+static se_usize_t
+se_mpmc_queue_claimed(se_mpmc_queue_control_t *control)
+{
+    const se_usize_t dequeued = se_atomic_usize_load(&control->dequeue_position, SE_ATOMIC_ORDER_SEQ_CST);
+    const se_usize_t enqueued = se_atomic_usize_load(&control->enqueue_position, SE_ATOMIC_ORDER_SEQ_CST);
+    return enqueued - dequeued;
+}
+
+static se_usize_t
+se_mpmc_queue_push(se_mpmc_queue_t *self, const void *elements, se_usize_t count)
+{
+    se_mpmc_queue_control_t *control = se_mpmc_queue_control(self);
+
+    se_usize_t       first   = 0;
+    const se_usize_t claimed = se_mpmc_queue_claim(self, &control->enqueue_position, 0, count, &first);
+
+    for (se_usize_t i = 0; i < claimed; ++i)
+    {
+        se_memory_std_copy(se_mpmc_queue_data(self, first + i),
+                           se_ptr_shift_unsafe(const void, elements, i * self->element_size),
+                           self->element_size);
+        se_atomic_usize_store(se_mpmc_queue_sequence(self, first + i), first + i + 1, SE_ATOMIC_ORDER_RELEASE);
+    }
+
+    if (claimed)
+    {
+        se_mpmc_queue_notify(&control->not_empty);
+    }
+    return claimed;
+}
+
+static se_usize_t
+se_mpmc_queue_pop(se_mpmc_queue_t *self, void *elements, se_usize_t count)
+{
+    se_mpmc_queue_control_t *control = se_mpmc_queue_control(self);
+
+    se_usize_t       first   = 0;
+    const se_usize_t claimed = se_mpmc_queue_claim(self, &control->dequeue_position, 1, count, &first);
+
+    for (se_usize_t i = 0; i < claimed; ++i)
+    {
+        se_memory_std_copy(se_ptr_shift_unsafe(void, elements, i * self->element_size),
+                           se_mpmc_queue_data(self, first + i),
+                           self->element_size);
+
+        // The cell becomes free for the producer one lap later
+        se_atomic_usize_store(
+            se_mpmc_queue_sequence(self, first + i), first + i + self->capacity, SE_ATOMIC_ORDER_RELEASE);
+    }
+
+    if (claimed)
+    {
+        se_mpmc_queue_notify(&control->not_full);
+    }
+    return claimed;
+}
+
+static void
+se_mpmc_queue_push_wait(se_mpmc_queue_t *self, const void *elements, se_usize_t count)
+{
+    se_mpmc_queue_control_t *control = se_mpmc_queue_control(self);
+    se_mpmc_queue_waiters_t *waiters = &control->not_full;
+    se_usize_t               pushed  = 0;
+    se_usize_t               spins   = 0;
+
+    while (pushed < count)
+    {
+        const void *rest = se_ptr_shift_unsafe(const void, elements, pushed * self->element_size);
+
+        se_usize_t claimed = se_mpmc_queue_push(self, rest, count - pushed);
+        if (!claimed)
+        {
+            if (spins++ < SE_MPMC_QUEUE_SPIN_COUNT)
+            {
+                se_atomic_pause();
+                continue;
+            }
+
+            // Re-check after announcing the waiter so that a dequeue in between is not missed.
+            // A cell claimed by a consumer but not yet released is worth waiting for awake.
+            const se_u32_t state = se_mpmc_queue_prepare_park(waiters);
+            claimed              = se_mpmc_queue_push(self, rest, count - pushed);
+            if (!claimed && se_mpmc_queue_claimed(control) >= self->capacity)
+            {
+                se_futex_wait(waiters, state);
+            }
+        }
+
+        pushed += claimed;
+        spins = 0;
+    }
+}
+
+static se_usize_t
+se_mpmc_queue_pop_wait(se_mpmc_queue_t *self, void *elements, se_usize_t count)
+{
+    se_mpmc_queue_control_t *control = se_mpmc_queue_control(self);
+    se_mpmc_queue_waiters_t *waiters = &control->not_empty;
+
+    for (se_usize_t spins = 0;;)
+    {
+        se_usize_t popped = se_mpmc_queue_pop(self, elements, count);
+        if (popped)
+        {
+            return popped;
+        }
+
+        if (spins++ < SE_MPMC_QUEUE_SPIN_COUNT)
+        {
+            se_atomic_pause();
+            continue;
+        }
+
+        const se_u32_t state = se_mpmc_queue_prepare_park(waiters);
+        popped               = se_mpmc_queue_pop(self, elements, count);
+        if (!popped && !se_mpmc_queue_claimed(control))
+        {
+            se_futex_wait(waiters, state);
+        }
+
+        if (popped)
+        {
+            return popped;
+        }
+    }
+}
+
+void
+se_mpmc_queue_init(se_mpmc_queue_t *self, se_usize_t capacity, se_usize_t element_size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_usize_t rounded = 2;
+    while (rounded < capacity)
+    {
+        se_runtime_check(rounded <= SE_USIZE_T_MAX / 2, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        rounded *= 2;
+    }
+
+    // The sequence number heads every cell; keep it aligned
+    se_runtime_check(element_size <= SE_USIZE_T_MAX / 2, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    const se_usize_t align     = sizeof(se_usize_t);
+    const se_usize_t cell_size = (sizeof(se_usize_t) + element_size + align - 1) / align * align;
+    se_runtime_check(cell_size <= SE_USIZE_T_MAX / rounded, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    self->capacity     = rounded;
+    self->element_size = element_size;
+    self->cell_size    = cell_size;
+    self->cells        = se_runtime_allocator_alloc_aligned(rounded * cell_size, SE_CACHE_LINE_SIZE);
+
+    for (se_usize_t i = 0; i < rounded; ++i)
+    {
+        se_atomic_usize_store(se_mpmc_queue_sequence(self, i), i, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    se_mpmc_queue_control_t *control =
+        se_runtime_allocator_alloc_aligned(sizeof(se_mpmc_queue_control_t), SE_CACHE_LINE_SIZE);
+
+    se_atomic_usize_store(&control->enqueue_position, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_usize_store(&control->dequeue_position, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&control->not_full, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&control->not_empty, 0, SE_ATOMIC_ORDER_RELAXED);
+
+    self->control = control;
+}
+
+void
+se_mpmc_queue_deinit(se_mpmc_queue_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_runtime_allocator_dealloc(self->cells);
+    se_runtime_allocator_dealloc(self->control);
+
+    self->cells    = nullptr;
+    self->capacity = 0;
+    self->control  = nullptr;
+}
+
+bool
+se_mpmc_queue_try_enqueue(se_mpmc_queue_t *self, const void *element)
+{
+    se_runtime_check(self && element, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_mpmc_queue_push(self, element, 1) != 0;
+}
+
+bool
+se_mpmc_queue_try_dequeue(se_mpmc_queue_t *self, void *element)
+{
+    se_runtime_check(self && element, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_mpmc_queue_pop(self, element, 1) != 0;
+}
+
+se_usize_t
+se_mpmc_queue_try_enqueue_batch(se_mpmc_queue_t *self, const void *elements, se_usize_t count)
+{
+    se_runtime_check(self && (elements || !count), SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_usize_t pushed = 0;
+    while (pushed < count)
+    {
+        const se_usize_t claimed = se_mpmc_queue_push(
+            self, se_ptr_shift_unsafe(const void, elements, pushed * self->element_size), count - pushed);
+        if (!claimed)
+        {
+            break;
+        }
+        pushed += claimed;
+    }
+    return pushed;
+}
+
+se_usize_t
+se_mpmc_queue_try_dequeue_batch(se_mpmc_queue_t *self, void *elements, se_usize_t count)
+{
+    se_runtime_check(self && (elements || !count), SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_usize_t popped = 0;
+    while (popped < count)
+    {
+        const se_usize_t claimed = se_mpmc_queue_pop(
+            self, se_ptr_shift_unsafe(void, elements, popped * self->element_size), count - popped);
+        if (!claimed)
+        {
+            break;
+        }
+        popped += claimed;
+    }
+    return popped;
+}
+
+void
+se_mpmc_queue_enqueue(se_mpmc_queue_t *self, const void *element)
+{
+    se_runtime_check(self && element, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_mpmc_queue_push_wait(self, element, 1);
+}
+
+void
+se_mpmc_queue_dequeue(se_mpmc_queue_t *self, void *element)
+{
+    se_runtime_check(self && element, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_mpmc_queue_pop_wait(self, element, 1);
+}
+
+void
+se_mpmc_queue_enqueue_batch(se_mpmc_queue_t *self, const void *elements, se_usize_t count)
+{
+    se_runtime_check(self && (elements || !count), SE_RUNTIME_ERROR_NULL_POINTER);
+    se_mpmc_queue_push_wait(self, elements, count);
+}
+
+se_usize_t
+se_mpmc_queue_dequeue_batch(se_mpmc_queue_t *self, void *elements, se_usize_t count)
+{
+    se_runtime_check(self && elements, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(count, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+    return se_mpmc_queue_pop_wait(self, elements, count);
+}
+
+se_usize_t
+se_mpmc_queue_get_capacity(const se_mpmc_queue_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->capacity;
+}
+
+se_usize_t
+se_mpmc_queue_get_element_size(const se_mpmc_queue_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->element_size;
+}
+
+se_usize_t
+se_mpmc_queue_get_size(const se_mpmc_queue_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_mpmc_queue_control_t *control = se_mpmc_queue_control(self);
+
+    // Dequeue first: it never passes enqueue, so the difference cannot underflow
+    const se_usize_t dequeued = se_atomic_usize_load(&control->dequeue_position, SE_ATOMIC_ORDER_ACQUIRE);
+    const se_usize_t enqueued = se_atomic_usize_load(&control->enqueue_position, SE_ATOMIC_ORDER_ACQUIRE);
+    const se_usize_t size     = enqueued - dequeued;
+    return size < self->capacity ? size : self->capacity;
+}
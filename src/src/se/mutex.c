@@ -0,0 +1,95 @@
+#include <se/mutex.h>
+
+#include <se/runtime_check.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+#define SE_MUTEX_UNLOCKED 0
+#define SE_MUTEX_LOCKED   1
+#define SE_MUTEX_WAITING  2
+
+static void
+se_mutex_lock_contended(se_mutex_t *self)
+{
+    se_u32_t   state = SE_MUTEX_LOCKED;
+    se_usize_t spins = 0;
+
+    // Short critical sections end within the spin: no syscall on either side
+    for (; spins < SE_MUTEX_SPIN_COUNT; ++spins)
+    {
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+        if (state == SE_MUTEX_UNLOCKED &&
+            se_atomic_u32_compare_exchange_weak(
+                &self->state, &state, SE_MUTEX_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            break;
+        }
+
+        // Someone already sleeps: spinning would only delay the handover
+        if (state == SE_MUTEX_WAITING)
+        {
+            break;
+        }
+        se_atomic_pause();
+    }
+
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_u64_fetch_add(&self->stats->spin_count, spins, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    if (spins < SE_MUTEX_SPIN_COUNT && state != SE_MUTEX_WAITING)
+    {
+        return;
+    }
+
+    // Taking the lock as WAITING is conservative: the unlock may make a
+    // spurious wake, but a sleeper is never left behind
+    while (se_atomic_u32_exchange(&self->state, SE_MUTEX_WAITING, SE_ATOMIC_ORDER_ACQUIRE) != SE_MUTEX_UNLOCKED)
+    {
+        if (self->stats)
+        {
+            se_atomic_u64_fetch_add(&self->stats->wait_count, 1, SE_ATOMIC_ORDER_RELAXED);
+        }
+        se_futex_wait(&self->state, SE_MUTEX_WAITING);
+    }
+}
+
+void
+se_mutex_init(se_mutex_t *self, se_lock_stats_t *stats)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_atomic_u32_store(&self->state, SE_MUTEX_UNLOCKED, SE_ATOMIC_ORDER_RELAXED);
+    self->stats = stats;
+}
+
+void
+se_mutex_lock(se_mutex_t *self)
+{
+    se_u32_t expected = SE_MUTEX_UNLOCKED;
+    if (!se_atomic_u32_compare_exchange_strong(
+            &self->state, &expected, SE_MUTEX_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+    {
+        se_mutex_lock_contended(self);
+    }
+}
+
+bool
+se_mutex_try_lock(se_mutex_t *self)
+{
+    se_u32_t expected = SE_MUTEX_UNLOCKED;
+    return se_atomic_u32_compare_exchange_strong(
+        &self->state, &expected, SE_MUTEX_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED);
+}
+
+void
+se_mutex_unlock(se_mutex_t *self)
+{
+    if (se_atomic_u32_exchange(&self->state, SE_MUTEX_UNLOCKED, SE_ATOMIC_ORDER_RELEASE) == SE_MUTEX_WAITING)
+    {
+        se_futex_wake(&self->state, 1);
+    }
+}
@@ -0,0 +1,762 @@
+#include <se/parallel.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/memory_std.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/bool.h>
+
+/**
+ * @def SE_PARALLEL_MAX_SPLITS
+ * @brief Наибольшая глубина деления диапазона фрагментов пополам.
+ */
+#define SE_PARALLEL_MAX_SPLITS (sizeof(se_usize_t) * 8)
+
+/**
+ * @def SE_PARALLEL_INSERTION_SORT_MAX
+ * @brief Наибольший фрагмент, сортируемый вставками.
+ */
+#define SE_PARALLEL_INSERTION_SORT_MAX 16
+
+/**
+ * @brief Разбиение массива на фрагменты.
+ *
+ * Граница `i > 0` фрагментов лежит на записи `head + i * chunk`
+ * (не дальше конца), первый фрагмент забирает и `head` невыровненных записей.
+ */
+typedef struct se_parallel_plan
+{
+    const char *begin;
+    se_usize_t  element_size;
+    se_usize_t  count;
+    se_usize_t  head;
+    se_usize_t  chunk;
+    se_usize_t  chunk_count;
+} se_parallel_plan_t;
+
+typedef void(se_parallel_body_fn)(const se_parallel_plan_t *plan, se_usize_t index, void *context);
+
+typedef struct se_parallel_split
+{
+    se_thread_pool_t         *pool;
+    const se_parallel_plan_t *plan;
+    se_parallel_body_fn      *body;
+    void                     *context;
+    se_usize_t                first;
+    se_usize_t                last;
+} se_parallel_split_t;
+
+static se_usize_t
+se_parallel_gcd(se_usize_t a, se_usize_t b)
+{
+    while (b)
+    {
+        const se_usize_t rest = a % b;
+        a                     = b;
+        b                     = rest;
+    }
+    return a;
+}
+
+static se_usize_t
+se_parallel_round_up(se_usize_t value, se_usize_t step)
+{
+    const se_usize_t rest = value % step;
+    return rest && value <= SE_USIZE_T_MAX - step ? value + step - rest : value;
+}
+
+static se_usize_t
+se_parallel_worker_count(const se_thread_pool_t *pool)
+{
+    return pool ? se_thread_pool_get_worker_count(pool) : 1;
+}
+
+static void
+se_parallel_plan(se_parallel_plan_t     *plan,
+                 const se_thread_pool_t *pool,
+                 const void             *begin,
+                 se_usize_t              size,
+                 se_usize_t              element_size,
+                 se_usize_t              grain)
+{
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+    se_runtime_check(size % element_size == 0, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const se_usize_t count = size / element_size;
+
+    // Whole cache lines per chunk: lcm(element_size, line) / element_size records
+    const se_usize_t step = SE_CACHE_LINE_SIZE / se_parallel_gcd(element_size, SE_CACHE_LINE_SIZE);
+
+    se_usize_t chunk = grain;
+    if (!chunk && pool)
+    {
+        const se_usize_t minimum = (SE_PARALLEL_MIN_CHUNK_SIZE + element_size - 1) / element_size;
+        const se_usize_t target  = count / (se_parallel_worker_count(pool) * SE_PARALLEL_CHUNKS_PER_WORKER);
+        chunk                    = se_numeric_max(minimum, target);
+    }
+    else if (!chunk)
+    {
+        // Serial: one chunk, one call
+        chunk = count;
+    }
+    chunk = se_parallel_round_up(se_numeric_max(chunk, 1), step);
+
+    // The first record that starts a cache line, if the layout has one
+    se_usize_t head = 0;
+    for (se_usize_t i = 0; i < step && i < count; ++i)
+    {
+        if ((se_ptr_to_addr(begin) + i * element_size) % SE_CACHE_LINE_SIZE == 0)
+        {
+            head = i;
+            break;
+        }
+    }
+
+    plan->begin        = begin;
+    plan->element_size = element_size;
+    plan->count        = count;
+    plan->head         = head;
+    plan->chunk        = chunk;
+    plan->chunk_count  = count <= head + chunk ? 1 : (count - head + chunk - 1) / chunk;
+}
+
+static se_usize_t
+se_parallel_plan_bound(const se_parallel_plan_t *plan, se_usize_t index)
+{
+    if (!index)
+    {
+        return 0;
+    }
+    if (index >= plan->chunk_count)
+    {
+        return plan->count;
+    }
+    return plan->head + index * plan->chunk;
+}
+
+static se_memory_view_t
+se_parallel_plan_chunk(const se_parallel_plan_t *plan, se_usize_t index)
+{
+    const se_usize_t       first = se_parallel_plan_bound(plan, index);
+    const se_usize_t       last  = se_parallel_plan_bound(plan, index + 1);
+    const se_memory_view_t view  = {plan->begin + first * plan->element_size, plan->begin + last * plan->element_size};
+    return view;
+}
+
+static void
+se_parallel_split_task(void *context)
+{
+    se_parallel_split_t   *split = context;
+    se_parallel_split_t    halves[SE_PARALLEL_MAX_SPLITS];
+    se_thread_pool_task_t *tasks[SE_PARALLEL_MAX_SPLITS];
+    se_usize_t             spawned = 0;
+    se_usize_t             last    = split->last;
+
+    // Hand the upper halves to thieves and keep the lowest chunk
+    while (last - split->first > 1)
+    {
+        const se_usize_t     middle = split->first + (last - split->first) / 2;
+        se_parallel_split_t *half   = &halves[spawned];
+
+        *half          = *split;
+        half->first    = middle;
+        half->last     = last;
+        tasks[spawned] = se_thread_pool_spawn(split->pool, se_parallel_split_task, half);
+
+        ++spawned;
+        last = middle;
+    }
+
+    split->body(split->plan, split->first, split->context);
+
+    // Newest first: the smallest halves are the likeliest to still be in this queue
+    while (spawned)
+    {
+        --spawned;
+        se_thread_pool_wait(split->pool, tasks[spawned]);
+    }
+}
+
+static void
+se_parallel_run(se_thread_pool_t *pool, const se_parallel_plan_t *plan, se_parallel_body_fn *body, void *context)
+{
+    if (!pool || plan->chunk_count == 1)
+    {
+        for (se_usize_t i = 0; i < plan->chunk_count; ++i)
+        {
+            body(plan, i, context);
+        }
+        return;
+    }
+
+    se_parallel_split_t split = {pool, plan, body, context, 0, plan->chunk_count};
+    se_parallel_split_task(&split);
+}
+
+typedef struct se_parallel_for_job
+{
+    se_parallel_for_fn *fn;
+    void               *context;
+} se_parallel_for_job_t;
+
+static void
+se_parallel_for_body(const se_parallel_plan_t *plan, se_usize_t index, void *context)
+{
+    const se_parallel_for_job_t *job   = context;
+    const se_memory_view_t       chunk = se_parallel_plan_chunk(plan, index);
+    job->fn(&chunk, se_parallel_plan_bound(plan, index), job->context);
+}
+
+void
+se_parallel_for(se_thread_pool_t       *pool,
+                const se_memory_view_t *view,
+                se_usize_t              element_size,
+                se_usize_t              grain,
+                se_parallel_for_fn     *fn,
+                void                   *context)
+{
+    se_runtime_check(view && fn, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_parallel_plan_t plan;
+    se_parallel_plan(&plan, pool, view->begin, se_ptr_to_addr_diff(view->end, view->begin), element_size, grain);
+    if (!plan.count)
+    {
+        return;
+    }
+
+    se_parallel_for_job_t job = {fn, context};
+    se_parallel_run(pool, &plan, se_parallel_for_body, &job);
+}
+
+typedef struct se_parallel_reduce_job
+{
+    const void            *identity;
+    se_usize_t             result_size;
+    se_usize_t             stride;
+    char                  *partials;
+    se_parallel_reduce_fn *reduce;
+    void                  *context;
+} se_parallel_reduce_job_t;
+
+static void
+se_parallel_reduce_body(const se_parallel_plan_t *plan, se_usize_t index, void *context)
+{
+    const se_parallel_reduce_job_t *job     = context;
+    void                           *partial = job->partials + index * job->stride;
+    const se_memory_view_t          chunk   = se_parallel_plan_chunk(plan, index);
+
+    se_memory_std_copy(partial, job->identity, job->result_size);
+    job->reduce(partial, &chunk, job->context);
+}
+
+void
+se_parallel_reduce(se_thread_pool_t       *pool,
+                   const se_memory_view_t *view,
+                   se_usize_t              element_size,
+                   se_usize_t              grain,
+                   const void             *identity,
+                   se_usize_t              result_size,
+                   se_parallel_reduce_fn  *reduce,
+                   se_parallel_combine_fn *combine,
+                   void                   *context,
+                   void                   *result)
+{
+    se_runtime_check(view && identity && reduce && combine && result, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(result_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_parallel_plan_t plan;
+    se_parallel_plan(&plan, pool, view->begin, se_ptr_to_addr_diff(view->end, view->begin), element_size, grain);
+
+    se_memory_std_copy(result, identity, result_size);
+    if (!plan.count)
+    {
+        return;
+    }
+
+    if (plan.chunk_count == 1)
+    {
+        const se_memory_view_t all = se_parallel_plan_chunk(&plan, 0);
+        reduce(result, &all, context);
+        return;
+    }
+
+    // Partial results on separate cache lines: reduce may update them per record
+    const se_usize_t stride = se_parallel_round_up(result_size, SE_CACHE_LINE_SIZE);
+    se_runtime_check(stride <= SE_USIZE_T_MAX / plan.chunk_count, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_parallel_reduce_job_t job = {
+        identity,
+        result_size,
+        stride,
+        se_runtime_allocator_alloc_aligned(plan.chunk_count * stride, SE_CACHE_LINE_SIZE),
+        reduce,
+        context,
+    };
+    se_parallel_run(pool, &plan, se_parallel_reduce_body, &job);
+
+    // Left to right: the operation need not be commutative
+    for (se_usize_t i = 0; i < plan.chunk_count; ++i)
+    {
+        combine(result, job.partials + i * stride, context);
+    }
+
+    se_runtime_allocator_dealloc(job.partials);
+}
+
+/**
+ * @brief Состояние префиксной свертки.
+ *
+ * Для каждого фрагмента хранятся три слота по `stride` байт: итог
+ * фрагмента, смещение (итог всех предыдущих) и временная запись
+ * для свертки на месте. Без `combine` записи — `se_u64_t` со сложением.
+ */
+typedef struct se_parallel_scan_job
+{
+    char                   *output;
+    se_usize_t              stride;
+    char                   *slots;
+    se_parallel_combine_fn *combine;
+    void                   *context;
+} se_parallel_scan_job_t;
+
+static void *
+se_parallel_scan_slot(const se_parallel_scan_job_t *job, se_usize_t index, se_usize_t kind)
+{
+    return job->slots + (index * 3 + kind) * job->stride;
+}
+
+static void
+se_parallel_scan_total(const se_parallel_plan_t *plan, se_usize_t index, void *context)
+{
+    const se_parallel_scan_job_t *job   = context;
+    const se_memory_view_t        chunk = se_parallel_plan_chunk(plan, index);
+    void                         *total = se_parallel_scan_slot(job, index, 0);
+
+    if (!job->combine)
+    {
+        se_u64_t sum = 0;
+        for (const se_u64_t *it = chunk.begin; it != chunk.end; ++it)
+        {
+            sum += *it;
+        }
+        *se_ptr_cast(se_u64_t, total) = sum;
+        return;
+    }
+
+    se_memory_std_copy(total, chunk.begin, plan->element_size);
+    for (const char *it = se_ptr_cast(const char, chunk.begin) + plan->element_size; it != chunk.end;
+         it += plan->element_size)
+    {
+        job->combine(total, it, job->context);
+    }
+}
+
+static void
+se_parallel_scan_apply(const se_parallel_plan_t *plan, se_usize_t index, void *context)
+{
+    const se_parallel_scan_job_t *job    = context;
+    const se_memory_view_t        chunk  = se_parallel_plan_chunk(plan, index);
+    const void                   *offset = index ? se_parallel_scan_slot(job, index, 1) : nullptr;
+    const char                   *input  = chunk.begin;
+    char *output = job->output + se_ptr_to_addr_diff(chunk.begin, plan->begin);
+
+    if (!job->combine)
+    {
+        // Read before write: output may alias input
+        se_u64_t sum = offset ? *se_ptr_cast(const se_u64_t, offset) : 0;
+        for (const se_u64_t *it = chunk.begin; it != chunk.end; ++it)
+        {
+            sum += *it;
+            *se_ptr_cast(se_u64_t, output) = sum;
+            output += sizeof(se_u64_t);
+        }
+        return;
+    }
+
+    const se_usize_t size    = plan->element_size;
+    void            *scratch = se_parallel_scan_slot(job, index, 2);
+
+    // The record is saved before its slot is overwritten: output may alias input
+    se_memory_std_copy(scratch, input, size);
+    if (offset)
+    {
+        se_memory_std_copy(output, offset, size);
+        job->combine(output, scratch, job->context);
+    }
+    else
+    {
+        se_memory_std_copy(output, scratch, size);
+    }
+
+    for (input += size; input != chunk.end; input += size)
+    {
+        se_memory_std_copy(scratch, input, size);
+        se_memory_std_copy(output + size, output, size);
+        output += size;
+        job->combine(output, scratch, job->context);
+    }
+}
+
+static void
+se_parallel_scan_run(se_thread_pool_t       *pool,
+                     const se_memory_view_t *view,
+                     se_usize_t              element_size,
+                     se_usize_t              grain,
+                     se_parallel_combine_fn *combine,
+                     void                   *context,
+                     void                   *output)
+{
+    se_parallel_plan_t plan;
+    se_parallel_plan(&plan, pool, view->begin, se_ptr_to_addr_diff(view->end, view->begin), element_size, grain);
+    if (!plan.count)
+    {
+        return;
+    }
+
+    const se_usize_t stride = se_parallel_round_up(element_size, SE_CACHE_LINE_SIZE);
+    se_runtime_check(stride <= SE_USIZE_T_MAX / 3 / plan.chunk_count, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_parallel_scan_job_t job = {
+        output,
+        stride,
+        se_runtime_allocator_alloc_aligned(plan.chunk_count * 3 * stride, SE_CACHE_LINE_SIZE),
+        combine,
+        context,
+    };
+
+    // One chunk needs no totals: the second pass alone is the serial scan
+    if (plan.chunk_count > 1)
+    {
+        se_parallel_run(pool, &plan, se_parallel_scan_total, &job);
+
+        // Offsets of chunks 1..n-1 are few: a serial exclusive scan of the totals
+        se_memory_std_copy(se_parallel_scan_slot(&job, 1, 1), se_parallel_scan_slot(&job, 0, 0), element_size);
+        for (se_usize_t i = 2; i < plan.chunk_count; ++i)
+        {
+            void *offset = se_parallel_scan_slot(&job, i, 1);
+            se_memory_std_copy(offset, se_parallel_scan_slot(&job, i - 1, 1), element_size);
+
+            if (combine)
+            {
+                combine(offset, se_parallel_scan_slot(&job, i - 1, 0), context);
+            }
+            else
+            {
+                *se_ptr_cast(se_u64_t, offset) += *se_ptr_cast(const se_u64_t, se_parallel_scan_slot(&job, i - 1, 0));
+            }
+        }
+    }
+
+    se_parallel_run(pool, &plan, se_parallel_scan_apply, &job);
+    se_runtime_allocator_dealloc(job.slots);
+}
+
+void
+se_parallel_scan(se_thread_pool_t       *pool,
+                 const se_memory_view_t *view,
+                 se_usize_t              element_size,
+                 se_usize_t              grain,
+                 se_parallel_combine_fn *combine,
+                 void                   *context,
+                 void                   *output)
+{
+    se_runtime_check(view && combine && (output || view->begin == view->end), SE_RUNTIME_ERROR_NULL_POINTER);
+    se_parallel_scan_run(pool, view, element_size, grain, combine, context, output);
+}
+
+void
+se_parallel_prefix_sum_u64(se_thread_pool_t *pool, const se_memory_view_t *view, se_usize_t grain, se_u64_t *output)
+{
+    se_runtime_check(view && (output || view->begin == view->end), SE_RUNTIME_ERROR_NULL_POINTER);
+    se_parallel_scan_run(pool, view, sizeof(se_u64_t), grain, nullptr, nullptr, output);
+}
+
+typedef struct se_parallel_sort
+{
+    se_thread_pool_t       *pool;
+    se_usize_t              element_size;
+    se_usize_t              grain;
+    se_parallel_compare_fn *compare;
+    void                   *context;
+} se_parallel_sort_t;
+
+typedef struct se_parallel_sort_job
+{
+    const se_parallel_sort_t *sort;
+    char                     *data;
+    char                     *buffer;
+    se_usize_t                count;
+    bool                      into_buffer;
+} se_parallel_sort_job_t;
+
+typedef struct se_parallel_merge_job
+{
+    const se_parallel_sort_t *sort;
+    const char               *left;
+    se_usize_t                left_count;
+    const char               *right;
+    se_usize_t                right_count;
+    char                     *output;
+} se_parallel_merge_job_t;
+
+static void
+se_parallel_copy_record(void *dst, const void *src, se_usize_t size)
+{
+    char       *d = dst;
+    const char *s = src;
+
+    // Fixed-size byte loops become single moves; the common widths skip the call
+    switch (size)
+    {
+    case 4:
+        for (int i = 0; i < 4; ++i)
+        {
+            d[i] = s[i];
+        }
+        break;
+    case 8:
+        for (int i = 0; i < 8; ++i)
+        {
+            d[i] = s[i];
+        }
+        break;
+    case 16:
+        for (int i = 0; i < 16; ++i)
+        {
+            d[i] = s[i];
+        }
+        break;
+    default:
+        se_memory_std_copy(dst, src, size);
+        break;
+    }
+}
+
+static void
+se_parallel_swap_records(char *a, char *b, se_usize_t size)
+{
+    for (se_usize_t i = 0; i < size; ++i)
+    {
+        const char byte = a[i];
+        a[i]            = b[i];
+        b[i]            = byte;
+    }
+}
+
+static void
+se_parallel_insertion_sort(const se_parallel_sort_t *sort, char *data, se_usize_t count)
+{
+    const se_usize_t size = sort->element_size;
+
+    for (se_usize_t i = 1; i < count; ++i)
+    {
+        for (char *it = data + i * size; it != data && sort->compare(it - size, it, sort->context) > 0; it -= size)
+        {
+            se_parallel_swap_records(it - size, it, size);
+        }
+    }
+}
+
+static void
+se_parallel_merge_serial(const se_parallel_merge_job_t *job)
+{
+    const se_parallel_sort_t *sort      = job->sort;
+    const se_usize_t          size      = sort->element_size;
+    const char               *left      = job->left;
+    const char               *left_end  = left + job->left_count * size;
+    const char               *right     = job->right;
+    const char               *right_end = right + job->right_count * size;
+    char                     *output    = job->output;
+
+    while (left != left_end && right != right_end)
+    {
+        // Equal records keep their order: the left one goes first
+        if (sort->compare(right, left, sort->context) < 0)
+        {
+            se_parallel_copy_record(output, right, size);
+            right += size;
+        }
+        else
+        {
+            se_parallel_copy_record(output, left, size);
+            left += size;
+        }
+        output += size;
+    }
+
+    if (left != left_end)
+    {
+        se_memory_std_copy(output, left, se_ptr_to_addr_diff(left_end, left));
+    }
+    if (right != right_end)
+    {
+        se_memory_std_copy(output, right, se_ptr_to_addr_diff(right_end, right));
+    }
+}
+
+/**
+ * @brief Возвращает количество записей в начале массива, которые идут перед `value`.
+ *
+ * @param[in] after_equal Равные `value` записи тоже идут перед ней.
+ */
+static se_usize_t
+se_parallel_partition_point(const se_parallel_sort_t *sort,
+                            const char               *data,
+                            se_usize_t                count,
+                            const void               *value,
+                            bool                      after_equal)
+{
+    se_usize_t first = 0;
+    while (count)
+    {
+        const se_usize_t half  = count / 2;
+        const int        order = sort->compare(data + (first + half) * sort->element_size, value, sort->context);
+
+        if (order < 0 || (after_equal && order == 0))
+        {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+    return first;
+}
+
+static void
+se_parallel_merge_task(void *context)
+{
+    const se_parallel_merge_job_t *job  = context;
+    const se_parallel_sort_t      *sort = job->sort;
+    const se_usize_t               size = sort->element_size;
+
+    if (!sort->pool || job->left_count + job->right_count <= sort->grain || !job->left_count || !job->right_count)
+    {
+        se_parallel_merge_serial(job);
+        return;
+    }
+
+    // Split at the median of the longer run and its position in the other one:
+    // everything before both split points precedes everything after them
+    se_usize_t left_split  = 0;
+    se_usize_t right_split = 0;
+    if (job->left_count >= job->right_count)
+    {
+        left_split  = job->left_count / 2;
+        right_split = se_parallel_partition_point(sort, job->right, job->right_count, job->left + left_split * size, false);
+    }
+    else
+    {
+        right_split = job->right_count / 2;
+        left_split  = se_parallel_partition_point(sort, job->left, job->left_count, job->right + right_split * size, true);
+    }
+
+    se_parallel_merge_job_t lower = {sort, job->left, left_split, job->right, right_split, job->output};
+    se_parallel_merge_job_t upper = {
+        sort,
+        job->left + left_split * size,
+        job->left_count - left_split,
+        job->right + right_split * size,
+        job->right_count - right_split,
+        job->output + (left_split + right_split) * size,
+    };
+
+    se_thread_pool_task_t *task = se_thread_pool_spawn(sort->pool, se_parallel_merge_task, &upper);
+    se_parallel_merge_task(&lower);
+    se_thread_pool_wait(sort->pool, task);
+}
+
+static void
+se_parallel_sort_task(void *context)
+{
+    const se_parallel_sort_job_t *job   = context;
+    const se_parallel_sort_t     *sort  = job->sort;
+    const se_usize_t              size  = sort->element_size;
+    const se_usize_t              count = job->count;
+
+    if (count <= SE_PARALLEL_INSERTION_SORT_MAX)
+    {
+        se_parallel_insertion_sort(sort, job->data, count);
+        if (job->into_buffer)
+        {
+            se_memory_std_copy(job->buffer, job->data, count * size);
+        }
+        return;
+    }
+
+    // The halves land in the other array, so the merge moves them back
+    const se_usize_t       half  = count / 2;
+    se_parallel_sort_job_t lower = {sort, job->data, job->buffer, half, !job->into_buffer};
+    se_parallel_sort_job_t upper = {
+        sort, job->data + half * size, job->buffer + half * size, count - half, !job->into_buffer};
+
+    if (sort->pool && count > sort->grain)
+    {
+        se_thread_pool_task_t *task = se_thread_pool_spawn(sort->pool, se_parallel_sort_task, &upper);
+        se_parallel_sort_task(&lower);
+        se_thread_pool_wait(sort->pool, task);
+    }
+    else
+    {
+        se_parallel_sort_task(&lower);
+        se_parallel_sort_task(&upper);
+    }
+
+    const char *source = job->into_buffer ? job->data : job->buffer;
+    char       *target = job->into_buffer ? job->buffer : job->data;
+
+    se_parallel_merge_job_t merge = {sort, source, half, source + half * size, count - half, target};
+    if (sort->pool && count > sort->grain)
+    {
+        se_parallel_merge_task(&merge);
+    }
+    else
+    {
+        se_parallel_merge_serial(&merge);
+    }
+}
+
+void
+se_parallel_sort(se_thread_pool_t        *pool,
+                 const se_memory_range_t *range,
+                 se_usize_t               element_size,
+                 se_usize_t               grain,
+                 se_parallel_compare_fn  *compare,
+                 void                    *context)
+{
+    se_runtime_check(range && compare, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(element_size, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const se_usize_t size = se_ptr_to_addr_diff(range->end, range->begin);
+    se_runtime_check(size % element_size == 0, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    const se_usize_t count = size / element_size;
+    if (count < 2)
+    {
+        return;
+    }
+
+    if (!grain)
+    {
+        const se_usize_t minimum = (SE_PARALLEL_MIN_CHUNK_SIZE + element_size - 1) / element_size;
+        grain = se_numeric_max(minimum, count / (se_parallel_worker_count(pool) * SE_PARALLEL_CHUNKS_PER_WORKER));
+    }
+
+    grain = se_numeric_max(grain, SE_PARALLEL_INSERTION_SORT_MAX);
+
+    const se_parallel_sort_t sort = {pool, element_size, grain, compare, context};
+
+    if (count <= SE_PARALLEL_INSERTION_SORT_MAX)
+    {
+        se_parallel_insertion_sort(&sort, range->begin, count);
+        return;
+    }
+
+    se_parallel_sort_job_t job = {&sort, range->begin, se_runtime_allocator_alloc(size), count, false};
+    se_parallel_sort_task(&job);
+    se_runtime_allocator_dealloc(job.buffer);
+}
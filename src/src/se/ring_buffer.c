@@ -0,0 +1,260 @@
+#include <se/ring_buffer.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_throw_with_code.h>
+#include <se/runtime_check.h>
+#include <se/memory_page.h>
+#include <se/memory_std.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+#include <se/bool.h>
+
+typedef struct se_ring_buffer_control
+{
+    // Producer line: its own position and the last consumer position it saw
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t head;
+    se_usize_t        cached_tail;
+
+    // Consumer line: its own position and the last producer position it saw
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t tail;
+    se_usize_t        cached_head;
+} se_ring_buffer_control_t;
+
+static se_ring_buffer_control_t *
+se_ring_buffer_control(const se_ring_buffer_t *self)
+{
+    return se_ptr_cast(se_ring_buffer_control_t, self->control);
+}
+
+static se_usize_t
+se_ring_buffer_round_capacity(se_usize_t capacity, se_usize_t min_capacity)
+{
+    se_usize_t rounded = min_capacity;
+    while (rounded < capacity)
+    {
+        se_runtime_check(rounded <= SE_USIZE_T_MAX / 2, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        rounded *= 2;
+    }
+    return rounded;
+}
+
+static se_usize_t
+se_ring_buffer_contiguous(const se_ring_buffer_t *self, se_usize_t position, se_usize_t available)
+{
+    if (self->flags & SE_RING_BUFFER_FLAG_MIRRORED)
+    {
+        return available;
+    }
+
+    const se_usize_t offset = position & (self->capacity - 1);
+    return se_numeric_min(available, self->capacity - offset);
+}
+
+static void *
+se_ring_buffer_at(const se_ring_buffer_t *self, se_usize_t position)
+{
+    const se_usize_t offset = position & (self->capacity - 1);
+    return se_ptr_shift_unsafe(void, self->data, offset);
+}
+
+void
+se_ring_buffer_init(se_ring_buffer_t *self, se_usize_t capacity, se_u32_t flags)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const bool       mirrored = flags & SE_RING_BUFFER_FLAG_MIRRORED;
+    const se_usize_t rounded  = se_ring_buffer_round_capacity(
+        capacity, mirrored ? SE_RING_BUFFER_MIRRORED_MIN_CAPACITY : SE_CACHE_LINE_SIZE);
+
+    // Plain storage follows the control block in the same allocation, and the
+    // mirrored mapping is made only once the control block exists: a failed
+    // step never leaves the other one behind
+    const se_usize_t tail = mirrored ? 0 : rounded;
+    se_runtime_check(tail <= SE_USIZE_T_MAX - sizeof(se_ring_buffer_control_t), SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_ring_buffer_control_t *control =
+        se_runtime_allocator_alloc_aligned(sizeof(se_ring_buffer_control_t) + tail, SE_CACHE_LINE_SIZE);
+
+    void *data = control + 1;
+    if (mirrored)
+    {
+        data = se_memory_page_alloc_mirrored(rounded);
+        if (!data)
+        {
+            se_runtime_allocator_dealloc(control);
+            se_runtime_throw_with_code(SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        }
+    }
+
+    se_atomic_usize_store(&control->head, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_usize_store(&control->tail, 0, SE_ATOMIC_ORDER_RELAXED);
+    control->cached_tail = 0;
+    control->cached_head = 0;
+
+    self->data     = data;
+    self->capacity = rounded;
+    self->flags    = flags;
+    self->control  = control;
+}
+
+void
+se_ring_buffer_deinit(se_ring_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (self->flags & SE_RING_BUFFER_FLAG_MIRRORED)
+    {
+        se_memory_page_dealloc_mirrored(self->data, self->capacity);
+    }
+
+    // Plain storage is released together with the control block
+    se_runtime_allocator_dealloc(self->control);
+
+    self->data     = nullptr;
+    self->capacity = 0;
+    self->control  = nullptr;
+}
+
+se_memory_range_t
+se_ring_buffer_reserve(se_ring_buffer_t *self, se_usize_t min_size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_ring_buffer_control_t *control = se_ring_buffer_control(self);
+    const se_usize_t          head    = se_atomic_usize_load(&control->head, SE_ATOMIC_ORDER_RELAXED);
+
+    se_usize_t size = se_ring_buffer_contiguous(self, head, self->capacity - (head - control->cached_tail));
+
+    // Only touch the consumer's line when the cached position is not enough
+    if (size < se_numeric_max(min_size, 1))
+    {
+        control->cached_tail = se_atomic_usize_load(&control->tail, SE_ATOMIC_ORDER_ACQUIRE);
+        size = se_ring_buffer_contiguous(self, head, self->capacity - (head - control->cached_tail));
+    }
+
+    char                   *begin = se_ring_buffer_at(self, head);
+    const se_memory_range_t range = {begin, size >= min_size ? begin + size : begin};
+    return range;
+}
+
+void
+se_ring_buffer_commit(se_ring_buffer_t *self, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_ring_buffer_control_t *control = se_ring_buffer_control(self);
+    const se_usize_t          head    = se_atomic_usize_load(&control->head, SE_ATOMIC_ORDER_RELAXED);
+
+    se_runtime_check(size <= self->capacity - (head - control->cached_tail), SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    // Release: the bytes written into the fragment become visible with the new position
+    se_atomic_usize_store(&control->head, head + size, SE_ATOMIC_ORDER_RELEASE);
+}
+
+se_memory_view_t
+se_ring_buffer_peek(se_ring_buffer_t *self, se_usize_t min_size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_ring_buffer_control_t *control = se_ring_buffer_control(self);
+    const se_usize_t          tail    = se_atomic_usize_load(&control->tail, SE_ATOMIC_ORDER_RELAXED);
+
+    se_usize_t size = se_ring_buffer_contiguous(self, tail, control->cached_head - tail);
+
+    if (size < se_numeric_max(min_size, 1))
+    {
+        control->cached_head = se_atomic_usize_load(&control->head, SE_ATOMIC_ORDER_ACQUIRE);
+        size                 = se_ring_buffer_contiguous(self, tail, control->cached_head - tail);
+    }
+
+    const char            *begin = se_ring_buffer_at(self, tail);
+    const se_memory_view_t view  = {begin, size >= min_size ? begin + size : begin};
+    return view;
+}
+
+void
+se_ring_buffer_consume(se_ring_buffer_t *self, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_ring_buffer_control_t *control = se_ring_buffer_control(self);
+    const se_usize_t          tail    = se_atomic_usize_load(&control->tail, SE_ATOMIC_ORDER_RELAXED);
+
+    se_runtime_check(size <= control->cached_head - tail, SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+    // Release: the producer may overwrite the bytes only after they have been read
+    se_atomic_usize_store(&control->tail, tail + size, SE_ATOMIC_ORDER_RELEASE);
+}
+
+se_usize_t
+se_ring_buffer_write(se_ring_buffer_t *self, const void *data, se_usize_t size)
+{
+    se_runtime_check(self && (data || !size), SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_usize_t written = 0;
+
+    // At most two fragments: up to the end of the buffer and from its start
+    while (written < size)
+    {
+        const se_memory_range_t range = se_ring_buffer_reserve(self, 0);
+        const se_usize_t        chunk = se_numeric_min(se_ptr_to_addr_diff(range.end, range.begin), size - written);
+        if (!chunk)
+        {
+            break;
+        }
+
+        se_memory_std_copy(range.begin, se_ptr_shift_unsafe(const void, data, written), chunk);
+        se_ring_buffer_commit(self, chunk);
+        written += chunk;
+    }
+
+    return written;
+}
+
+se_usize_t
+se_ring_buffer_read(se_ring_buffer_t *self, void *dst, se_usize_t size)
+{
+    se_runtime_check(self && (dst || !size), SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_usize_t read = 0;
+
+    while (read < size)
+    {
+        const se_memory_view_t view  = se_ring_buffer_peek(self, 0);
+        const se_usize_t       chunk = se_numeric_min(se_ptr_to_addr_diff(view.end, view.begin), size - read);
+        if (!chunk)
+        {
+            break;
+        }
+
+        se_memory_std_copy(se_ptr_shift_unsafe(void, dst, read), view.begin, chunk);
+        se_ring_buffer_consume(self, chunk);
+        read += chunk;
+    }
+
+    return read;
+}
+
+se_usize_t
+se_ring_buffer_get_capacity(const se_ring_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->capacity;
+}
+
+se_usize_t
+se_ring_buffer_get_size(const se_ring_buffer_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_ring_buffer_control_t *control = se_ring_buffer_control(self);
+
+    // Tail first: it never passes head, so the difference cannot underflow
+    const se_usize_t tail = se_atomic_usize_load(&control->tail, SE_ATOMIC_ORDER_ACQUIRE);
+    const se_usize_t head = se_atomic_usize_load(&control->head, SE_ATOMIC_ORDER_ACQUIRE);
+    return head - tail;
+}
@@ -0,0 +1,444 @@
+#include <se/runtime_allocator.h>
+#include <se/runtime_allocator_stats.h>
+
+#include <se/runtime_check.h>
+#include <se/bit_util.h>
+#include <se/memory.h>
+
+/**
+ * @var m_runtime_allocator
+ * @brief Текущий аллокатор времени выполнения.
+ *
+ * Инициализируется в зависимости от опции `SE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB`:
+ * - Если `ON`: устанавливается в `malloc()`/`free()`, `posix_memalign()` и `calloc()`
+ *   (на Windows — `_aligned_malloc()`/`_aligned_free()`, так как блоки
+ *   `_aligned_malloc()` нельзя освободить через `free()`).
+ * - Если `OFF`: устанавливается в `nullptr` (требует явной настройки).
+ *
+ * @note В отличие от обработчика завершения, аллокатор общий для всех потоков:
+ *       блок, выделенный в одном потоке, может быть освобожден в другом.
+ * @see se_runtime_allocator_set()
+ */
+#ifdef SE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
+#    include <stdlib.h>
+#    include <se/nullptr.h>
+#    ifdef _WIN32
+#        include <malloc.h>
+
+static void *
+se_runtime_allocator_stdlib_alloc_aligned(se_usize_t size, se_usize_t alignment)
+{
+    return _aligned_malloc(size, alignment);
+}
+
+static void *
+se_runtime_allocator_stdlib_alloc(se_usize_t size)
+{
+    return _aligned_malloc(size, SE_RUNTIME_ALLOCATOR_ALIGNMENT);
+}
+
+static void *
+se_runtime_allocator_stdlib_alloc_zeroed(se_usize_t size, se_usize_t alignment)
+{
+    return _aligned_recalloc(nullptr, 1, size, alignment ? alignment : SE_RUNTIME_ALLOCATOR_ALIGNMENT);
+}
+
+se_memory_allocator_t m_runtime_allocator = {
+    se_runtime_allocator_stdlib_alloc,
+    _aligned_free,
+    se_runtime_allocator_stdlib_alloc_aligned,
+    se_runtime_allocator_stdlib_alloc_zeroed,
+};
+#    else
+#        include <string.h>
+
+// se_usize_t is not necessarily size_t, so malloc cannot be stored directly
+static void *
+se_runtime_allocator_stdlib_alloc(se_usize_t size)
+{
+    return malloc(size);
+}
+
+static void *
+se_runtime_allocator_stdlib_alloc_aligned(se_usize_t size, se_usize_t alignment)
+{
+    void *ptr;
+    return posix_memalign(&ptr, alignment, size) ? nullptr : ptr;
+}
+
+static void *
+se_runtime_allocator_stdlib_alloc_zeroed(se_usize_t size, se_usize_t alignment)
+{
+    // calloc skips the memset for chunks freshly mapped from the system
+    if (!alignment)
+    {
+        return calloc(1, size);
+    }
+
+    void *ptr = se_runtime_allocator_stdlib_alloc_aligned(size, alignment);
+    return ptr ? memset(ptr, 0, size) : nullptr;
+}
+
+se_memory_allocator_t m_runtime_allocator = {
+    se_runtime_allocator_stdlib_alloc,
+    free,
+    se_runtime_allocator_stdlib_alloc_aligned,
+    se_runtime_allocator_stdlib_alloc_zeroed,
+};
+#    endif
+#else
+#    include <se/nullptr.h>
+se_memory_allocator_t m_runtime_allocator = {nullptr, nullptr, nullptr, nullptr};
+#endif
+
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+#    include <se/memory_page.h>
+#    include <se/static_assert.h>
+#    include <se/numeric_util.h>
+#    include <se/ptr_util.h>
+#    include <se/atomic.h>
+
+/**
+ * @brief Заголовок, расположенный непосредственно перед каждым выданным блоком.
+ *
+ * Хранит запрошенный размер для учета освобождения и смещение блока
+ * от начала памяти, полученной у аллокатора.
+ */
+typedef struct se_runtime_allocator_stats_header
+{
+    se_usize_t size;   /**< Запрошенный размер блока. */
+    se_usize_t offset; /**< Смещение блока от начала выделенной памяти. */
+} se_runtime_allocator_stats_header_t;
+
+se_static_assert(sizeof(se_runtime_allocator_stats_header_t) <= SE_RUNTIME_ALLOCATOR_ALIGNMENT,
+                 "Stats header must fit into the default alignment");
+
+/**
+ * @brief Счетчики одного потока.
+ *
+ * Счетчики пишет только поток-владелец (обычными загрузкой и сохранением),
+ * атомарный тип нужен лишь для корректного чтения из снимков. Без опции
+ * SE_LIBRARY_OPTION_THREAD_LOCAL блок общий для всех потоков, и счетчики
+ * изменяются атомарными операциями чтения-модификации-записи.
+ */
+typedef struct se_runtime_allocator_stats_block
+{
+    struct se_runtime_allocator_stats_block *next; /**< Следующий блок глобального списка. */
+
+    se_atomic_u64_t alloc_count;
+    se_atomic_u64_t dealloc_count;
+    se_atomic_u64_t alloc_bytes;
+    se_atomic_u64_t dealloc_bytes;
+    se_atomic_u64_t histogram[SE_RUNTIME_ALLOCATOR_STATS_HISTOGRAM_SIZE];
+
+    /** Изменение объема живой памяти, еще не опубликованное в `m_stats_live`. */
+    se_s64_t pending;
+} se_runtime_allocator_stats_block_t;
+
+/**
+ * @brief Список блоков счетчиков всех потоков.
+ *
+ * Список только растет: блок завершившегося потока остается в нем,
+ * чтобы снимок продолжал учитывать выполненные потоком операции.
+ */
+static se_atomic_ptr_t m_stats_blocks;
+
+/** Объем живой памяти (знаковый, хранится в дополнительном коде). */
+static se_atomic_u64_t m_stats_live;
+static se_atomic_u64_t m_stats_peak;
+
+static SE_ATTRIBUTE(THREAD_LOCAL)
+se_runtime_allocator_stats_block_t *m_stats_thread;
+
+static se_runtime_allocator_stats_block_t *
+se_runtime_allocator_stats_get_block(void)
+{
+    se_runtime_allocator_stats_block_t *block = m_stats_thread;
+    if (block)
+    {
+        return block;
+    }
+
+    // Counters are taken from the pages directly: the runtime allocator
+    // itself must not be re-entered, and fresh pages are already zero
+    block = se_memory_page_alloc(sizeof(se_runtime_allocator_stats_block_t));
+    se_runtime_check(block, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    void *head = se_atomic_ptr_load(&m_stats_blocks, SE_ATOMIC_ORDER_RELAXED);
+    do
+    {
+        block->next = head;
+    } while (!se_atomic_ptr_compare_exchange_weak(
+        &m_stats_blocks, &head, block, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED));
+
+    m_stats_thread = block;
+    return block;
+}
+
+static void
+se_runtime_allocator_stats_add(se_atomic_u64_t *counter, se_u64_t value)
+{
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+    // Single writer: a plain load and store, no read-modify-write
+    se_atomic_u64_store(counter, se_atomic_u64_load(counter, SE_ATOMIC_ORDER_RELAXED) + value, SE_ATOMIC_ORDER_RELAXED);
+#else
+    // Without thread-local storage one block is shared by all threads
+    se_atomic_u64_fetch_add(counter, value, SE_ATOMIC_ORDER_RELAXED);
+#endif
+}
+
+static void
+se_runtime_allocator_stats_raise_peak(se_u64_t live)
+{
+    se_u64_t peak = se_atomic_u64_load(&m_stats_peak, SE_ATOMIC_ORDER_RELAXED);
+    while (live > peak &&
+           !se_atomic_u64_compare_exchange_weak(&m_stats_peak, &peak, live, SE_ATOMIC_ORDER_RELAXED, SE_ATOMIC_ORDER_RELAXED))
+    {
+    }
+}
+
+static void
+se_runtime_allocator_stats_publish(se_runtime_allocator_stats_block_t *block, se_s64_t delta)
+{
+#if defined(SE_LIBRARY_OPTION_THREAD_LOCAL)
+    block->pending += delta;
+
+    if (block->pending < SE_RUNTIME_ALLOCATOR_STATS_PEAK_GRANULARITY &&
+        block->pending > -SE_RUNTIME_ALLOCATOR_STATS_PEAK_GRANULARITY)
+    {
+        return;
+    }
+
+    const se_u64_t pending = (se_u64_t)block->pending;
+    block->pending = 0;
+#else
+    // A shared block cannot batch its changes without a race
+    (void)block;
+    const se_u64_t pending = (se_u64_t)delta;
+#endif
+    const se_s64_t live = (se_s64_t)(se_atomic_u64_fetch_add(&m_stats_live, pending, SE_ATOMIC_ORDER_RELAXED) + pending);
+
+    if (live > 0)
+    {
+        se_runtime_allocator_stats_raise_peak((se_u64_t)live);
+    }
+}
+
+static void
+se_runtime_allocator_stats_on_alloc(se_usize_t size)
+{
+    se_runtime_allocator_stats_block_t *block = se_runtime_allocator_stats_get_block();
+
+    unsigned long bucket = 0;
+    if (size)
+    {
+        se_bit_scan_reverse64(&bucket, (se_u64_t)size);
+    }
+
+    se_runtime_allocator_stats_add(&block->alloc_count, 1);
+    se_runtime_allocator_stats_add(&block->alloc_bytes, size);
+    se_runtime_allocator_stats_add(&block->histogram[bucket], 1);
+    se_runtime_allocator_stats_publish(block, (se_s64_t)size);
+}
+
+static void
+se_runtime_allocator_stats_on_dealloc(se_usize_t size)
+{
+    se_runtime_allocator_stats_block_t *block = se_runtime_allocator_stats_get_block();
+
+    se_runtime_allocator_stats_add(&block->dealloc_count, 1);
+    se_runtime_allocator_stats_add(&block->dealloc_bytes, size);
+    se_runtime_allocator_stats_publish(block, -(se_s64_t)size);
+}
+
+static void
+se_runtime_allocator_stats_collect(const se_runtime_allocator_stats_block_t *block,
+                                   se_runtime_allocator_stats_t             *stats)
+{
+    const se_u64_t alloc_bytes   = se_atomic_u64_load(&block->alloc_bytes, SE_ATOMIC_ORDER_RELAXED);
+    const se_u64_t dealloc_bytes = se_atomic_u64_load(&block->dealloc_bytes, SE_ATOMIC_ORDER_RELAXED);
+
+    stats->live_bytes += alloc_bytes - dealloc_bytes;
+    stats->alloc_count += se_atomic_u64_load(&block->alloc_count, SE_ATOMIC_ORDER_RELAXED);
+    stats->dealloc_count += se_atomic_u64_load(&block->dealloc_count, SE_ATOMIC_ORDER_RELAXED);
+    stats->thread_count += 1;
+
+    for (se_usize_t i = 0; i < SE_RUNTIME_ALLOCATOR_STATS_HISTOGRAM_SIZE; ++i)
+    {
+        stats->histogram[i] += se_atomic_u64_load(&block->histogram[i], SE_ATOMIC_ORDER_RELAXED);
+    }
+}
+#endif
+
+se_memory_allocator_t
+se_runtime_allocator_set(const se_memory_allocator_t *allocator)
+{
+    se_runtime_check(allocator, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_memory_allocator_t prev = m_runtime_allocator;
+    m_runtime_allocator              = *allocator;
+    return prev;
+}
+
+const se_memory_allocator_t *
+se_runtime_allocator_get(void)
+{
+    return &m_runtime_allocator;
+}
+
+static void *
+se_runtime_allocator_alloc_raw(se_usize_t size, se_usize_t alignment)
+{
+    void *ptr;
+
+    if (alignment <= SE_RUNTIME_ALLOCATOR_ALIGNMENT)
+    {
+        se_runtime_check(m_runtime_allocator.alloc, SE_RUNTIME_ERROR_NULL_POINTER);
+        ptr = m_runtime_allocator.alloc(size);
+    }
+    else
+    {
+        se_runtime_check(m_runtime_allocator.alloc_aligned, SE_RUNTIME_ERROR_NULL_POINTER);
+        ptr = m_runtime_allocator.alloc_aligned(size, alignment);
+    }
+
+    se_runtime_check(ptr, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    return ptr;
+}
+
+static void *
+se_runtime_allocator_alloc_zero_filled(se_usize_t size, se_usize_t alignment)
+{
+    if (!m_runtime_allocator.alloc_zeroed)
+    {
+        void *ptr = se_runtime_allocator_alloc_raw(size, alignment);
+        se_memory_set(ptr, size, 0);
+        return ptr;
+    }
+
+    if (alignment <= SE_RUNTIME_ALLOCATOR_ALIGNMENT)
+    {
+        alignment = 0;
+    }
+    else
+    {
+        se_runtime_check(m_runtime_allocator.alloc_aligned, SE_RUNTIME_ERROR_NULL_POINTER);
+    }
+
+    // The allocator knows where the block came from and zeroes it only when needed
+    void *ptr = m_runtime_allocator.alloc_zeroed(size, alignment);
+    se_runtime_check(ptr, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    return ptr;
+}
+
+static void *
+se_runtime_allocator_alloc_impl(se_usize_t size, se_usize_t alignment, bool zeroed)
+{
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+    // The header is kept in a prefix that preserves the requested alignment
+    const se_usize_t prefix = se_numeric_max(alignment, SE_RUNTIME_ALLOCATOR_ALIGNMENT);
+    se_runtime_check(size <= SE_USIZE_T_MAX - prefix, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    void *raw = zeroed ? se_runtime_allocator_alloc_zero_filled(size + prefix, alignment)
+                       : se_runtime_allocator_alloc_raw(size + prefix, alignment);
+    void *ptr = se_ptr_shift_unsafe(void, raw, prefix);
+
+    se_runtime_allocator_stats_header_t *header = (se_runtime_allocator_stats_header_t *)ptr - 1;
+    header->size                                = size;
+    header->offset                              = prefix;
+
+    se_runtime_allocator_stats_on_alloc(size);
+    return ptr;
+#else
+    return zeroed ? se_runtime_allocator_alloc_zero_filled(size, alignment)
+                  : se_runtime_allocator_alloc_raw(size, alignment);
+#endif
+}
+
+void *
+se_runtime_allocator_alloc(se_usize_t size)
+{
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    return se_runtime_allocator_alloc_impl(size, 0, true);
+#else
+    return se_runtime_allocator_alloc_impl(size, 0, false);
+#endif
+}
+
+void *
+se_runtime_allocator_alloc_aligned(se_usize_t size, se_usize_t alignment)
+{
+    se_runtime_check(se_bit_is_one(alignment), SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+#ifdef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    return se_runtime_allocator_alloc_impl(size, alignment, true);
+#else
+    return se_runtime_allocator_alloc_impl(size, alignment, false);
+#endif
+}
+
+void *
+se_runtime_allocator_alloc_zeroed(se_usize_t size)
+{
+    return se_runtime_allocator_alloc_impl(size, 0, true);
+}
+
+void
+se_runtime_allocator_dealloc(void *ptr)
+{
+    se_runtime_check(m_runtime_allocator.dealloc, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (ptr)
+    {
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+        const se_runtime_allocator_stats_header_t *header = (const se_runtime_allocator_stats_header_t *)ptr - 1;
+        se_runtime_allocator_stats_on_dealloc(header->size);
+        ptr = se_ptr_subtract_unsafe(void, ptr, header->offset);
+#endif
+        m_runtime_allocator.dealloc(ptr);
+    }
+}
+
+bool
+se_runtime_allocator_stats_is_enabled(void)
+{
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+se_runtime_allocator_stats_snapshot(se_runtime_allocator_stats_t *stats)
+{
+    se_runtime_check(stats, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_memory_set(stats, sizeof(*stats), 0);
+
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+    const se_runtime_allocator_stats_block_t *block = se_atomic_ptr_load(&m_stats_blocks, SE_ATOMIC_ORDER_ACQUIRE);
+    for (; block; block = block->next)
+    {
+        se_runtime_allocator_stats_collect(block, stats);
+    }
+
+    // Unpublished per-thread deltas may hide the current value from the peak,
+    // the exact sum is recorded so that later snapshots never report less
+    se_runtime_allocator_stats_raise_peak(stats->live_bytes);
+    stats->peak_bytes = se_atomic_u64_load(&m_stats_peak, SE_ATOMIC_ORDER_RELAXED);
+#endif
+}
+
+void
+se_runtime_allocator_stats_thread(se_runtime_allocator_stats_t *stats)
+{
+    se_runtime_check(stats, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_memory_set(stats, sizeof(*stats), 0);
+
+#ifdef SE_LIBRARY_OPTION_ALLOC_STATS
+    if (m_stats_thread)
+    {
+        se_runtime_allocator_stats_collect(m_stats_thread, stats);
+    }
+#endif
+}
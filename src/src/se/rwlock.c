@@ -0,0 +1,343 @@
+#include <se/rwlock.h>
+
+#include <se/runtime_throw_with_code.h>
+#include <se/runtime_check.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+
+// Low 30 bits: reader count, or WRITE_LOCKED for a writer
+#define SE_RWLOCK_MASK            ((1u << 30) - 1)
+#define SE_RWLOCK_READ_LOCKED     1u
+#define SE_RWLOCK_WRITE_LOCKED    SE_RWLOCK_MASK
+#define SE_RWLOCK_READERS_WAITING (1u << 30)
+#define SE_RWLOCK_WRITERS_WAITING (1u << 31)
+
+static bool
+se_rwlock_is_unlocked(se_u32_t state)
+{
+    return (state & SE_RWLOCK_MASK) == 0;
+}
+
+static bool
+se_rwlock_is_write_locked(se_u32_t state)
+{
+    return (state & SE_RWLOCK_MASK) == SE_RWLOCK_WRITE_LOCKED;
+}
+
+static bool
+se_rwlock_is_read_lockable(se_u32_t state)
+{
+    // Waiting writers (and readers queued behind them) block new readers
+    return (state & SE_RWLOCK_MASK) < SE_RWLOCK_MAX_READERS &&
+           !(state & (SE_RWLOCK_READERS_WAITING | SE_RWLOCK_WRITERS_WAITING));
+}
+
+static void
+se_rwlock_count_spins(se_rwlock_t *self, se_usize_t spins)
+{
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->spin_count, spins, SE_ATOMIC_ORDER_RELAXED);
+    }
+}
+
+static void
+se_rwlock_count_wait(se_rwlock_t *self)
+{
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->wait_count, 1, SE_ATOMIC_ORDER_RELAXED);
+    }
+}
+
+static se_u32_t
+se_rwlock_spin_read(se_rwlock_t *self)
+{
+    se_usize_t spins = 0;
+    se_u32_t   state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+
+    // Stop early once waiting begins: spinning cannot beat the queue
+    while (se_rwlock_is_write_locked(state) &&
+           !(state & (SE_RWLOCK_READERS_WAITING | SE_RWLOCK_WRITERS_WAITING)) && spins < SE_RWLOCK_SPIN_COUNT)
+    {
+        se_atomic_pause();
+        ++spins;
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    se_rwlock_count_spins(self, spins);
+    return state;
+}
+
+static se_u32_t
+se_rwlock_spin_write(se_rwlock_t *self)
+{
+    se_usize_t spins = 0;
+    se_u32_t   state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+
+    while (!se_rwlock_is_unlocked(state) && !(state & SE_RWLOCK_WRITERS_WAITING) && spins < SE_RWLOCK_SPIN_COUNT)
+    {
+        se_atomic_pause();
+        ++spins;
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    se_rwlock_count_spins(self, spins);
+    return state;
+}
+
+static void
+se_rwlock_wake_writer(se_rwlock_t *self)
+{
+    // A writer that read the old counter will not sleep on it
+    se_atomic_u32_fetch_add(&self->writer_notify, 1, SE_ATOMIC_ORDER_RELEASE);
+    se_futex_wake(&self->writer_notify, 1);
+}
+
+/**
+ * @brief Будит ждущих после того, как блокировка стала свободной.
+ *
+ * Ждущий писатель важнее читателей: если ждут оба, флаг читателей
+ * остается, и их разбудит освобождение блокировки этим писателем.
+ * Писатель на медленном пути обязательно захватит блокировку, поэтому
+ * читателей можно оставить ему, только пока такие писатели есть.
+ */
+static void
+se_rwlock_wake_writer_or_readers(se_rwlock_t *self, se_u32_t state)
+{
+    if (state == SE_RWLOCK_WRITERS_WAITING)
+    {
+        if (se_atomic_u32_compare_exchange_strong(
+                &self->state, &state, 0, SE_ATOMIC_ORDER_RELAXED, SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_rwlock_wake_writer(self);
+            return;
+        }
+    }
+
+    if (state == (SE_RWLOCK_READERS_WAITING | SE_RWLOCK_WRITERS_WAITING))
+    {
+        // On failure someone took the lock: their unlock comes back here
+        if (!se_atomic_u32_compare_exchange_strong(
+                &self->state, &state, SE_RWLOCK_READERS_WAITING, SE_ATOMIC_ORDER_SEQ_CST, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return;
+        }
+        se_rwlock_wake_writer(self);
+
+        // The flag may outlive its writers; with none left on the slow path
+        // nobody else would wake the readers
+        if (se_atomic_u32_load(&self->writer_count, SE_ATOMIC_ORDER_SEQ_CST))
+        {
+            return;
+        }
+        state = SE_RWLOCK_READERS_WAITING;
+    }
+
+    if (state == SE_RWLOCK_READERS_WAITING)
+    {
+        if (se_atomic_u32_compare_exchange_strong(
+                &self->state, &state, 0, SE_ATOMIC_ORDER_RELAXED, SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_futex_wake(&self->state, SE_FUTEX_WAKE_ALL);
+        }
+    }
+}
+
+static void
+se_rwlock_read_contended(se_rwlock_t *self)
+{
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    se_u32_t state = se_rwlock_spin_read(self);
+    for (;;)
+    {
+        if (se_rwlock_is_read_lockable(state))
+        {
+            if (se_atomic_u32_compare_exchange_weak(&self->state,
+                                                    &state,
+                                                    state + SE_RWLOCK_READ_LOCKED,
+                                                    SE_ATOMIC_ORDER_ACQUIRE,
+                                                    SE_ATOMIC_ORDER_RELAXED))
+            {
+                return;
+            }
+            continue;
+        }
+
+        if ((state & SE_RWLOCK_MASK) == SE_RWLOCK_MAX_READERS)
+        {
+            se_runtime_throw_with_code(SE_RUNTIME_ERROR_OUT_OF_RANGE);
+        }
+
+        // The flag must be visible before sleeping, or the unlock skips the wake
+        if (!(state & SE_RWLOCK_READERS_WAITING))
+        {
+            if (!se_atomic_u32_compare_exchange_strong(&self->state,
+                                                       &state,
+                                                       state | SE_RWLOCK_READERS_WAITING,
+                                                       SE_ATOMIC_ORDER_RELAXED,
+                                                       SE_ATOMIC_ORDER_RELAXED))
+            {
+                continue;
+            }
+        }
+
+        se_rwlock_count_wait(self);
+        se_futex_wait(&self->state, state | SE_RWLOCK_READERS_WAITING);
+        state = se_rwlock_spin_read(self);
+    }
+}
+
+static void
+se_rwlock_write_contended(se_rwlock_t *self)
+{
+    if (self->stats)
+    {
+        se_atomic_u64_fetch_add(&self->stats->contended_count, 1, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    // Counted until the lock is taken: the unlock leaves parked readers
+    // to these writers and the flag is re-set only for them
+    se_atomic_u32_fetch_add(&self->writer_count, 1, SE_ATOMIC_ORDER_SEQ_CST);
+
+    se_u32_t state = se_rwlock_spin_write(self);
+    for (;;)
+    {
+        if (se_rwlock_is_unlocked(state))
+        {
+            const se_u32_t others = se_atomic_u32_load(&self->writer_count, SE_ATOMIC_ORDER_RELAXED) > 1
+                                        ? SE_RWLOCK_WRITERS_WAITING
+                                        : 0;
+            if (se_atomic_u32_compare_exchange_weak(&self->state,
+                                                    &state,
+                                                    state | SE_RWLOCK_WRITE_LOCKED | others,
+                                                    SE_ATOMIC_ORDER_ACQUIRE,
+                                                    SE_ATOMIC_ORDER_RELAXED))
+            {
+                se_atomic_u32_fetch_sub(&self->writer_count, 1, SE_ATOMIC_ORDER_SEQ_CST);
+                return;
+            }
+            continue;
+        }
+
+        if (!(state & SE_RWLOCK_WRITERS_WAITING))
+        {
+            if (!se_atomic_u32_compare_exchange_strong(&self->state,
+                                                       &state,
+                                                       state | SE_RWLOCK_WRITERS_WAITING,
+                                                       SE_ATOMIC_ORDER_RELAXED,
+                                                       SE_ATOMIC_ORDER_RELAXED))
+            {
+                continue;
+            }
+        }
+
+        // Read the counter before re-checking the state, so a wake between
+        // the two changes the counter and the wait returns at once
+        const se_u32_t notify = se_atomic_u32_load(&self->writer_notify, SE_ATOMIC_ORDER_ACQUIRE);
+
+        state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+        if (se_rwlock_is_unlocked(state) || !(state & SE_RWLOCK_WRITERS_WAITING))
+        {
+            continue;
+        }
+
+        se_rwlock_count_wait(self);
+        se_futex_wait(&self->writer_notify, notify);
+        state = se_rwlock_spin_write(self);
+    }
+}
+
+void
+se_rwlock_init(se_rwlock_t *self, se_lock_stats_t *stats)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_atomic_u32_store(&self->state, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&self->writer_notify, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&self->writer_count, 0, SE_ATOMIC_ORDER_RELAXED);
+    self->stats = stats;
+}
+
+void
+se_rwlock_read_lock(se_rwlock_t *self)
+{
+    se_u32_t state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+    if (!se_rwlock_is_read_lockable(state) ||
+        !se_atomic_u32_compare_exchange_weak(
+            &self->state, &state, state + SE_RWLOCK_READ_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+    {
+        se_rwlock_read_contended(self);
+    }
+}
+
+bool
+se_rwlock_try_read_lock(se_rwlock_t *self)
+{
+    se_u32_t state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+    while (se_rwlock_is_read_lockable(state))
+    {
+        if (se_atomic_u32_compare_exchange_weak(
+                &self->state, &state, state + SE_RWLOCK_READ_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+se_rwlock_read_unlock(se_rwlock_t *self)
+{
+    const se_u32_t state =
+        se_atomic_u32_fetch_sub(&self->state, SE_RWLOCK_READ_LOCKED, SE_ATOMIC_ORDER_RELEASE) - SE_RWLOCK_READ_LOCKED;
+
+    // Readers only wait behind a writer, so the last reader out wakes writers
+    if (se_rwlock_is_unlocked(state) && (state & SE_RWLOCK_WRITERS_WAITING))
+    {
+        se_rwlock_wake_writer_or_readers(self, state);
+    }
+}
+
+void
+se_rwlock_write_lock(se_rwlock_t *self)
+{
+    se_u32_t expected = 0;
+    if (!se_atomic_u32_compare_exchange_strong(
+            &self->state, &expected, SE_RWLOCK_WRITE_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+    {
+        se_rwlock_write_contended(self);
+    }
+}
+
+bool
+se_rwlock_try_write_lock(se_rwlock_t *self)
+{
+    se_u32_t state = se_atomic_u32_load(&self->state, SE_ATOMIC_ORDER_RELAXED);
+    while (se_rwlock_is_unlocked(state))
+    {
+        if (se_atomic_u32_compare_exchange_weak(
+                &self->state, &state, state | SE_RWLOCK_WRITE_LOCKED, SE_ATOMIC_ORDER_ACQUIRE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+se_rwlock_write_unlock(se_rwlock_t *self)
+{
+    const se_u32_t state =
+        se_atomic_u32_fetch_sub(&self->state, SE_RWLOCK_WRITE_LOCKED, SE_ATOMIC_ORDER_RELEASE) - SE_RWLOCK_WRITE_LOCKED;
+
+    if (state & (SE_RWLOCK_READERS_WAITING | SE_RWLOCK_WRITERS_WAITING))
+    {
+        se_rwlock_wake_writer_or_readers(self, state);
+    }
+}
@@ -0,0 +1,308 @@
+#include <se/string.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_check.h>
+#include <se/static_assert.h>
+#include <se/ptr_util.h>
+#include <se/numeric_util.h>
+#include <se/nullptr.h>
+#include <se/memory_std.h>
+#include <se/memory.h>
+
+se_static_assert(sizeof(((se_string_t *)0)->storage.heap) == SE_STRING_INLINE_CAPACITY + 1,
+                 "Heap representation must cover the inline buffer exactly");
+se_static_assert(SE_STRING_INLINE_CAPACITY < SE_STRING_HEAP_TAG,
+                 "Inline size tag must not collide with the heap tag");
+
+#define SE_STRING_TAG(self) ((self)->storage.buffer[SE_STRING_INLINE_CAPACITY])
+
+static bool
+se_string_is_heap(const se_string_t *self)
+{
+    return (se_u8_t)SE_STRING_TAG(self) == SE_STRING_HEAP_TAG;
+}
+
+static se_usize_t *
+se_string_heap_header(const se_string_t *self)
+{
+    return se_ptr_subtract_unsafe(se_usize_t, self->storage.heap.data, sizeof(se_usize_t));
+}
+
+static char *
+se_string_data(const se_string_t *self)
+{
+    return se_string_is_heap(self) ? self->storage.heap.data : (char *)self->storage.buffer;
+}
+
+static se_usize_t
+se_string_size(const se_string_t *self)
+{
+    return se_string_is_heap(self) ? self->storage.heap.size
+                                   : SE_STRING_INLINE_CAPACITY - (se_u8_t)SE_STRING_TAG(self);
+}
+
+static se_usize_t
+se_string_capacity(const se_string_t *self)
+{
+    return se_string_is_heap(self) ? *se_string_heap_header(self) : SE_STRING_INLINE_CAPACITY;
+}
+
+static void
+se_string_reset(se_string_t *self)
+{
+    self->storage.buffer[0] = '\0';
+    SE_STRING_TAG(self)     = (char)SE_STRING_INLINE_CAPACITY;
+}
+
+static void
+se_string_set_size(se_string_t *self, se_usize_t size)
+{
+    if (se_string_is_heap(self))
+    {
+        self->storage.heap.size = size;
+    }
+    else
+    {
+        // When the buffer is full the tag becomes zero and terminates the string
+        SE_STRING_TAG(self) = (char)(SE_STRING_INLINE_CAPACITY - size);
+    }
+
+    se_string_data(self)[size] = '\0';
+}
+
+static void
+se_string_set_capacity(se_string_t *self, se_usize_t capacity)
+{
+    se_runtime_check(capacity <= SE_USIZE_T_MAX - sizeof(se_usize_t) - 1, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    // The capacity lives in front of the data, the extra byte keeps the terminator
+    se_usize_t *header = se_runtime_allocator_alloc(sizeof(se_usize_t) + capacity + 1);
+    char       *data   = se_ptr_shift_unsafe(char, header, sizeof(se_usize_t));
+    *header            = capacity;
+
+    const se_usize_t size = se_string_size(self);
+    se_memory_copy(data, capacity + 1, se_string_data(self), size + 1);
+
+    if (se_string_is_heap(self))
+    {
+        se_runtime_allocator_dealloc(se_string_heap_header(self));
+    }
+
+    self->storage.heap.data = data;
+    self->storage.heap.size = size;
+    SE_STRING_TAG(self)     = (char)SE_STRING_HEAP_TAG;
+}
+
+static void
+se_string_grow(se_string_t *self, se_usize_t required)
+{
+    const se_usize_t current = se_string_capacity(self);
+    if (required <= current)
+    {
+        return;
+    }
+
+    se_usize_t capacity = required;
+    if (current <= SE_USIZE_T_MAX / SE_DYNAMIC_BLOCK_GROWTH_FACTOR)
+    {
+        capacity = se_numeric_max(capacity, current * SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000);
+    }
+
+    se_string_set_capacity(self, capacity);
+}
+
+/**
+ * @brief Возвращает смещение указателя от начала данных строки.
+ *
+ * @return Смещение в байтах или `SE_USIZE_T_MAX`, если указатель
+ *         не указывает внутрь строки.
+ */
+static se_usize_t
+se_string_offset_of(const se_string_t *self, const void *ptr)
+{
+    const se_uaddr_t begin = se_ptr_to_addr(se_string_data(self));
+    const se_uaddr_t addr  = se_ptr_to_addr(ptr);
+
+    if (addr < begin || addr - begin >= se_string_size(self))
+    {
+        return SE_USIZE_T_MAX;
+    }
+
+    return (se_usize_t)(addr - begin);
+}
+
+// Shared by assign and append so that short strings take no exported calls
+// besides the copy kernel
+static void
+se_string_append_bytes(se_string_t *self, const void *data, se_usize_t size)
+{
+    if (!size)
+    {
+        return;
+    }
+
+    se_runtime_check(data, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_usize_t length = se_string_size(self);
+    se_runtime_check(size <= SE_USIZE_T_MAX - length, SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    // A part of the string itself is re-read from the new storage
+    const se_usize_t offset = se_string_offset_of(self, data);
+
+    se_string_grow(self, length + size);
+
+    if (offset != SE_USIZE_T_MAX)
+    {
+        data = se_string_data(self) + offset;
+    }
+
+    se_memory_std_copy(se_string_data(self) + length, data, size);
+    se_string_set_size(self, length + size);
+}
+
+void
+se_string_init(se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_string_reset(self);
+}
+
+void
+se_string_deinit(se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (se_string_is_heap(self))
+    {
+        se_runtime_allocator_dealloc(se_string_heap_header(self));
+    }
+
+    se_string_reset(self);
+}
+
+void
+se_string_assign(se_string_t *self, const void *data, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // A part of the string itself already fits: it is moved to the front
+    // before the terminator could overwrite it
+    if (size && se_string_offset_of(self, data) != SE_USIZE_T_MAX)
+    {
+        se_memory_std_move(se_string_data(self), data, size);
+        se_string_set_size(self, size);
+        return;
+    }
+
+    se_string_set_size(self, 0);
+    se_string_append_bytes(self, data, size);
+}
+
+void
+se_string_append(se_string_t *self, const void *data, se_usize_t size)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_string_append_bytes(self, data, size);
+}
+
+void
+se_string_reserve(se_string_t *self, se_usize_t capacity)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (capacity > se_string_capacity(self))
+    {
+        se_string_set_capacity(self, capacity);
+    }
+}
+
+void
+se_string_clear(se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_string_set_size(self, 0);
+}
+
+bool
+se_string_is_inline(const se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return !se_string_is_heap(self);
+}
+
+se_usize_t
+se_string_get_size(const se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_string_size(self);
+}
+
+se_usize_t
+se_string_get_capacity(const se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_string_capacity(self);
+}
+
+char *
+se_string_get_data(se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_string_data(self);
+}
+
+const char *
+se_string_get_cstr(const se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return se_string_data(self);
+}
+
+se_memory_view_t
+se_string_get_view(const se_string_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const char            *data = se_string_data(self);
+    const se_memory_view_t view = {data, data + se_string_size(self)};
+    return view;
+}
+
+se_usize_t
+se_string_find(const se_string_t *self, const void *needle, se_usize_t size)
+{
+    se_runtime_check(self && needle, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const char *data  = se_string_data(self);
+    const char *found = se_memory_find(data, se_string_size(self), needle, size);
+    return found ? (se_usize_t)(found - data) : SE_STRING_NPOS;
+}
+
+se_usize_t
+se_string_rfind(const se_string_t *self, const void *needle, se_usize_t size)
+{
+    se_runtime_check(self && needle, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const char *data  = se_string_data(self);
+    const char *found = se_memory_find_rev(data, se_string_size(self), needle, size);
+    return found ? (se_usize_t)(found - data) : SE_STRING_NPOS;
+}
+
+bool
+se_string_starts_with(const se_string_t *self, const void *prefix, se_usize_t size)
+{
+    se_runtime_check(self && prefix, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_usize_t length = se_string_size(self);
+    return size <= length && !se_memory_compare(se_string_data(self), length, prefix, size);
+}
+
+bool
+se_string_ends_with(const se_string_t *self, const void *suffix, se_usize_t size)
+{
+    se_runtime_check(self && suffix, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    // compare_rev aligns both blocks at their ends
+    const se_usize_t length = se_string_size(self);
+    return size <= length && !se_memory_compare_rev(se_string_data(self), length, suffix, size);
+}
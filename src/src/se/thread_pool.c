@@ -0,0 +1,736 @@
+#include <se/thread_pool.h>
+
+#include <se/runtime_allocator.h>
+#include <se/runtime_throw_with_code.h>
+#include <se/runtime_check.h>
+#include <se/memory_pool.h>
+#include <se/mpmc_queue.h>
+#include <se/ptr_util.h>
+#include <se/futex.h>
+#include <se/nullptr.h>
+#include <se/atomic.h>
+#include <se/bool.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#    include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+typedef HANDLE se_thread_pool_thread_t;
+#else
+typedef pthread_t se_thread_pool_thread_t;
+#endif
+
+/**
+ * @brief Биты состояния задачи.
+ */
+typedef enum se_thread_pool_task_state
+{
+    SE_THREAD_POOL_TASK_PENDING = 0,      /**< Задача еще не выполнена. */
+    SE_THREAD_POOL_TASK_DONE    = 1 << 0, /**< Задача выполнена. */
+    SE_THREAD_POOL_TASK_WAITED  = 1 << 1, /**< Ожидающий поток спит на слове состояния. */
+} se_thread_pool_task_state_t;
+
+struct se_thread_pool_task
+{
+    se_thread_pool_task_fn       *fn;
+    void                         *context;
+    struct se_thread_pool_worker *owner;    /**< Владелец памяти; `nullptr` — аллокатор времени выполнения. */
+    struct se_thread_pool_task   *next;     /**< Связь в списке удаленного освобождения. */
+    se_atomic_u32_t               state;    /**< Комбинация `se_thread_pool_task_state_t`. */
+    bool                          detached; /**< Задачу никто не ожидает. */
+};
+
+/**
+ * @brief Кольцевой массив очереди рабочего потока.
+ *
+ * При заполнении владелец заменяет массив вдвое большим. Старый массив
+ * может еще читаться ворами, поэтому он остается в списке `previous`
+ * до остановки пула.
+ */
+typedef struct se_thread_pool_buffer
+{
+    se_usize_t                    mask;
+    struct se_thread_pool_buffer *previous;
+    se_atomic_ptr_t               slots[];
+} se_thread_pool_buffer_t;
+
+typedef struct se_thread_pool_worker
+{
+    // Thieves' line: the end they steal from
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t top;
+
+    // Owner's line: the end it pushes to and takes from, and its task memory
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_usize_t              bottom;
+    se_atomic_ptr_t                buffer;
+    se_memory_pool_t               tasks;
+    se_u64_t                       random;
+    struct se_thread_pool_control *control;
+    se_usize_t                     index;
+    se_thread_pool_thread_t        thread;
+
+    // Tasks released by other threads, returned to the pool by the owner
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_ptr_t remote_free;
+} se_thread_pool_worker_t;
+
+typedef struct se_thread_pool_control
+{
+    // Idle workers: epoch in the upper bits, "someone sleeps" flag in bit 0
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_atomic_u32_t sleepers;
+    se_atomic_u32_t stopping;
+
+    // Tasks from threads outside the pool
+    SE_ATTRIBUTE(ALIGNED(SE_CACHE_LINE_SIZE))
+    se_mpmc_queue_t inject;
+
+    se_thread_pool_worker_t *workers;
+    se_usize_t               worker_count;
+} se_thread_pool_control_t;
+
+/**
+ * @brief Рабочий поток, выполняющий текущий поток, или `nullptr`.
+ *
+ * Без потоковой памяти пул не отличает свои потоки от чужих, поэтому
+ * переменная потоковая независимо от SE_LIBRARY_OPTION_THREAD_LOCAL.
+ */
+static SE_COMPILER(ATTRIBUTE_THREAD_LOCAL)
+se_thread_pool_worker_t *m_thread_pool_worker;
+
+/**
+ * @brief Количество задач, выполняемых текущим потоком внутри `se_thread_pool_wait`.
+ */
+static SE_COMPILER(ATTRIBUTE_THREAD_LOCAL)
+se_usize_t m_thread_pool_help_depth;
+
+static se_thread_pool_control_t *
+se_thread_pool_control(const se_thread_pool_t *self)
+{
+    return se_ptr_cast(se_thread_pool_control_t, self->control);
+}
+
+static se_thread_pool_worker_t *
+se_thread_pool_current(const se_thread_pool_t *self)
+{
+    se_thread_pool_worker_t *worker = m_thread_pool_worker;
+    return worker && worker->control == self->control ? worker : nullptr;
+}
+
+static se_usize_t
+se_thread_pool_next_random(se_u64_t *state)
+{
+    // xorshift64: victim selection only needs to spread thieves apart
+    se_u64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return (se_usize_t)x;
+}
+
+static se_thread_pool_buffer_t *
+se_thread_pool_buffer_alloc(se_usize_t capacity)
+{
+    se_runtime_check(capacity <= (SE_USIZE_T_MAX - sizeof(se_thread_pool_buffer_t)) / sizeof(se_atomic_ptr_t),
+                     SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_thread_pool_buffer_t *buffer = se_runtime_allocator_alloc_aligned(
+        sizeof(se_thread_pool_buffer_t) + capacity * sizeof(se_atomic_ptr_t), SE_CACHE_LINE_SIZE);
+
+    buffer->mask     = capacity - 1;
+    buffer->previous = nullptr;
+    return buffer;
+}
+
+static se_thread_pool_buffer_t *
+se_thread_pool_buffer_grow(se_thread_pool_worker_t *worker,
+                           se_thread_pool_buffer_t *buffer,
+                           se_usize_t               top,
+                           se_usize_t               bottom)
+{
+    se_thread_pool_buffer_t *grown = se_thread_pool_buffer_alloc((buffer->mask + 1) * 2);
+
+    for (se_usize_t i = top; i != bottom; ++i)
+    {
+        void *task = se_atomic_ptr_load(&buffer->slots[i & buffer->mask], SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_ptr_store(&grown->slots[i & grown->mask], task, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    grown->previous = buffer;
+
+    // Release: a thief that loads the new array also sees the copied slots
+    se_atomic_ptr_store(&worker->buffer, grown, SE_ATOMIC_ORDER_RELEASE);
+    return grown;
+}
+
+/**
+ * @brief Добавляет задачу в нижний конец очереди (только владелец).
+ */
+static void
+se_thread_pool_push(se_thread_pool_worker_t *worker, se_thread_pool_task_t *task)
+{
+    const se_usize_t         bottom = se_atomic_usize_load(&worker->bottom, SE_ATOMIC_ORDER_RELAXED);
+    const se_usize_t         top    = se_atomic_usize_load(&worker->top, SE_ATOMIC_ORDER_ACQUIRE);
+    se_thread_pool_buffer_t *buffer = se_atomic_ptr_load(&worker->buffer, SE_ATOMIC_ORDER_RELAXED);
+
+    if (bottom - top > buffer->mask)
+    {
+        buffer = se_thread_pool_buffer_grow(worker, buffer, top, bottom);
+    }
+
+    se_atomic_ptr_store(&buffer->slots[bottom & buffer->mask], task, SE_ATOMIC_ORDER_RELAXED);
+
+    // The slot is written before the new bottom becomes visible to thieves
+    se_atomic_thread_fence(SE_ATOMIC_ORDER_RELEASE);
+    se_atomic_usize_store(&worker->bottom, bottom + 1, SE_ATOMIC_ORDER_RELAXED);
+}
+
+/**
+ * @brief Забирает последнюю добавленную задачу (только владелец).
+ */
+static se_thread_pool_task_t *
+se_thread_pool_take(se_thread_pool_worker_t *worker)
+{
+    const se_usize_t bottom = se_atomic_usize_load(&worker->bottom, SE_ATOMIC_ORDER_RELAXED) - 1;
+
+    // Only the owner moves bottom and top never decreases: a stale top can
+    // only make the queue look fuller, so "empty" here needs no fence
+    if ((se_ssize_t)(bottom - se_atomic_usize_load(&worker->top, SE_ATOMIC_ORDER_RELAXED)) < 0)
+    {
+        return nullptr;
+    }
+
+    se_thread_pool_buffer_t *buffer = se_atomic_ptr_load(&worker->buffer, SE_ATOMIC_ORDER_RELAXED);
+
+    // Reserve the slot first, then look at top: a thief does the opposite,
+    // so at most one of them can get the last task without the CAS below
+    se_atomic_usize_store(&worker->bottom, bottom, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_thread_fence(SE_ATOMIC_ORDER_SEQ_CST);
+    se_usize_t top = se_atomic_usize_load(&worker->top, SE_ATOMIC_ORDER_RELAXED);
+
+    if ((se_ssize_t)(bottom - top) < 0)
+    {
+        se_atomic_usize_store(&worker->bottom, bottom + 1, SE_ATOMIC_ORDER_RELAXED);
+        return nullptr;
+    }
+
+    se_thread_pool_task_t *task = se_atomic_ptr_load(&buffer->slots[bottom & buffer->mask], SE_ATOMIC_ORDER_RELAXED);
+
+    if (bottom == top)
+    {
+        // The last task: race the thieves for it
+        if (!se_atomic_usize_compare_exchange_strong(
+                &worker->top, &top, top + 1, SE_ATOMIC_ORDER_SEQ_CST, SE_ATOMIC_ORDER_RELAXED))
+        {
+            task = nullptr;
+        }
+        se_atomic_usize_store(&worker->bottom, bottom + 1, SE_ATOMIC_ORDER_RELAXED);
+    }
+
+    return task;
+}
+
+/**
+ * @brief Крадет самую старую задачу из очереди другого потока.
+ */
+static se_thread_pool_task_t *
+se_thread_pool_steal(se_thread_pool_worker_t *victim)
+{
+    // Cheap emptiness check: idle workers scan every queue
+    if ((se_ssize_t)(se_atomic_usize_load(&victim->bottom, SE_ATOMIC_ORDER_RELAXED) -
+                     se_atomic_usize_load(&victim->top, SE_ATOMIC_ORDER_RELAXED)) <= 0)
+    {
+        return nullptr;
+    }
+
+    for (;;)
+    {
+        se_usize_t top = se_atomic_usize_load(&victim->top, SE_ATOMIC_ORDER_ACQUIRE);
+        se_atomic_thread_fence(SE_ATOMIC_ORDER_SEQ_CST);
+        const se_usize_t bottom = se_atomic_usize_load(&victim->bottom, SE_ATOMIC_ORDER_ACQUIRE);
+
+        if ((se_ssize_t)(bottom - top) <= 0)
+        {
+            return nullptr;
+        }
+
+        se_thread_pool_buffer_t *buffer = se_atomic_ptr_load(&victim->buffer, SE_ATOMIC_ORDER_ACQUIRE);
+        se_thread_pool_task_t   *task = se_atomic_ptr_load(&buffer->slots[top & buffer->mask], SE_ATOMIC_ORDER_RELAXED);
+
+        // A failed CAS means another thread took this task: retry with the next one
+        if (se_atomic_usize_compare_exchange_strong(
+                &victim->top, &top, top + 1, SE_ATOMIC_ORDER_SEQ_CST, SE_ATOMIC_ORDER_RELAXED))
+        {
+            return task;
+        }
+    }
+}
+
+/**
+ * @brief Ищет задачу: своя очередь, общая очередь, затем кража со случайной жертвы.
+ *
+ * @param[in] worker Текущий рабочий поток или `nullptr` для потока вне пула.
+ * @param[in,out] random Состояние генератора выбора жертвы.
+ */
+static se_thread_pool_task_t *
+se_thread_pool_find(se_thread_pool_control_t *control, se_thread_pool_worker_t *worker, se_u64_t *random)
+{
+    se_thread_pool_task_t *task = nullptr;
+
+    if (worker && (task = se_thread_pool_take(worker)))
+    {
+        return task;
+    }
+
+    if (se_mpmc_queue_try_dequeue(&control->inject, &task))
+    {
+        return task;
+    }
+
+    const se_usize_t start = se_thread_pool_next_random(random);
+    for (se_usize_t i = 0; i < control->worker_count; ++i)
+    {
+        se_thread_pool_worker_t *victim = &control->workers[(start + i) % control->worker_count];
+        if (victim != worker && (task = se_thread_pool_steal(victim)))
+        {
+            return task;
+        }
+    }
+
+    return nullptr;
+}
+
+static void
+se_thread_pool_notify(se_thread_pool_control_t *control)
+{
+    // Pairs with the fence in se_thread_pool_prepare_park: either the sleeper
+    // sees the published task or this thread sees its flag
+    se_atomic_thread_fence(SE_ATOMIC_ORDER_SEQ_CST);
+    se_u32_t state = se_atomic_u32_load(&control->sleepers, SE_ATOMIC_ORDER_RELAXED);
+
+    while (state & 1)
+    {
+        // Next epoch with the flag cleared: later tasks do not wake again
+        // until someone goes back to sleep
+        if (se_atomic_u32_compare_exchange_weak(
+                &control->sleepers, &state, state + 1, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED))
+        {
+            se_futex_wake(&control->sleepers, SE_FUTEX_WAKE_ALL);
+            return;
+        }
+    }
+}
+
+static se_u32_t
+se_thread_pool_prepare_park(se_thread_pool_control_t *control)
+{
+    const se_u32_t state = se_atomic_u32_fetch_or(&control->sleepers, 1, SE_ATOMIC_ORDER_SEQ_CST) | 1;
+    se_atomic_thread_fence(SE_ATOMIC_ORDER_SEQ_CST);
+    return state;
+}
+
+static se_thread_pool_task_t *
+se_thread_pool_task_alloc(se_thread_pool_worker_t *worker)
+{
+    if (!worker)
+    {
+        se_thread_pool_task_t *task =
+            se_runtime_allocator_alloc_aligned(sizeof(se_thread_pool_task_t), SE_CACHE_LINE_SIZE);
+        task->owner = nullptr;
+        return task;
+    }
+
+    // Take back the tasks other threads have released, all at once
+    if (se_atomic_ptr_load(&worker->remote_free, SE_ATOMIC_ORDER_RELAXED))
+    {
+        se_thread_pool_task_t *released =
+            se_atomic_ptr_exchange(&worker->remote_free, nullptr, SE_ATOMIC_ORDER_ACQUIRE);
+
+        while (released)
+        {
+            se_thread_pool_task_t *next = released->next;
+            se_memory_pool_dealloc(&worker->tasks, released);
+            released = next;
+        }
+    }
+
+    se_thread_pool_task_t *task = se_memory_pool_alloc(&worker->tasks);
+    task->owner                 = worker;
+    return task;
+}
+
+static void
+se_thread_pool_task_dealloc(se_thread_pool_task_t *task)
+{
+    se_thread_pool_worker_t *owner = task->owner;
+
+    if (!owner)
+    {
+        se_runtime_allocator_dealloc(task);
+    }
+    else if (owner == m_thread_pool_worker)
+    {
+        se_memory_pool_dealloc(&owner->tasks, task);
+    }
+    else
+    {
+        void *head = se_atomic_ptr_load(&owner->remote_free, SE_ATOMIC_ORDER_RELAXED);
+        do
+        {
+            task->next = head;
+        } while (!se_atomic_ptr_compare_exchange_weak(
+            &owner->remote_free, &head, task, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED));
+    }
+}
+
+static void
+se_thread_pool_run(se_thread_pool_task_t *task)
+{
+    task->fn(task->context);
+
+    if (task->detached)
+    {
+        se_thread_pool_task_dealloc(task);
+        return;
+    }
+
+    // The waiter may release the task as soon as it sees DONE. A wake on the
+    // released address is harmless: futex waiters always re-check their word.
+    const se_u32_t state = se_atomic_u32_exchange(&task->state, SE_THREAD_POOL_TASK_DONE, SE_ATOMIC_ORDER_ACQ_REL);
+    if (state & SE_THREAD_POOL_TASK_WAITED)
+    {
+        se_futex_wake(&task->state, SE_FUTEX_WAKE_ALL);
+    }
+}
+
+static void
+se_thread_pool_work(se_thread_pool_worker_t *worker)
+{
+    se_thread_pool_control_t *control = worker->control;
+    se_usize_t                spins   = 0;
+
+    m_thread_pool_worker = worker;
+
+    for (;;)
+    {
+        se_thread_pool_task_t *task = se_thread_pool_find(control, worker, &worker->random);
+        if (task)
+        {
+            se_thread_pool_run(task);
+            spins = 0;
+            continue;
+        }
+
+        if (spins++ < SE_THREAD_POOL_SPIN_COUNT)
+        {
+            se_atomic_pause();
+            continue;
+        }
+
+        // Announce the sleep, then look once more so that a task pushed in between is not missed
+        const se_u32_t state = se_thread_pool_prepare_park(control);
+
+        task = se_thread_pool_find(control, worker, &worker->random);
+        if (task)
+        {
+            se_thread_pool_run(task);
+            spins = 0;
+            continue;
+        }
+
+        // Stop only with nothing left to run
+        if (se_atomic_u32_load(&control->stopping, SE_ATOMIC_ORDER_ACQUIRE))
+        {
+            break;
+        }
+
+        se_futex_wait(&control->sleepers, state);
+        spins = 0;
+    }
+
+    m_thread_pool_worker = nullptr;
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI
+se_thread_pool_thread_main(LPVOID argument)
+{
+    se_thread_pool_work(argument);
+    return 0;
+}
+#else
+static void *
+se_thread_pool_thread_main(void *argument)
+{
+    se_thread_pool_work(argument);
+    return nullptr;
+}
+#endif
+
+static bool
+se_thread_pool_thread_start(se_thread_pool_worker_t *worker)
+{
+#if defined(_WIN32)
+    worker->thread = CreateThread(nullptr, 0, se_thread_pool_thread_main, worker, 0, nullptr);
+    return worker->thread != nullptr;
+#else
+    return pthread_create(&worker->thread, nullptr, se_thread_pool_thread_main, worker) == 0;
+#endif
+}
+
+static void
+se_thread_pool_thread_join(se_thread_pool_worker_t *worker)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(worker->thread, INFINITE);
+    CloseHandle(worker->thread);
+#else
+    pthread_join(worker->thread, nullptr);
+#endif
+}
+
+static se_usize_t
+se_thread_pool_hardware_concurrency(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (se_usize_t)count : 1;
+#endif
+}
+
+/**
+ * @brief Останавливает первые `started` рабочих потоков и освобождает память пула.
+ */
+static void
+se_thread_pool_destroy(se_thread_pool_control_t *control, se_usize_t started)
+{
+    // The stop flag goes first: a worker that misses it has announced its
+    // sleep before the epoch below changes, so its futex wait returns at once
+    se_atomic_u32_store(&control->stopping, 1, SE_ATOMIC_ORDER_SEQ_CST);
+    se_atomic_u32_fetch_add(&control->sleepers, 2, SE_ATOMIC_ORDER_SEQ_CST);
+    se_futex_wake(&control->sleepers, SE_FUTEX_WAKE_ALL);
+
+    for (se_usize_t i = 0; i < started; ++i)
+    {
+        se_thread_pool_thread_join(&control->workers[i]);
+    }
+
+    for (se_usize_t i = 0; i < control->worker_count; ++i)
+    {
+        se_thread_pool_worker_t *worker = &control->workers[i];
+        se_thread_pool_buffer_t *buffer = se_atomic_ptr_load(&worker->buffer, SE_ATOMIC_ORDER_RELAXED);
+
+        while (buffer)
+        {
+            se_thread_pool_buffer_t *previous = buffer->previous;
+            se_runtime_allocator_dealloc(buffer);
+            buffer = previous;
+        }
+
+        // Tasks on the remote free list live in the pool's slabs
+        se_memory_pool_deinit(&worker->tasks);
+    }
+
+    se_mpmc_queue_deinit(&control->inject);
+    se_runtime_allocator_dealloc(control->workers);
+    se_runtime_allocator_dealloc(control);
+}
+
+void
+se_thread_pool_init(se_thread_pool_t *self, se_usize_t worker_count)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    if (!worker_count)
+    {
+        worker_count = se_thread_pool_hardware_concurrency();
+    }
+    se_runtime_check(worker_count <= SE_USIZE_T_MAX / sizeof(se_thread_pool_worker_t), SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+
+    se_thread_pool_control_t *control =
+        se_runtime_allocator_alloc_aligned(sizeof(se_thread_pool_control_t), SE_CACHE_LINE_SIZE);
+
+    se_atomic_u32_store(&control->sleepers, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_atomic_u32_store(&control->stopping, 0, SE_ATOMIC_ORDER_RELAXED);
+    se_mpmc_queue_init(&control->inject, SE_THREAD_POOL_INJECT_CAPACITY, sizeof(se_thread_pool_task_t *));
+
+    control->worker_count = worker_count;
+    control->workers      = se_runtime_allocator_alloc_aligned(worker_count * sizeof(se_thread_pool_worker_t),
+                                                          SE_CACHE_LINE_SIZE);
+
+    for (se_usize_t i = 0; i < worker_count; ++i)
+    {
+        se_thread_pool_worker_t *worker = &control->workers[i];
+
+        se_atomic_usize_store(&worker->top, 0, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_usize_store(&worker->bottom, 0, SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_ptr_store(
+            &worker->buffer, se_thread_pool_buffer_alloc(SE_THREAD_POOL_DEQUE_CAPACITY), SE_ATOMIC_ORDER_RELAXED);
+        se_atomic_ptr_store(&worker->remote_free, nullptr, SE_ATOMIC_ORDER_RELAXED);
+
+        // Task state words are written by other threads: one task per cache line
+        se_memory_pool_init(&worker->tasks, sizeof(se_thread_pool_task_t), SE_CACHE_LINE_SIZE, 0);
+
+        worker->random  = 0x9E3779B97F4A7C15ull * (i + 1);
+        worker->control = control;
+        worker->index   = i;
+    }
+
+    for (se_usize_t i = 0; i < worker_count; ++i)
+    {
+        if (!se_thread_pool_thread_start(&control->workers[i]))
+        {
+            se_thread_pool_destroy(control, i);
+            se_runtime_throw_with_code(SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+        }
+    }
+
+    self->workers      = control->workers;
+    self->worker_count = worker_count;
+    self->control      = control;
+}
+
+void
+se_thread_pool_deinit(se_thread_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_thread_pool_destroy(se_thread_pool_control(self), self->worker_count);
+
+    self->workers      = nullptr;
+    self->worker_count = 0;
+    self->control      = nullptr;
+}
+
+static se_thread_pool_task_t *
+se_thread_pool_schedule(se_thread_pool_t *self, se_thread_pool_task_fn *fn, void *context, bool detached)
+{
+    se_runtime_check(self && fn, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    se_thread_pool_control_t *control = se_thread_pool_control(self);
+    se_thread_pool_worker_t  *worker  = se_thread_pool_current(self);
+    se_thread_pool_task_t    *task    = se_thread_pool_task_alloc(worker);
+
+    task->fn       = fn;
+    task->context  = context;
+    task->next     = nullptr;
+    task->detached = detached;
+    se_atomic_u32_store(&task->state, SE_THREAD_POOL_TASK_PENDING, SE_ATOMIC_ORDER_RELAXED);
+
+    if (worker)
+    {
+        se_thread_pool_push(worker, task);
+    }
+    else if (!se_mpmc_queue_try_enqueue(&control->inject, &task))
+    {
+        // The workers are behind: run the task here instead of blocking until
+        // they free a slot, which on a loaded machine costs two context
+        // switches per task. The workers are already awake.
+        se_thread_pool_run(task);
+        return detached ? nullptr : task;
+    }
+
+    se_thread_pool_notify(control);
+    return task;
+}
+
+se_thread_pool_task_t *
+se_thread_pool_spawn(se_thread_pool_t *self, se_thread_pool_task_fn *fn, void *context)
+{
+    return se_thread_pool_schedule(self, fn, context, false);
+}
+
+void
+se_thread_pool_submit(se_thread_pool_t *self, se_thread_pool_task_fn *fn, void *context)
+{
+    se_thread_pool_schedule(self, fn, context, true);
+}
+
+void
+se_thread_pool_wait(se_thread_pool_t *self, se_thread_pool_task_t *task)
+{
+    se_runtime_check(self && task, SE_RUNTIME_ERROR_NULL_POINTER);
+    se_runtime_check(!task->detached, SE_RUNTIME_ERROR_INVALID_ARGUMENT);
+
+    se_thread_pool_control_t *control = se_thread_pool_control(self);
+    se_thread_pool_worker_t  *worker  = se_thread_pool_current(self);
+    se_u64_t                  random  = worker ? worker->random : (se_u64_t)(se_usize_t)task | 1;
+    se_usize_t                spins   = 0;
+
+    for (;;)
+    {
+        se_u32_t state = se_atomic_u32_load(&task->state, SE_ATOMIC_ORDER_ACQUIRE);
+        if (state & SE_THREAD_POOL_TASK_DONE)
+        {
+            break;
+        }
+
+        // Help instead of blocking: usually the awaited task is the newest in this queue.
+        // Deep in nested waits only the own queue is used: it holds the awaited
+        // subtree, while foreign tasks would pile up frames on this stack.
+        se_thread_pool_task_t *other = nullptr;
+        if (m_thread_pool_help_depth < SE_THREAD_POOL_HELP_DEPTH)
+        {
+            other = se_thread_pool_find(control, worker, &random);
+        }
+        else if (worker)
+        {
+            other = se_thread_pool_take(worker);
+        }
+
+        if (other)
+        {
+            ++m_thread_pool_help_depth;
+            se_thread_pool_run(other);
+            --m_thread_pool_help_depth;
+            spins = 0;
+            continue;
+        }
+
+        if (spins++ < SE_THREAD_POOL_SPIN_COUNT)
+        {
+            se_atomic_pause();
+            continue;
+        }
+
+        // Nothing to help with: the task is running on another thread
+        state = se_atomic_u32_fetch_or(&task->state, SE_THREAD_POOL_TASK_WAITED, SE_ATOMIC_ORDER_ACQUIRE);
+        if (state & SE_THREAD_POOL_TASK_DONE)
+        {
+            break;
+        }
+        se_futex_wait(&task->state, state | SE_THREAD_POOL_TASK_WAITED);
+    }
+
+    if (worker)
+    {
+        worker->random = random;
+    }
+    se_thread_pool_task_dealloc(task);
+}
+
+se_usize_t
+se_thread_pool_get_worker_count(const se_thread_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+    return self->worker_count;
+}
+
+se_usize_t
+se_thread_pool_get_worker_index(const se_thread_pool_t *self)
+{
+    se_runtime_check(self, SE_RUNTIME_ERROR_NULL_POINTER);
+
+    const se_thread_pool_worker_t *worker = se_thread_pool_current(self);
+    return worker ? worker->index : SE_THREAD_POOL_NOT_WORKER;
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <se/array.h>
+#include <se/runtime_check.h>
+
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+int g_allocations = 0;
+
+void *counting_alloc(se_usize_t size) {
+  ++g_allocations;
+  return std::malloc(size);
+}
+
+std::vector<int> contents(const se_array_t &array) {
+  const int *data = static_cast<const int *>(se_array_get_data(&array));
+  return std::vector<int>(data, data + se_array_get_size(&array));
+}
+
+} // namespace
+
+TEST(se_array_init, zero_element_size) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  se_array_t array;
+  EXPECT_DEATH(se_array_init(&array, 0, nullptr), ".*");
+}
+
+TEST(se_array_push, geometric_growth) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  for (int i = 0; i < SE_ARRAY_MIN_CAPACITY; ++i) {
+    EXPECT_EQ(*static_cast<int *>(se_array_push(&array, &i)), i);
+  }
+  EXPECT_EQ(se_array_get_capacity(&array), se_usize_t{SE_ARRAY_MIN_CAPACITY});
+
+  const int value = 100;
+  se_array_push(&array, &value);
+  EXPECT_EQ(se_array_get_capacity(&array),
+            se_usize_t{SE_ARRAY_MIN_CAPACITY} * SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000);
+  EXPECT_EQ(*static_cast<int *>(se_array_at(&array, SE_ARRAY_MIN_CAPACITY)), 100);
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_pop, last_element) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  const int a = 1, b = 2;
+  se_array_push(&array, &a);
+  se_array_push(&array, &b);
+
+  int out = 0;
+  se_array_pop(&array, &out);
+  EXPECT_EQ(out, 2);
+  se_array_pop(&array, nullptr);
+  EXPECT_EQ(se_array_get_size(&array), 0u);
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    EXPECT_DEATH(se_array_pop(&array, nullptr), ".*");
+  }
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_insert, shifts_tail) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  se_array_insert(&array, 0, expected.data(), expected.size());
+
+  const int middle[] = {-1, -2, -3};
+  se_array_insert(&array, 50, middle, 3);
+  expected.insert(expected.begin() + 50, middle, middle + 3);
+  EXPECT_EQ(contents(array), expected);
+
+  se_array_insert(&array, se_array_get_size(&array), middle, 1);
+  expected.push_back(-1);
+  EXPECT_EQ(contents(array), expected);
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    EXPECT_DEATH(se_array_insert(&array, se_array_get_size(&array) + 1, middle, 1), ".*");
+  }
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_insert, from_own_elements) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  std::vector<int> expected(10);
+  std::iota(expected.begin(), expected.end(), 0);
+  se_array_insert(&array, 0, expected.data(), expected.size());
+  ASSERT_EQ(se_array_get_capacity(&array), se_array_get_size(&array));
+
+  // Every call below reallocates or shifts the elements it reads
+  const int *data = static_cast<const int *>(se_array_get_data(&array));
+  se_array_push(&array, data + 3);
+  expected.push_back(3);
+  EXPECT_EQ(contents(array), expected);
+
+  const auto insert_own = [&](std::size_t index, std::size_t from, std::size_t count) {
+    data = static_cast<const int *>(se_array_get_data(&array));
+    se_array_insert(&array, index, data + from, count);
+    const std::vector<int> source(expected.begin() + from, expected.begin() + from + count);
+    expected.insert(expected.begin() + index, source.begin(), source.end());
+    EXPECT_EQ(contents(array), expected);
+  };
+  insert_own(2, 5, 4);  // source behind the index
+  insert_own(8, 1, 3);  // source before the index
+  insert_own(6, 4, 5);  // source straddles the index
+  insert_own(0, 0, se_array_get_size(&array));
+
+  const se_memory_view_t own = se_array_get_view(&array);
+  se_array_append_view(&array, &own);
+  const std::vector<int> copy = expected;
+  expected.insert(expected.end(), copy.begin(), copy.end());
+  EXPECT_EQ(contents(array), expected);
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_erase, shifts_tail) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  se_array_insert(&array, 0, expected.data(), expected.size());
+
+  se_array_erase(&array, 10, 20);
+  expected.erase(expected.begin() + 10, expected.begin() + 30);
+  EXPECT_EQ(contents(array), expected);
+
+  se_array_erase(&array, 70, 10);
+  expected.erase(expected.begin() + 70, expected.end());
+  EXPECT_EQ(contents(array), expected);
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    EXPECT_DEATH(se_array_erase(&array, 60, 20), ".*");
+  }
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_append_view, whole_elements) {
+  se_array_t array;
+  se_array_init(&array, sizeof(int), nullptr);
+
+  const int values[] = {1, 2, 3, 4};
+  const se_memory_view_t view = {values, values + 4};
+  se_array_append_view(&array, &view);
+  se_array_append_view(&array, &view);
+  EXPECT_EQ(contents(array), (std::vector<int>{1, 2, 3, 4, 1, 2, 3, 4}));
+
+  se_array_t other;
+  se_array_init(&other, sizeof(int), nullptr);
+  const se_memory_view_t empty = se_array_get_view(&other);
+  EXPECT_EQ(se_memory_view_get_size(&empty), 0u);
+  se_array_append_view(&array, &empty);
+  EXPECT_EQ(se_array_get_size(&array), 8u);
+  se_array_deinit(&other);
+
+  const se_memory_view_t partial = {values, reinterpret_cast<const char *>(values) + 6};
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    EXPECT_DEATH(se_array_append_view(&array, &partial), ".*");
+  }
+
+  const se_memory_view_t own = se_array_get_view(&array);
+  EXPECT_EQ(se_memory_view_get_size(&own), 8 * sizeof(int));
+
+  se_array_deinit(&array);
+}
+
+TEST(se_array_init, custom_allocator) {
+  const se_memory_allocator_t allocator = {counting_alloc, std::free, nullptr, nullptr};
+
+  se_array_t array;
+  se_array_init(&array, sizeof(double), &allocator);
+  g_allocations = 0;
+
+  se_array_reserve(&array, 1000);
+  for (int i = 0; i < 1000; ++i) {
+    const double value = i;
+    se_array_push(&array, &value);
+  }
+  EXPECT_EQ(g_allocations, 1);
+
+  se_array_deinit(&array);
+}
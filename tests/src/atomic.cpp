@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <se/atomic.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+TEST(se_atomic_u32, load_store_exchange) {
+  se_atomic_u32_t value;
+  se_atomic_u32_store(&value, 7, SE_ATOMIC_ORDER_RELAXED);
+  EXPECT_EQ(se_atomic_u32_load(&value, SE_ATOMIC_ORDER_ACQUIRE), 7u);
+
+  EXPECT_EQ(se_atomic_u32_exchange(&value, 9, SE_ATOMIC_ORDER_ACQ_REL), 7u);
+  EXPECT_EQ(se_atomic_u32_load(&value, SE_ATOMIC_ORDER_SEQ_CST), 9u);
+}
+
+TEST(se_atomic_u32, fetch_operations_return_old_value) {
+  se_atomic_u32_t value;
+  se_atomic_u32_store(&value, 0xF0, SE_ATOMIC_ORDER_RELAXED);
+
+  EXPECT_EQ(se_atomic_u32_fetch_add(&value, 0x10, SE_ATOMIC_ORDER_RELAXED), 0xF0u);
+  EXPECT_EQ(se_atomic_u32_fetch_sub(&value, 0x20, SE_ATOMIC_ORDER_RELAXED), 0x100u);
+  EXPECT_EQ(se_atomic_u32_fetch_and(&value, 0x0F, SE_ATOMIC_ORDER_RELAXED), 0xE0u);
+  EXPECT_EQ(se_atomic_u32_fetch_or(&value, 0x81, SE_ATOMIC_ORDER_RELAXED), 0x00u);
+  EXPECT_EQ(se_atomic_u32_load(&value, SE_ATOMIC_ORDER_RELAXED), 0x81u);
+
+  // Wraps around like unsigned arithmetic
+  se_atomic_u32_store(&value, 0, SE_ATOMIC_ORDER_RELAXED);
+  se_atomic_u32_fetch_sub(&value, 1, SE_ATOMIC_ORDER_RELAXED);
+  EXPECT_EQ(se_atomic_u32_load(&value, SE_ATOMIC_ORDER_RELAXED), UINT32_MAX);
+}
+
+TEST(se_atomic_u64, compare_exchange_reports_current_value) {
+  se_atomic_u64_t value;
+  se_atomic_u64_store(&value, 1ull << 40, SE_ATOMIC_ORDER_RELAXED);
+
+  se_u64_t expected = 5;
+  EXPECT_FALSE(se_atomic_u64_compare_exchange_strong(
+      &value, &expected, 6, SE_ATOMIC_ORDER_ACQ_REL, SE_ATOMIC_ORDER_ACQUIRE));
+  EXPECT_EQ(expected, 1ull << 40);
+
+  EXPECT_TRUE(se_atomic_u64_compare_exchange_strong(
+      &value, &expected, 6, SE_ATOMIC_ORDER_ACQ_REL, SE_ATOMIC_ORDER_ACQUIRE));
+  EXPECT_EQ(se_atomic_u64_load(&value, SE_ATOMIC_ORDER_RELAXED), 6u);
+
+  // The weak form may fail spuriously, so retry it as callers do
+  expected = 6;
+  while (!se_atomic_u64_compare_exchange_weak(
+      &value, &expected, 8, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED)) {
+    ASSERT_EQ(expected, 6u);
+  }
+  EXPECT_EQ(se_atomic_u64_load(&value, SE_ATOMIC_ORDER_RELAXED), 8u);
+}
+
+TEST(se_atomic_ptr, exchange_and_compare_exchange) {
+  int first = 0;
+  int second = 0;
+
+  se_atomic_ptr_t slot;
+  se_atomic_ptr_store(&slot, nullptr, SE_ATOMIC_ORDER_RELAXED);
+
+  void *expected = nullptr;
+  EXPECT_TRUE(se_atomic_ptr_compare_exchange_strong(
+      &slot, &expected, &first, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED));
+  EXPECT_FALSE(se_atomic_ptr_compare_exchange_strong(
+      &slot, &expected, &second, SE_ATOMIC_ORDER_RELEASE, SE_ATOMIC_ORDER_RELAXED));
+  EXPECT_EQ(expected, &first);
+
+  EXPECT_EQ(se_atomic_ptr_exchange(&slot, &second, SE_ATOMIC_ORDER_ACQ_REL), &first);
+  EXPECT_EQ(se_atomic_ptr_load(&slot, SE_ATOMIC_ORDER_ACQUIRE), &second);
+}
+
+TEST(se_atomic_usize, concurrent_fetch_add_loses_no_updates) {
+  constexpr int kThreads = 8;
+  constexpr se_usize_t kIncrements = 20000;
+
+  se_atomic_usize_t counter;
+  se_atomic_usize_store(&counter, 0, SE_ATOMIC_ORDER_RELAXED);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&counter] {
+      for (se_usize_t i = 0; i < kIncrements; ++i) {
+        se_atomic_usize_fetch_add(&counter, 1, SE_ATOMIC_ORDER_RELAXED);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(se_atomic_usize_load(&counter, SE_ATOMIC_ORDER_RELAXED), kThreads * kIncrements);
+}
+
+TEST(se_atomic_u32, release_acquire_publishes_payload) {
+  se_atomic_u32_t ready;
+  se_atomic_u32_store(&ready, 0, SE_ATOMIC_ORDER_RELAXED);
+  int payload = 0;
+
+  std::thread writer([&] {
+    payload = 42;
+    se_atomic_u32_store(&ready, 1, SE_ATOMIC_ORDER_RELEASE);
+  });
+
+  for (unsigned spin = 0; !se_atomic_u32_load(&ready, SE_ATOMIC_ORDER_ACQUIRE); ++spin) {
+    if (spin % 64 == 63) {
+      se_atomic_yield();
+    } else {
+      se_atomic_pause();
+    }
+  }
+  EXPECT_EQ(payload, 42);
+
+  writer.join();
+}
+
+#ifdef SE_ATOMIC_HAS_U128
+TEST(se_atomic_u128, compare_exchange_whole_pair) {
+  alignas(16) se_atomic_u128_t value = (se_u128_t(1) << 64) | 2;
+
+  se_u128_t expected = 2;
+  EXPECT_FALSE(se_atomic_u128_compare_exchange(&value, &expected, 3));
+  EXPECT_EQ(expected, (se_u128_t(1) << 64) | 2);
+
+  const se_u128_t desired = (se_u128_t(5) << 64) | 6;
+  EXPECT_TRUE(se_atomic_u128_compare_exchange(&value, &expected, desired));
+
+  expected = 0;
+  se_atomic_u128_compare_exchange(&value, &expected, 0);
+  EXPECT_EQ(expected, desired);
+}
+#endif
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <se/barrier.h>
+#include <se/atomic.h>
+#include <se/runtime_check.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(se_barrier_init, rejects_zero_count) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  se_barrier_t barrier;
+  EXPECT_DEATH(se_barrier_init(&barrier, 0, nullptr), ".*");
+}
+
+TEST(se_barrier_arrive_and_wait, single_thread_is_always_last) {
+  se_barrier_t barrier;
+  se_barrier_init(&barrier, 1, nullptr);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(se_barrier_arrive_and_wait(&barrier));
+  }
+}
+
+TEST(se_barrier_arrive_and_wait, separates_phases) {
+  constexpr int kThreads = 4;
+  constexpr int kPhases = 200;
+
+  se_lock_stats_t stats = {};
+  se_barrier_t barrier;
+  se_barrier_init(&barrier, kThreads, &stats);
+
+  // Each phase every thread writes its own slot, then checks all slots
+  // from the previous phase after the barrier
+  std::vector<int> slots(kThreads, 0);
+  std::atomic<int> mismatches{0};
+  std::atomic<int> last_count{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int phase = 1; phase <= kPhases; ++phase) {
+        slots[t] = phase;
+        if (se_barrier_arrive_and_wait(&barrier)) {
+          last_count.fetch_add(1);
+        }
+        for (int other = 0; other < kThreads; ++other) {
+          if (slots[other] != phase) {
+            mismatches.fetch_add(1);
+          }
+        }
+        se_barrier_arrive_and_wait(&barrier);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(mismatches.load(), 0);
+  EXPECT_EQ(last_count.load(), kPhases);
+  EXPECT_GT(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), 0u);
+}
@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+#include <se/runtime_allocator.h>
+#include <se/atomic.h>
+#include <se/ebr.h>
+#include <se/runtime_check.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<se_usize_t> freed_count{0};
+
+void counting_dealloc(void *ptr) {
+  freed_count.fetch_add(1);
+  se_runtime_allocator_dealloc(ptr);
+}
+
+void *make_node() {
+  return se_runtime_allocator_alloc(32);
+}
+
+// Collects until the current thread has nothing pending; other threads may
+// still hold critical sections for a while
+void drain() {
+  while (se_ebr_get_pending()) {
+    se_ebr_collect();
+    std::this_thread::yield();
+  }
+}
+
+struct node_t {
+  node_t *next;
+  int value;
+};
+
+void push(se_atomic_ptr_t *head, node_t *node) {
+  void *expected = se_atomic_ptr_load(head, SE_ATOMIC_ORDER_RELAXED);
+  do {
+    node->next = static_cast<node_t *>(expected);
+  } while (!se_atomic_ptr_compare_exchange_weak(head, &expected, node, SE_ATOMIC_ORDER_RELEASE,
+                                                SE_ATOMIC_ORDER_RELAXED));
+}
+
+}  // namespace
+
+TEST(se_ebr_retire, frees_after_two_epochs) {
+  drain();
+  freed_count = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    se_ebr_retire(make_node(), counting_dealloc);
+  }
+  EXPECT_EQ(se_ebr_get_pending(), 10u);
+  EXPECT_EQ(freed_count.load(), 0u);
+
+  // Without other active threads every collection advances one epoch
+  se_usize_t freed = 0;
+  for (int i = 0; i < 3 && se_ebr_get_pending(); ++i) {
+    freed += se_ebr_collect();
+  }
+  EXPECT_EQ(freed, 10u);
+  EXPECT_EQ(freed_count.load(), 10u);
+  EXPECT_EQ(se_ebr_get_pending(), 0u);
+}
+
+TEST(se_ebr_retire, uses_runtime_allocator_by_default) {
+  drain();
+  se_ebr_retire(make_node(), nullptr);
+  drain();
+  EXPECT_EQ(se_ebr_get_pending(), 0u);
+}
+
+TEST(se_ebr_retire, collects_in_batches) {
+  drain();
+  freed_count = 0;
+
+  constexpr int kCount = 20 * SE_EBR_BATCH_SIZE;
+  for (int i = 0; i < kCount; ++i) {
+    se_ebr_retire(make_node(), counting_dealloc);
+    ASSERT_LE(se_ebr_get_pending(), 3u * SE_EBR_BATCH_SIZE);
+  }
+  EXPECT_GT(freed_count.load(), 0u);
+
+  drain();
+  EXPECT_EQ(freed_count.load(), static_cast<se_usize_t>(kCount));
+}
+
+TEST(se_ebr_enter, blocks_reclamation_until_leave) {
+  drain();
+  freed_count = 0;
+
+  std::atomic<int> stage{0};
+  std::thread reader([&] {
+    se_ebr_enter();
+    stage = 1;
+    while (stage.load() != 2) {
+      std::this_thread::yield();
+    }
+    se_ebr_leave();
+    se_ebr_thread_detach();
+  });
+  while (stage.load() != 1) {
+    std::this_thread::yield();
+  }
+
+  se_ebr_retire(make_node(), counting_dealloc);
+  for (int i = 0; i < 10; ++i) {
+    se_ebr_collect();
+  }
+  EXPECT_EQ(freed_count.load(), 0u);
+
+  stage = 2;
+  reader.join();
+  drain();
+  EXPECT_EQ(freed_count.load(), 1u);
+}
+
+TEST(se_ebr_enter, nests) {
+  drain();
+  freed_count = 0;
+
+  se_ebr_enter();
+  se_ebr_enter();
+  se_ebr_leave();
+  se_ebr_retire(make_node(), counting_dealloc);
+  se_ebr_leave();
+
+  drain();
+  EXPECT_EQ(freed_count.load(), 1u);
+}
+
+TEST(se_ebr_leave, rejects_unbalanced_leave) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  EXPECT_DEATH(se_ebr_leave(), ".*");
+}
+
+TEST(se_ebr_protect, keeps_protected_node) {
+  drain();
+  freed_count = 0;
+
+  void *node = make_node();
+  se_atomic_ptr_t source;
+  se_atomic_ptr_store(&source, node, SE_ATOMIC_ORDER_RELAXED);
+
+  EXPECT_EQ(se_ebr_protect(1, &source), node);
+  se_atomic_ptr_store(&source, nullptr, SE_ATOMIC_ORDER_RELAXED);
+  se_ebr_retire_protected(node, counting_dealloc);
+
+  se_ebr_collect();
+  EXPECT_EQ(freed_count.load(), 0u);
+  EXPECT_EQ(se_ebr_get_pending(), 1u);
+
+  se_ebr_clear(1);
+  EXPECT_EQ(se_ebr_collect(), 1u);
+  EXPECT_EQ(freed_count.load(), 1u);
+}
+
+TEST(se_ebr_protect, rejects_bad_slot) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
+  se_atomic_ptr_t source;
+  se_atomic_ptr_store(&source, nullptr, SE_ATOMIC_ORDER_RELAXED);
+  EXPECT_DEATH(se_ebr_protect(SE_EBR_HAZARD_COUNT, &source), ".*");
+}
+
+TEST(se_ebr_retire_protected, bounds_pending_nodes) {
+  drain();
+  freed_count = 0;
+
+  constexpr int kCount = 10000;
+  se_usize_t peak = 0;
+  for (int i = 0; i < kCount; ++i) {
+    se_ebr_retire_protected(make_node(), counting_dealloc);
+    peak = std::max(peak, se_ebr_get_pending());
+  }
+  EXPECT_LT(peak, static_cast<se_usize_t>(kCount / 10));
+
+  se_ebr_collect();
+  EXPECT_EQ(freed_count.load(), static_cast<se_usize_t>(kCount));
+}
+
+TEST(se_ebr_retire, stack_stress) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 20000;
+
+  drain();
+  freed_count = 0;
+
+  se_atomic_ptr_t head;
+  se_atomic_ptr_store(&head, nullptr, SE_ATOMIC_ORDER_RELAXED);
+
+  std::atomic<int> popped{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kIterations; ++i) {
+        auto *node = static_cast<node_t *>(make_node());
+        node->value = t;
+        push(&head, node);
+
+        se_ebr_enter();
+        auto *top = static_cast<node_t *>(se_atomic_ptr_load(&head, SE_ATOMIC_ORDER_ACQUIRE));
+        void *expected = top;
+        while (top && !se_atomic_ptr_compare_exchange_weak(&head, &expected, top->next, SE_ATOMIC_ORDER_ACQUIRE,
+                                                           SE_ATOMIC_ORDER_ACQUIRE)) {
+          top = static_cast<node_t *>(expected);
+        }
+        se_ebr_leave();
+
+        if (top) {
+          EXPECT_LT(top->value, kThreads);
+          se_ebr_retire(top, counting_dealloc);
+          popped.fetch_add(1);
+        }
+      }
+      drain();
+      se_ebr_thread_detach();
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (auto *node = static_cast<node_t *>(se_atomic_ptr_load(&head, SE_ATOMIC_ORDER_RELAXED)); node;) {
+    node_t *next = node->next;
+    se_runtime_allocator_dealloc(node);
+    node = next;
+  }
+  EXPECT_EQ(freed_count.load(), static_cast<se_usize_t>(popped.load()));
+}
+
+TEST(se_ebr_retire_protected, stack_stress) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 20000;
+
+  drain();
+  freed_count = 0;
+
+  se_atomic_ptr_t head;
+  se_atomic_ptr_store(&head, nullptr, SE_ATOMIC_ORDER_RELAXED);
+
+  std::atomic<int> popped{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < kIterations; ++i) {
+        auto *node = static_cast<node_t *>(make_node());
+        node->value = t;
+        push(&head, node);
+
+        node_t *top;
+        for (;;) {
+          top = static_cast<node_t *>(se_ebr_protect(0, &head));
+          void *expected = top;
+          if (!top || se_atomic_ptr_compare_exchange_strong(&head, &expected, top->next, SE_ATOMIC_ORDER_ACQUIRE,
+                                                            SE_ATOMIC_ORDER_ACQUIRE)) {
+            break;
+          }
+        }
+        se_ebr_clear(0);
+
+        if (top) {
+          EXPECT_LT(top->value, kThreads);
+          se_ebr_retire_protected(top, counting_dealloc);
+          popped.fetch_add(1);
+        }
+      }
+      drain();
+      se_ebr_thread_detach();
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (auto *node = static_cast<node_t *>(se_atomic_ptr_load(&head, SE_ATOMIC_ORDER_RELAXED)); node;) {
+    node_t *next = node->next;
+    se_runtime_allocator_dealloc(node);
+    node = next;
+  }
+  EXPECT_EQ(freed_count.load(), static_cast<se_usize_t>(popped.load()));
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+#include <se/hash.h>
+#include <se/hash_map.h>
+#include <se/runtime_check.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <set>
+#include <unordered_map>
+
+namespace {
+
+se_u64_t constant_hash(const void *, se_usize_t) { return 42; }
+
+struct name_key {
+  const char *name;
+};
+
+se_u64_t name_hash(const void *key, se_usize_t) {
+  const char *name = static_cast<const name_key *>(key)->name;
+  return se_hash_bytes(name, std::strlen(name));
+}
+
+int name_equal(const void *lhs, const void *rhs, se_usize_t) {
+  return std::strcmp(static_cast<const name_key *>(lhs)->name,
+                     static_cast<const name_key *>(rhs)->name) == 0;
+}
+
+} // namespace
+
+TEST(se_hash_bytes, depends_on_every_byte) {
+  std::set<se_u64_t> hashes;
+  unsigned char data[64] = {};
+
+  for (se_usize_t size = 0; size <= sizeof(data); ++size) {
+    hashes.insert(se_hash_bytes(data, size));
+  }
+  for (se_usize_t i = 0; i < sizeof(data); ++i) {
+    data[i] = 1;
+    hashes.insert(se_hash_bytes(data, sizeof(data)));
+    data[i] = 0;
+  }
+
+  EXPECT_EQ(hashes.size(), 2 * sizeof(data) + 1);
+  EXPECT_EQ(se_hash_bytes(data, 7), se_hash_bytes(data, 7));
+  EXPECT_EQ(se_hash_bytes(nullptr, 0), se_hash_bytes(data, 0));
+}
+
+TEST(se_hash_map_init, zero_key_size) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  se_hash_map_t map;
+  EXPECT_DEATH(se_hash_map_init(&map, 0, 4, nullptr, nullptr, nullptr), ".*");
+}
+
+TEST(se_hash_map_insert, find_replace_erase) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(int), sizeof(double), nullptr, nullptr, nullptr);
+  const int missing = -1;
+  EXPECT_EQ(se_hash_map_find(&map, &missing), nullptr);
+
+  for (int i = 0; i < 1000; ++i) {
+    const double value = i * 0.5;
+    se_hash_map_insert(&map, &i, &value);
+  }
+  EXPECT_EQ(se_hash_map_get_size(&map), 1000u);
+
+  for (int i = 0; i < 1000; ++i) {
+    const double *value = static_cast<const double *>(se_hash_map_find(&map, &i));
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, i * 0.5);
+  }
+
+  const int key = 10;
+  const double replaced = -1.0;
+  se_hash_map_insert(&map, &key, &replaced);
+  EXPECT_EQ(*static_cast<double *>(se_hash_map_find(&map, &key)), -1.0);
+  EXPECT_EQ(se_hash_map_get_size(&map), 1000u);
+
+  EXPECT_TRUE(se_hash_map_erase(&map, &key));
+  EXPECT_FALSE(se_hash_map_erase(&map, &key));
+  EXPECT_EQ(se_hash_map_find(&map, &key), nullptr);
+  EXPECT_EQ(se_hash_map_get_size(&map), 999u);
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_emplace, reports_insertion) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(std::uint64_t), sizeof(int), nullptr, nullptr, nullptr);
+
+  const std::uint64_t key = 7;
+  void *value = nullptr;
+
+  EXPECT_TRUE(se_hash_map_emplace(&map, &key, &value));
+  *static_cast<int *>(value) = 1;
+
+  EXPECT_FALSE(se_hash_map_emplace(&map, &key, &value));
+  ++*static_cast<int *>(value);
+  EXPECT_EQ(*static_cast<int *>(se_hash_map_find(&map, &key)), 2);
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_erase, random_operations_match_std) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(std::uint32_t), sizeof(std::uint32_t), nullptr, nullptr, nullptr);
+  std::unordered_map<std::uint32_t, std::uint32_t> expected;
+
+  std::mt19937 random(1);
+  for (int i = 0; i < 200000; ++i) {
+    const std::uint32_t key = random() % 5000;
+    if (random() % 3) {
+      se_hash_map_insert(&map, &key, &i);
+      expected[key] = static_cast<std::uint32_t>(i);
+    } else {
+      EXPECT_EQ(se_hash_map_erase(&map, &key), expected.erase(key) == 1);
+    }
+  }
+
+  ASSERT_EQ(se_hash_map_get_size(&map), expected.size());
+  for (const auto &[key, value] : expected) {
+    const auto *found = static_cast<const std::uint32_t *>(se_hash_map_find(&map, &key));
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(*found, value);
+  }
+
+  // Churn reuses slots instead of growing the table
+  EXPECT_LE(se_hash_map_get_capacity(&map), 16384u);
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_find, full_collisions) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(int), 0, constant_hash, nullptr, nullptr);
+
+  for (int i = 0; i < 300; ++i) {
+    se_hash_map_insert(&map, &i, nullptr);
+  }
+  for (int i = 0; i < 300; i += 2) {
+    EXPECT_TRUE(se_hash_map_erase(&map, &i));
+  }
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(se_hash_map_find(&map, &i) != nullptr, i % 2 == 1);
+  }
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_find, unaligned_keys) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(std::uint64_t), 0, nullptr, nullptr, nullptr);
+
+  // Keys are passed from odd offsets of a byte buffer
+  unsigned char buffer[sizeof(std::uint64_t) + 1];
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    std::memcpy(buffer + 1, &i, sizeof(i));
+    se_hash_map_insert(&map, buffer + 1, nullptr);
+  }
+  for (std::uint64_t i = 0; i < 200; ++i) {
+    std::memcpy(buffer + 1, &i, sizeof(i));
+    EXPECT_EQ(se_hash_map_find(&map, buffer + 1) != nullptr, i < 100);
+  }
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_find, custom_equality) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(name_key), sizeof(int), name_hash, name_equal, nullptr);
+
+  char stored[] = "alpha";
+  const name_key key = {stored};
+  const int value = 1;
+  se_hash_map_insert(&map, &key, &value);
+
+  const char lookup[] = "alpha";
+  const name_key other = {lookup};
+  EXPECT_NE(se_hash_map_find(&map, &other), nullptr);
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_reserve, no_rehash_within_reservation) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(int), sizeof(int), nullptr, nullptr, nullptr);
+  se_hash_map_reserve(&map, 1000);
+
+  const se_usize_t capacity = se_hash_map_get_capacity(&map);
+  EXPECT_GE(capacity - capacity / 8, 1000u);
+
+  for (int i = 0; i < 1000; ++i) {
+    se_hash_map_insert(&map, &i, &i);
+  }
+  EXPECT_EQ(se_hash_map_get_capacity(&map), capacity);
+
+  se_hash_map_clear(&map);
+  EXPECT_EQ(se_hash_map_get_size(&map), 0u);
+  EXPECT_EQ(se_hash_map_get_capacity(&map), capacity);
+
+  se_hash_map_deinit(&map);
+}
+
+TEST(se_hash_map_next, visits_every_element) {
+  se_hash_map_t map;
+  se_hash_map_init(&map, sizeof(int), sizeof(int), nullptr, nullptr, nullptr);
+
+  for (int i = 0; i < 100; ++i) {
+    const int square = i * i;
+    se_hash_map_insert(&map, &i, &square);
+  }
+
+  std::set<int> seen;
+  se_usize_t cursor = 0;
+  const void *key;
+  void *value;
+  while (se_hash_map_next(&map, &cursor, &key, &value)) {
+    const int k = *static_cast<const int *>(key);
+    EXPECT_EQ(*static_cast<int *>(value), k * k);
+    seen.insert(k);
+  }
+  EXPECT_EQ(seen.size(), 100u);
+
+  se_hash_map_deinit(&map);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <se/latch.h>
+#include <se/atomic.h>
+#include <se/runtime_check.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(se_latch_count_down, opens_at_zero) {
+  se_latch_t latch;
+  se_latch_init(&latch, 3, nullptr);
+
+  EXPECT_FALSE(se_latch_try_wait(&latch));
+  se_latch_count_down(&latch, 2);
+  EXPECT_FALSE(se_latch_try_wait(&latch));
+  se_latch_count_down(&latch, 1);
+  EXPECT_TRUE(se_latch_try_wait(&latch));
+
+  // Stays open
+  se_latch_wait(&latch);
+}
+
+TEST(se_latch_count_down, rejects_underflow) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
+  se_latch_t latch;
+  se_latch_init(&latch, 1, nullptr);
+  EXPECT_DEATH(se_latch_count_down(&latch, 2), ".*");
+}
+
+TEST(se_latch_wait, releases_sleeping_waiters) {
+  constexpr int kWaiters = 3;
+
+  se_lock_stats_t stats = {};
+  se_latch_t latch;
+  se_latch_init(&latch, 1, &stats);
+
+  int payload = 0;
+  std::atomic<int> seen{0};
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWaiters; ++w) {
+    threads.emplace_back([&] {
+      se_latch_wait(&latch);
+      seen.fetch_add(payload);
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  payload = 1;
+  se_latch_count_down(&latch, 1);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(seen.load(), kWaiters);
+  EXPECT_EQ(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), static_cast<se_u64_t>(kWaiters));
+  EXPECT_GE(se_atomic_u64_load(&stats.wait_count, SE_ATOMIC_ORDER_RELAXED), static_cast<se_u64_t>(kWaiters));
+}
+
+TEST(se_latch_arrive_and_wait, meets_all_threads) {
+  constexpr int kThreads = 4;
+
+  se_latch_t latch;
+  se_latch_init(&latch, kThreads, nullptr);
+
+  std::atomic<int> before{0};
+  std::atomic<int> early{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      before.fetch_add(1);
+      se_latch_arrive_and_wait(&latch, 1);
+      if (before.load() != kThreads) {
+        early.fetch_add(1);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(early.load(), 0);
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <se/mcs_lock.h>
+#include <se/atomic.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(se_mcs_lock_try_lock, fails_while_locked) {
+  se_mcs_lock_t lock;
+  se_mcs_lock_init(&lock, nullptr);
+
+  se_mcs_lock_node_t first;
+  se_mcs_lock_node_t second;
+  EXPECT_TRUE(se_mcs_lock_try_lock(&lock, &first));
+  EXPECT_FALSE(se_mcs_lock_try_lock(&lock, &second));
+  se_mcs_lock_unlock(&lock, &first);
+  EXPECT_TRUE(se_mcs_lock_try_lock(&lock, &second));
+  se_mcs_lock_unlock(&lock, &second);
+}
+
+TEST(se_mcs_lock_lock, serializes_threads) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 20000;
+
+  se_mcs_lock_t lock;
+  se_mcs_lock_init(&lock, nullptr);
+
+  long counter = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations; ++i) {
+        se_mcs_lock_node_t node;
+        se_mcs_lock_lock(&lock, &node);
+        ++counter;
+        se_mcs_lock_unlock(&lock, &node);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(counter, static_cast<long>(kThreads) * kIterations);
+}
+
+TEST(se_mcs_lock_lock, grants_in_arrival_order) {
+  se_lock_stats_t stats = {};
+  se_mcs_lock_t lock;
+  se_mcs_lock_init(&lock, &stats);
+
+  se_mcs_lock_node_t owner;
+  se_mcs_lock_lock(&lock, &owner);
+
+  // Queue the waiters one at a time; each sleeps before the next arrives
+  constexpr int kWaiters = 3;
+  std::vector<int> order;
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWaiters; ++w) {
+    threads.emplace_back([&, w] {
+      se_mcs_lock_node_t node;
+      se_mcs_lock_lock(&lock, &node);
+      order.push_back(w);
+      se_mcs_lock_unlock(&lock, &node);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  se_mcs_lock_unlock(&lock, &owner);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), static_cast<se_u64_t>(kWaiters));
+  EXPECT_GE(se_atomic_u64_load(&stats.wait_count, SE_ATOMIC_ORDER_RELAXED), static_cast<se_u64_t>(kWaiters));
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <se/memory.h>
+#include <se/runtime_error_code.h>
+#include <se/runtime_check.h>
+
+#include <cstring>
+
+TEST(se_memory_copy_r, copies_min_size) {
+  char src[8] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  char dst[4] = {};
+  se_error_t error = {};
+  EXPECT_NE(se_memory_copy_r(dst, sizeof(dst), src, sizeof(src), &error), nullptr);
+  EXPECT_EQ(std::memcmp(dst, "abcd", 4), 0);
+  EXPECT_TRUE(se_error_is_ok(&error));
+}
+
+TEST(se_memory_copy_r, reports_null_pointer) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
+  char dst[4] = {};
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_copy_r(dst, sizeof(dst), nullptr, 4, &error), nullptr);
+  EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_NULL_POINTER);
+}
+
+TEST(se_memory_copy_rev_r, copies_min_size) {
+  char src[4] = {'a', 'b', 'c', 'd'};
+  char dst[4] = {};
+  se_error_t error = {};
+  EXPECT_NE(se_memory_copy_rev_r(dst, sizeof(dst), src, sizeof(src), &error), nullptr);
+  EXPECT_EQ(std::memcmp(dst, src, 4), 0);
+  EXPECT_TRUE(se_error_is_ok(&error));
+}
+
+TEST(se_memory_move_r, handles_overlap) {
+  char buffer[8] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  se_error_t error = {};
+  EXPECT_NE(se_memory_move_r(buffer + 2, 6, buffer, 6, &error), nullptr);
+  EXPECT_EQ(std::memcmp(buffer, "ababcdef", 8), 0);
+  EXPECT_TRUE(se_error_is_ok(&error));
+}
+
+TEST(se_memory_compare_r, distinguishes_equal_from_error) {
+  const char lhs[4] = {'a', 'b', 'c', 'd'};
+  const char rhs[4] = {'a', 'b', 'x', 'd'};
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_compare_r(lhs, 4, rhs, 4, &error), lhs + 2);
+  EXPECT_EQ(se_memory_compare_r(lhs, 2, rhs, 2, &error), nullptr);
+  EXPECT_TRUE(se_error_is_ok(&error));
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    EXPECT_EQ(se_memory_compare_r(lhs, 4, nullptr, 4, &error), nullptr);
+    EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_NULL_POINTER);
+  }
+}
+
+TEST(se_memory_set_r, fills_and_reports_null_pointer) {
+  unsigned char dst[16] = {};
+  se_error_t error = {};
+  EXPECT_NE(se_memory_set_r(dst, sizeof(dst), 0x5a, &error), nullptr);
+  for (unsigned char byte : dst) {
+    EXPECT_EQ(byte, 0x5a);
+  }
+  EXPECT_TRUE(se_error_is_ok(&error));
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    EXPECT_EQ(se_memory_set_r(nullptr, 4, 0, nullptr), nullptr);
+    EXPECT_EQ(se_memory_set_r(nullptr, 4, 0, &error), nullptr);
+    EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_NULL_POINTER);
+  }
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <se/memory_arena.h>
+#include <se/runtime_try.h>
+#include <se/runtime_error_code.h>
+#include <se/addr.h>
+#include <se/runtime_check.h>
+
+TEST(se_memory_arena_init, null_pointer) {
+  unsigned char buffer[64];
+  EXPECT_DEATH(se_memory_arena_init(nullptr, buffer, sizeof(buffer)), ".*");
+}
+
+TEST(se_memory_arena_init, empty_arena) {
+  unsigned char buffer[64];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  EXPECT_EQ(se_memory_arena_get_used(&arena), 0u);
+  EXPECT_EQ(se_memory_arena_get_available(&arena), sizeof(buffer));
+}
+
+TEST(se_memory_arena_alloc, sequential_blocks) {
+  alignas(16) unsigned char buffer[128];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  void *a = se_memory_arena_alloc(&arena, 10);
+  void *b = se_memory_arena_alloc(&arena, 10);
+
+  EXPECT_EQ(a, buffer);
+  EXPECT_GT(b, a);
+  EXPECT_EQ(reinterpret_cast<se_uaddr_t>(b) % SE_MEMORY_ARENA_ALIGNMENT, 0u);
+}
+
+TEST(se_memory_arena_alloc, zero_filled) {
+#ifndef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+  GTEST_SKIP() << "SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE is OFF";
+#endif
+  unsigned char buffer[64];
+  memset(buffer, 0xAA, sizeof(buffer));
+
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  const auto *p = static_cast<const unsigned char *>(se_memory_arena_alloc(&arena, 16));
+  for (int i = 0; i < 16; ++i) {
+    EXPECT_EQ(p[i], 0);
+  }
+}
+
+TEST(se_memory_arena_alloc_aligned, cache_line) {
+  unsigned char buffer[256];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  se_memory_arena_alloc(&arena, 1);
+  void *p = se_memory_arena_alloc_aligned(&arena, 8, 64);
+  EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % 64, 0u);
+}
+
+TEST(se_memory_arena_alloc_aligned, invalid_alignment) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  unsigned char buffer[64];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  EXPECT_DEATH(se_memory_arena_alloc_aligned(&arena, 8, 3), ".*");
+}
+
+TEST(se_memory_arena_alloc, exhausted) {
+  unsigned char buffer[32];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  EXPECT_DEATH(se_memory_arena_alloc(&arena, 64), ".*");
+}
+
+TEST(se_memory_arena_rewind, releases_blocks) {
+  unsigned char buffer[128];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  se_memory_arena_alloc(&arena, 16);
+  se_memory_arena_mark_t mark = se_memory_arena_get_mark(&arena);
+
+  se_memory_arena_alloc(&arena, 32);
+  se_memory_arena_alloc(&arena, 32);
+  se_memory_arena_rewind(&arena, mark);
+
+  EXPECT_EQ(se_memory_arena_get_used(&arena), 16u);
+}
+
+TEST(se_memory_arena_rewind, invalid_mark) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
+  unsigned char buffer[64];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  EXPECT_DEATH(se_memory_arena_rewind(&arena, buffer + 32), ".*");
+}
+
+TEST(se_memory_arena_reset, releases_all) {
+  unsigned char buffer[64];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  se_memory_arena_alloc(&arena, 32);
+  se_memory_arena_reset(&arena);
+
+  EXPECT_EQ(se_memory_arena_get_available(&arena), sizeof(buffer));
+}
+
+TEST(se_runtime_try_with_arena, rewinds_on_throw) {
+  unsigned char buffer[256];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+  se_memory_arena_alloc(&arena, 16);
+
+  bool caught = false;
+  se_runtime_try_with_arena(frame, &arena) {
+    se_memory_arena_alloc(&arena, 64);
+    se_memory_arena_alloc(&arena, 1024);
+    se_runtime_try_finalize();
+  }
+  else {
+    caught = true;
+  }
+
+  EXPECT_TRUE(caught);
+  EXPECT_EQ(se_error_get_code(&frame.exception.err), SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+  EXPECT_EQ(se_memory_arena_get_used(&arena), 16u);
+}
+
+TEST(se_runtime_try_with_arena, keeps_blocks_on_success) {
+  unsigned char buffer[256];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  se_runtime_try_with_arena(frame, &arena) {
+    se_memory_arena_alloc(&arena, 64);
+    se_runtime_try_finalize();
+  }
+
+  EXPECT_EQ(se_memory_arena_get_used(&arena), 64u);
+}
+
+TEST(se_runtime_try_with_arena, evaluates_arena_once) {
+  unsigned char buffer[256];
+  se_memory_arena_t arena;
+  se_memory_arena_init(&arena, buffer, sizeof(buffer));
+
+  int calls = 0;
+  auto get_arena = [&] {
+    ++calls;
+    return &arena;
+  };
+  se_runtime_try_with_arena(frame, get_arena()) {
+    se_runtime_try_finalize();
+  }
+
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(frame_arena, &arena);
+}
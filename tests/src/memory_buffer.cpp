@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <se/memory_buffer.h>
+#include <se/memory_page.h>
+
+#include <cstring>
+#include <vector>
+
+TEST(se_memory_buffer_init, empty) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+  EXPECT_EQ(se_memory_buffer_get_size(&buffer), 0u);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), 0u);
+  EXPECT_EQ(se_memory_buffer_get_data(&buffer), nullptr);
+
+  const se_memory_view_t view = se_memory_buffer_get_view(&buffer);
+  EXPECT_TRUE(se_memory_view_is_empty(&view));
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_append, geometric_growth) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+
+  se_memory_buffer_append(&buffer, "a", 1);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), se_usize_t{SE_MEMORY_BUFFER_MIN_CAPACITY});
+
+  se_memory_buffer_append(&buffer, std::vector<char>(SE_MEMORY_BUFFER_MIN_CAPACITY, 'b').data(),
+                          SE_MEMORY_BUFFER_MIN_CAPACITY);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer),
+            se_usize_t{SE_MEMORY_BUFFER_MIN_CAPACITY} * SE_DYNAMIC_BLOCK_GROWTH_FACTOR / 1000);
+  EXPECT_EQ(se_memory_buffer_get_size(&buffer), SE_MEMORY_BUFFER_MIN_CAPACITY + 1u);
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_append, content_survives_paged_growth) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+
+  // Crosses the threshold and keeps growing through page remapping
+  constexpr std::size_t kChunks = 4 * SE_MEMORY_BUFFER_PAGED_THRESHOLD / 100;
+  char chunk[100];
+  for (std::size_t i = 0; i < kChunks; ++i) {
+    std::memset(chunk, static_cast<int>(i % 251), sizeof(chunk));
+    se_memory_buffer_append(&buffer, chunk, sizeof(chunk));
+  }
+
+  ASSERT_EQ(se_memory_buffer_get_size(&buffer), kChunks * sizeof(chunk));
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer) % se_memory_page_get_size(), 0u);
+
+  const auto *data = static_cast<const unsigned char *>(se_memory_buffer_get_data(&buffer));
+  for (std::size_t i = 0; i < kChunks; ++i) {
+    ASSERT_EQ(data[i * sizeof(chunk)], i % 251);
+    ASSERT_EQ(data[i * sizeof(chunk) + sizeof(chunk) - 1], i % 251);
+  }
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_append, from_own_content) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+  se_memory_buffer_append(&buffer, "abcd", 4);
+  se_memory_buffer_shrink_to_fit(&buffer);
+
+  // Every append reallocates while reading from the old storage
+  for (int i = 0; i < 12; ++i) {
+    se_memory_buffer_append(&buffer, se_memory_buffer_get_data(&buffer), se_memory_buffer_get_size(&buffer));
+  }
+
+  ASSERT_EQ(se_memory_buffer_get_size(&buffer), std::size_t{4} << 12);
+  const auto *data = static_cast<const char *>(se_memory_buffer_get_data(&buffer));
+  for (std::size_t i = 0; i < se_memory_buffer_get_size(&buffer); ++i) {
+    ASSERT_EQ(data[i], "abcd"[i % 4]);
+  }
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_reserve, exact_capacity) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+
+  se_memory_buffer_reserve(&buffer, 1000);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), 1000u);
+
+  // Smaller requests never shrink the buffer
+  se_memory_buffer_reserve(&buffer, 10);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), 1000u);
+
+  se_memory_buffer_reserve(&buffer, SE_MEMORY_BUFFER_PAGED_THRESHOLD + 1);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer) % se_memory_page_get_size(), 0u);
+  EXPECT_GT(se_memory_buffer_get_capacity(&buffer), se_usize_t{SE_MEMORY_BUFFER_PAGED_THRESHOLD});
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_shrink_to_fit, back_from_pages) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+
+  auto *p = static_cast<char *>(se_memory_buffer_extend(&buffer, 2 * SE_MEMORY_BUFFER_PAGED_THRESHOLD));
+  std::memset(p, 'x', 2 * SE_MEMORY_BUFFER_PAGED_THRESHOLD);
+
+  se_memory_buffer_clear(&buffer);
+  se_memory_buffer_append(&buffer, "hello", 5);
+  se_memory_buffer_shrink_to_fit(&buffer);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), 5u);
+  EXPECT_EQ(std::memcmp(se_memory_buffer_get_data(&buffer), "hello", 5), 0);
+
+  se_memory_buffer_clear(&buffer);
+  se_memory_buffer_shrink_to_fit(&buffer);
+  EXPECT_EQ(se_memory_buffer_get_capacity(&buffer), 0u);
+  EXPECT_EQ(se_memory_buffer_get_data(&buffer), nullptr);
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_get_view, covers_content) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+  se_memory_buffer_append(&buffer, "abcdef", 6);
+
+  const se_memory_view_t view = se_memory_buffer_get_view(&buffer);
+  EXPECT_EQ(se_memory_view_get_size(&view), 6u);
+  EXPECT_EQ(view.begin, se_memory_buffer_get_data(&buffer));
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_get_view, empty_buffer) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+
+  se_memory_view_t view = se_memory_buffer_get_view(&buffer);
+  EXPECT_TRUE(se_memory_view_is_valid(&view));
+  EXPECT_EQ(se_memory_view_get_size(&view), 0u);
+
+  se_memory_buffer_append(&buffer, "abc", 3);
+  se_memory_buffer_clear(&buffer);
+  view = se_memory_buffer_get_view(&buffer);
+  EXPECT_EQ(se_memory_view_get_size(&view), 0u);
+  EXPECT_EQ(view.begin, se_memory_buffer_get_data(&buffer));
+
+  se_memory_buffer_deinit(&buffer);
+}
+
+TEST(se_memory_buffer_append, null_data) {
+  se_memory_buffer_t buffer;
+  se_memory_buffer_init(&buffer);
+  se_memory_buffer_append(&buffer, nullptr, 0);
+  EXPECT_DEATH(se_memory_buffer_append(&buffer, nullptr, 1), ".*");
+  se_memory_buffer_deinit(&buffer);
+}
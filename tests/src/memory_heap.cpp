@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <se/memory_heap.h>
+#include <se/runtime_allocator.h>
+#include <se/addr.h>
+
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST(se_memory_heap_alloc, size_classes) {
+  for (se_usize_t size = 0; size <= SE_MEMORY_HEAP_SMALL_MAX; size += 7) {
+    void *p = se_memory_heap_alloc(size);
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % SE_MEMORY_HEAP_ALIGNMENT, 0u);
+    EXPECT_GE(se_memory_heap_get_size(p), size);
+    memset(p, 0xAB, size);
+    se_memory_heap_dealloc(p);
+  }
+}
+
+TEST(se_memory_heap_alloc, class_bounds) {
+  void *p = se_memory_heap_alloc(129);
+  EXPECT_EQ(se_memory_heap_get_size(p), 160u);
+  se_memory_heap_dealloc(p);
+
+  p = se_memory_heap_alloc(SE_MEMORY_HEAP_SMALL_MAX);
+  EXPECT_EQ(se_memory_heap_get_size(p), se_usize_t{SE_MEMORY_HEAP_SMALL_MAX});
+  se_memory_heap_dealloc(p);
+}
+
+TEST(se_memory_heap_alloc, distinct_blocks) {
+  std::set<void *> seen;
+  std::vector<void *> blocks;
+  for (int i = 0; i < 10000; ++i) {
+    void *p = se_memory_heap_alloc(48);
+    EXPECT_TRUE(seen.insert(p).second);
+    blocks.push_back(p);
+  }
+  for (void *p : blocks) {
+    se_memory_heap_dealloc(p);
+  }
+}
+
+TEST(se_memory_heap_alloc, reuses_freed_block) {
+  void *a = se_memory_heap_alloc(64);
+  se_memory_heap_dealloc(a);
+  EXPECT_EQ(se_memory_heap_alloc(64), a);
+  se_memory_heap_dealloc(a);
+}
+
+TEST(se_memory_heap_alloc, large_block) {
+  const se_usize_t size = 1 << 20;
+  auto *p = static_cast<unsigned char *>(se_memory_heap_alloc(size));
+  ASSERT_NE(p, nullptr);
+  EXPECT_GE(se_memory_heap_get_size(p), size);
+  p[0] = 1;
+  p[size - 1] = 2;
+  se_memory_heap_dealloc(p);
+}
+
+TEST(se_memory_heap_dealloc, null_pointer) {
+  se_memory_heap_dealloc(nullptr);
+}
+
+TEST(se_memory_heap_dealloc, cross_thread) {
+  constexpr int kThreads = 4;
+  constexpr int kBlocks = 20000;
+
+  std::vector<std::vector<void *>> blocks(kThreads);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&, t] {
+      for (int i = 0; i < kBlocks; ++i) {
+        const se_usize_t size = 16 + (i % 64) * 16;
+        auto *p = static_cast<unsigned char *>(se_memory_heap_alloc(size));
+        memset(p, t, size);
+        blocks[t].push_back(p);
+      }
+      se_memory_heap_thread_flush();
+    });
+  }
+  for (auto &thread : producers) {
+    thread.join();
+  }
+
+  // Every block is released by a thread other than its owner
+  std::vector<std::thread> consumers;
+  for (int t = 0; t < kThreads; ++t) {
+    consumers.emplace_back([&, t] {
+      for (void *p : blocks[(t + 1) % kThreads]) {
+        EXPECT_EQ(*static_cast<unsigned char *>(p), (t + 1) % kThreads);
+        se_memory_heap_dealloc(p);
+      }
+      se_memory_heap_thread_flush();
+    });
+  }
+  for (auto &thread : consumers) {
+    thread.join();
+  }
+}
+
+TEST(se_memory_heap_thread_flush, runs_at_thread_exit) {
+  constexpr se_usize_t kSize = 4096;
+  constexpr int kAttempts = 1024;
+
+  // The thread exits with the object in its magazine and no explicit flush
+  void *cached = nullptr;
+  std::thread([&] {
+    cached = se_memory_heap_alloc(kSize);
+    se_memory_heap_dealloc(cached);
+  }).join();
+
+  std::vector<void *> blocks;
+  bool found = false;
+  for (int i = 0; i < kAttempts && !found; ++i) {
+    blocks.push_back(se_memory_heap_alloc(kSize));
+    found = blocks.back() == cached;
+  }
+  for (void *p : blocks) {
+    se_memory_heap_dealloc(p);
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST(se_memory_heap_get_allocator, runtime_allocator) {
+  const se_memory_allocator_t previous = se_runtime_allocator_set(se_memory_heap_get_allocator());
+
+  // The runtime allocator may keep a header in front of the block
+  // (SE_LIBRARY_OPTION_ALLOC_STATS), so only a lower bound is checked
+  void *p = se_runtime_allocator_alloc(100);
+  EXPECT_GE(se_memory_heap_get_size(p), 100u);
+  se_runtime_allocator_dealloc(p);
+
+  se_runtime_allocator_set(&previous);
+}
+
+TEST(se_memory_heap_alloc_aligned, small_classes) {
+  for (se_usize_t alignment : {32u, 64u}) {
+    for (se_usize_t size = 1; size <= 2048; size += 37) {
+      void *p = se_memory_heap_alloc_aligned(size, alignment);
+      ASSERT_NE(p, nullptr);
+      EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % alignment, 0u);
+      EXPECT_GE(se_memory_heap_get_size(p), size);
+      se_memory_heap_dealloc(p);
+    }
+  }
+}
+
+TEST(se_memory_heap_alloc_aligned, page_alignment) {
+  for (se_usize_t size : {se_usize_t{100}, se_usize_t{1} << 20}) {
+    auto *p = static_cast<unsigned char *>(se_memory_heap_alloc_aligned(size, 4096));
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % 4096, 0u);
+    EXPECT_GE(se_memory_heap_get_size(p), size);
+    p[size - 1] = 1;
+    se_memory_heap_dealloc(p);
+  }
+}
+
+TEST(se_memory_heap_alloc_aligned, invalid_alignment) {
+  EXPECT_EQ(se_memory_heap_alloc_aligned(64, 48), nullptr);
+  EXPECT_EQ(se_memory_heap_alloc_aligned(64, SE_MEMORY_HEAP_SPAN_SIZE), nullptr);
+}
+
+TEST(se_memory_heap_alloc_with_flags, page_flags) {
+  const se_u32_t all_flags[] = {SE_MEMORY_PAGE_FLAG_POPULATE, SE_MEMORY_PAGE_FLAG_LAZY, SE_MEMORY_PAGE_FLAG_HUGE,
+                                SE_MEMORY_PAGE_FLAG_HUGE | SE_MEMORY_PAGE_FLAG_POPULATE};
+  for (se_u32_t flags : all_flags) {
+    const se_usize_t size = 3 << 20;
+    auto *p = static_cast<unsigned char *>(se_memory_heap_alloc_with_flags(size, 64, flags));
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % 64, 0u);
+    EXPECT_EQ(p[0], 0);
+    EXPECT_EQ(p[size - 1], 0);
+    p[size - 1] = 1;
+    se_memory_heap_dealloc(p);
+  }
+}
+
+TEST(se_memory_heap_set_huge_threshold, round_trip) {
+  const se_usize_t previous = se_memory_heap_set_huge_threshold(1 << 20);
+  EXPECT_EQ(previous, se_usize_t{SE_MEMORY_HEAP_HUGE_THRESHOLD});
+  EXPECT_EQ(se_memory_heap_get_huge_threshold(), se_usize_t{1} << 20);
+
+  // Huge blocks are rounded up to whole huge pages
+  void *p = se_memory_heap_alloc(1 << 20);
+  EXPECT_GE(se_memory_heap_get_size(p), se_memory_page_get_huge_size() - 64);
+  se_memory_heap_dealloc(p);
+
+  se_memory_heap_set_huge_threshold(previous);
+}
+
+TEST(se_memory_heap_alloc_zeroed, recycled_object) {
+  auto *p = static_cast<unsigned char *>(se_memory_heap_alloc(200));
+  memset(p, 0xAA, 200);
+  se_memory_heap_dealloc(p);
+
+  auto *q = static_cast<unsigned char *>(se_memory_heap_alloc_zeroed(200, 0));
+  ASSERT_EQ(q, p);
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_EQ(q[i], 0);
+  }
+  se_memory_heap_dealloc(q);
+}
+
+TEST(se_memory_heap_alloc_zeroed, reused_large_block) {
+  const se_usize_t size = 1 << 20;
+  auto *p = static_cast<unsigned char *>(se_memory_heap_alloc(size));
+  memset(p, 0xAA, size);
+  se_memory_heap_dealloc(p);
+
+  // The freed block is reset and comes back from the cache as zero pages
+  auto *q = static_cast<unsigned char *>(se_memory_heap_alloc_zeroed(size, 0));
+  for (se_usize_t i = 0; i < size; i += 4096) {
+    EXPECT_EQ(q[i], 0);
+  }
+  EXPECT_EQ(q[size - 1], 0);
+  se_memory_heap_dealloc(q);
+}
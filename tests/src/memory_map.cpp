@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <se/memory_map.h>
+#include <se/memory.h>
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace {
+
+std::string write_file(const char *name, const std::string &content) {
+  const std::string path = ::testing::TempDir() + name;
+  std::ofstream(path, std::ios::binary) << content;
+  return path;
+}
+
+std::string pattern(std::size_t size) {
+  std::string content(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    content[i] = static_cast<char>('a' + i % 26);
+  }
+  return content;
+}
+
+} // namespace
+
+TEST(se_memory_map_file, read_only) {
+  const std::string content = pattern(3 * 4096 + 17);
+  const std::string path = write_file("se_memory_map_read_only", content);
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_NONE);
+  ASSERT_EQ(map.size, content.size());
+  EXPECT_EQ(std::memcmp(map.data, content.data(), content.size()), 0);
+
+  se_memory_map_unmap(&map);
+  EXPECT_EQ(map.data, nullptr);
+  EXPECT_EQ(map.size, 0u);
+}
+
+TEST(se_memory_map_file, view_and_find_on_file_bytes) {
+  std::string content = pattern(1 << 16);
+  content.replace(50000, 6, "needle");
+  const std::string path = write_file("se_memory_map_find", content);
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_POPULATE);
+  se_memory_map_advise(&map, 0, map.size, SE_MEMORY_MAP_ADVICE_SEQUENTIAL);
+
+  const se_memory_view_t view = se_memory_map_get_view(&map);
+  EXPECT_EQ(se_memory_view_get_size(&view), content.size());
+
+  const void *found = se_memory_find(view.begin, se_memory_view_get_size(&view), "needle", 6);
+  ASSERT_NE(found, nullptr);
+  EXPECT_EQ(static_cast<const char *>(found) - static_cast<const char *>(view.begin), 50000);
+  EXPECT_TRUE(se_memory_view_contains_pointer(&view, found));
+
+  se_memory_map_unmap(&map);
+}
+
+TEST(se_memory_map_file, copy_on_write) {
+  const std::string content = pattern(100);
+  const std::string path = write_file("se_memory_map_cow", content);
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_COPY_ON_WRITE);
+  static_cast<char *>(map.data)[0] = '#';
+  se_memory_map_unmap(&map);
+
+  // Private writes never reach the file
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_NONE);
+  EXPECT_EQ(static_cast<const char *>(map.data)[0], 'a');
+  se_memory_map_unmap(&map);
+}
+
+TEST(se_memory_map_file, empty_file) {
+  const std::string path = write_file("se_memory_map_empty", "");
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_NONE);
+  EXPECT_EQ(map.data, nullptr);
+  EXPECT_EQ(map.size, 0u);
+
+  // Advice on an empty range is a no-op
+  se_memory_map_advise(&map, 0, 100, SE_MEMORY_MAP_ADVICE_WILLNEED);
+  se_memory_map_unmap(&map);
+}
+
+TEST(se_memory_map_file, empty_file_view) {
+  const std::string path = write_file("se_memory_map_empty_view", "");
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_NONE);
+
+  const se_memory_view_t view = se_memory_map_get_view(&map);
+  EXPECT_TRUE(se_memory_view_is_valid(&view));
+  EXPECT_TRUE(se_memory_view_is_empty(&view));
+  EXPECT_EQ(se_memory_view_get_size(&view), 0u);
+  EXPECT_EQ(se_memory_find(view.begin, se_memory_view_get_size(&view), "needle", 6), nullptr);
+
+  se_memory_map_unmap(&map);
+}
+
+TEST(se_memory_map_file, missing_file) {
+  se_memory_map_t map;
+  EXPECT_DEATH(se_memory_map_file(&map, "/nonexistent/se_memory_map", SE_MEMORY_MAP_FLAG_NONE), ".*");
+}
+
+TEST(se_memory_map_advise, unaligned_range) {
+  const std::string content = pattern(5 * 4096);
+  const std::string path = write_file("se_memory_map_advise", content);
+
+  se_memory_map_t map;
+  se_memory_map_file(&map, path.c_str(), SE_MEMORY_MAP_FLAG_NONE);
+  se_memory_map_advise(&map, 4097, 1 << 20, SE_MEMORY_MAP_ADVICE_RANDOM);
+  se_memory_map_advise(&map, 100, 10, SE_MEMORY_MAP_ADVICE_WILLNEED);
+  EXPECT_EQ(static_cast<const char *>(map.data)[4097], content[4097]);
+  se_memory_map_unmap(&map);
+}
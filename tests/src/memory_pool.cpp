@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include <se/memory_pool.h>
+#include <se/addr.h>
+#include <se/runtime_check.h>
+
+#include <set>
+
+TEST(se_memory_pool_init, null_pointer) {
+  EXPECT_DEATH(se_memory_pool_init(nullptr, 16, 0, 0), ".*");
+}
+
+TEST(se_memory_pool_init, zero_element_size) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  se_memory_pool_t pool;
+  EXPECT_DEATH(se_memory_pool_init(&pool, 0, 0, 0), ".*");
+}
+
+TEST(se_memory_pool_init, invalid_alignment) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
+  se_memory_pool_t pool;
+  EXPECT_DEATH(se_memory_pool_init(&pool, 16, 24, 0), ".*");
+}
+
+TEST(se_memory_pool_init, element_size_rounded) {
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 1, 0, 0);
+  EXPECT_EQ(se_memory_pool_get_element_size(&pool), SE_MEMORY_POOL_ALIGNMENT);
+
+  se_memory_pool_init(&pool, 65, SE_CACHE_LINE_SIZE, 0);
+  EXPECT_EQ(se_memory_pool_get_element_size(&pool), 128u);
+}
+
+TEST(se_memory_pool_init, rejects_overflowing_element_size) {
+  se_memory_pool_t pool;
+  EXPECT_DEATH(se_memory_pool_init(&pool, SE_USIZE_T_MAX, 0, 0), ".*");
+}
+
+TEST(se_memory_pool_alloc, distinct_aligned_elements) {
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 40, SE_CACHE_LINE_SIZE, 8);
+
+  std::set<void *> seen;
+  for (int i = 0; i < 100; ++i) {
+    void *p = se_memory_pool_alloc(&pool);
+    EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % SE_CACHE_LINE_SIZE, 0u);
+    EXPECT_TRUE(seen.insert(p).second);
+  }
+
+  se_memory_pool_deinit(&pool);
+}
+
+TEST(se_memory_pool_alloc, zero_filled) {
+#ifndef SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+  GTEST_SKIP() << "SE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE is OFF";
+#endif
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 32, 0, 0);
+
+  auto *p = static_cast<unsigned char *>(se_memory_pool_alloc(&pool));
+  memset(p, 0xAA, 32);
+  se_memory_pool_dealloc(&pool, p);
+
+  auto *q = static_cast<unsigned char *>(se_memory_pool_alloc(&pool));
+  ASSERT_EQ(p, q);
+  for (int i = 0; i < 32; ++i) {
+    EXPECT_EQ(q[i], 0);
+  }
+
+  se_memory_pool_deinit(&pool);
+}
+
+TEST(se_memory_pool_alloc, rejects_overflowing_slab) {
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 64, 0, SE_USIZE_T_MAX / 32);
+  EXPECT_DEATH(se_memory_pool_alloc(&pool), ".*");
+}
+
+TEST(se_memory_pool_dealloc, reuses_last_freed) {
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 24, 0, 4);
+
+  void *a = se_memory_pool_alloc(&pool);
+  void *b = se_memory_pool_alloc(&pool);
+  se_memory_pool_dealloc(&pool, a);
+  se_memory_pool_dealloc(&pool, b);
+
+  EXPECT_EQ(se_memory_pool_alloc(&pool), b);
+  EXPECT_EQ(se_memory_pool_alloc(&pool), a);
+
+  se_memory_pool_deinit(&pool);
+}
+
+TEST(se_memory_pool_dealloc, null_element) {
+  se_memory_pool_t pool;
+  se_memory_pool_init(&pool, 24, 0, 4);
+  se_memory_pool_dealloc(&pool, nullptr);
+  se_memory_pool_deinit(&pool);
+}
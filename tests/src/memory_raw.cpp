@@ -2,8 +2,14 @@
 #include <se/memory_raw.h>
 #include <se/size.h>
 #include <se/static_array_size.h>
+#include <se/runtime_check.h>
+
+#include <algorithm>
 
 TEST(se_memory_raw_compare, null_pointers) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   EXPECT_DEATH(se_memory_raw_compare(nullptr, nullptr, nullptr, nullptr), ".*");
 }
 
@@ -61,6 +67,9 @@ TEST(se_memory_raw_compare, compare_different_values) {
 }
 
 TEST(se_memory_raw_compare, empty_array) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   constexpr se_u8_t rhs[] = {1, 2, 3};
   constexpr se_usize_t rhs_len = se_static_array_size(rhs);
   EXPECT_DEATH(se_memory_raw_compare(nullptr, nullptr, rhs, &rhs[rhs_len]),
@@ -76,6 +85,9 @@ TEST(se_memory_raw_compare, compare_equal_after_different_elements) {
 }
 
 TEST(se_memory_raw_compare_rev, null_pointers) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   EXPECT_DEATH(se_memory_raw_compare_rev(nullptr, nullptr, nullptr, nullptr),
                ".*");
 }
@@ -107,6 +119,9 @@ TEST(se_memory_raw_compare_rev, compare_different_values) {
 }
 
 TEST(se_memory_raw_compare_rev, empty_array) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   constexpr se_u8_t rhs[] = {1, 2, 3};
   constexpr se_usize_t rhs_len = se_static_array_size(rhs);
 
@@ -388,6 +403,9 @@ TEST(se_memory_raw_find, null_pointer) {
 }
 
 TEST(se_memory_raw_find, empty_lhs) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   const constexpr se_u8_t *lhs = nullptr;
   constexpr se_u8_t rhs[] = {3, 4};
 
@@ -395,12 +413,28 @@ TEST(se_memory_raw_find, empty_lhs) {
 }
 
 TEST(se_memory_raw_find, empty_rhs) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   constexpr se_u8_t lhs[] = {1, 2, 3, 4, 5};
   const constexpr se_u8_t *rhs = nullptr;
 
   EXPECT_DEATH(se_memory_raw_find(lhs, lhs + 5, rhs, rhs), ".*");
 }
 
+TEST(se_memory_raw_find, inverted_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
+  constexpr se_u8_t lhs[] = {1, 2, 3, 4, 5};
+  constexpr se_u8_t rhs[] = {3, 4};
+
+  EXPECT_DEATH(se_memory_raw_find(lhs + 5, lhs, rhs, rhs + 2), ".*");
+  EXPECT_DEATH(se_memory_raw_find(lhs, lhs + 5, rhs + 2, rhs), ".*");
+  EXPECT_DEATH(se_memory_raw_find_rev(lhs + 5, lhs, rhs, rhs + 2), ".*");
+  EXPECT_DEATH(se_memory_raw_find_rev(lhs, lhs + 5, rhs + 2, rhs), ".*");
+}
+
 TEST(se_memory_raw_find, no_match) {
   constexpr se_u8_t lhs[] = {1, 2, 3, 4, 5};
   constexpr se_u8_t rhs[] = {6, 7};
@@ -417,6 +451,41 @@ TEST(se_memory_raw_find, match_at_start) {
   EXPECT_EQ(result, lhs);
 }
 
+TEST(se_memory_raw_find, partial_match_at_end) {
+  constexpr se_u8_t lhs[] = {1, 2, 3};
+  constexpr se_u8_t rhs[] = {3, 4};
+
+  EXPECT_EQ(se_memory_raw_find(lhs, lhs + 3, rhs, rhs + 2), nullptr);
+  EXPECT_EQ(se_memory_raw_find_rev(lhs, lhs + 3, rhs, rhs + 2), nullptr);
+}
+
+TEST(se_memory_raw_find, matches_naive_search) {
+  // Long enough to cross the vector loops and the scalar tail at every offset
+  se_u8_t lhs[200];
+  for (se_usize_t i = 0; i < se_static_array_size(lhs); ++i) {
+    lhs[i] = static_cast<se_u8_t>((i * 7) % 5);
+  }
+
+  for (se_usize_t size = 1; size <= 40; size += 3) {
+    for (se_usize_t offset = 0; offset + size <= se_static_array_size(lhs); offset += 11) {
+      const se_u8_t *needle = lhs + offset;
+      const se_u8_t *end = lhs + se_static_array_size(lhs);
+
+      const se_u8_t *first = nullptr;
+      const se_u8_t *last = nullptr;
+      for (const se_u8_t *p = lhs; p + size <= end; ++p) {
+        if (std::equal(needle, needle + size, p)) {
+          first = first ? first : p;
+          last = p;
+        }
+      }
+
+      EXPECT_EQ(se_memory_raw_find(lhs, end, needle, needle + size), first);
+      EXPECT_EQ(se_memory_raw_find_rev(lhs, end, needle, needle + size), last);
+    }
+  }
+}
+
 TEST(se_memory_raw_find_rev, find_substring_in_string) {
   constexpr se_u8_t lhs[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
   constexpr se_u8_t rhs[] = {0x03, 0x04};
@@ -446,6 +515,9 @@ TEST(se_memory_raw_find_rev, find_substring_at_end) {
 }
 
 TEST(se_memory_raw_find_rev, empty_arrays) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   EXPECT_DEATH(se_memory_raw_find_rev(nullptr, nullptr, nullptr, nullptr),
                ".*");
 }
@@ -458,6 +530,9 @@ TEST(se_memory_raw_find_rev, rhs_longer_than_lhs) {
 }
 
 TEST(se_memory_raw_find_rev, null_pointer_check) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   constexpr se_u8_t lhs[] = {0x01, 0x02, 0x03, 0x04};
   constexpr se_u8_t rhs[] = {0x03, 0x04};
   EXPECT_DEATH(se_memory_raw_find_rev(nullptr, &lhs[4], rhs, &rhs[2]), ".*");
@@ -504,6 +579,9 @@ TEST(se_memory_raw_repeat, single_byte_pattern) {
 }
 
 TEST(se_memory_raw_repeat, null_pointer_check) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   constexpr se_u8_t src[] = {0x01, 0x02};
   EXPECT_DEATH(se_memory_raw_repeat(nullptr, nullptr, src, src + 2), ".*");
 }
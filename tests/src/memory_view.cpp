@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <se/memory_view.h>
+#include <se/runtime_error_code.h>
 #include <se/static_array_size.h>
+#include <se/runtime_check.h>
 
 TEST(se_memory_view_get_begin, valid_pointer) {
   int value = 42;
@@ -9,6 +11,9 @@ TEST(se_memory_view_get_begin, valid_pointer) {
 }
 
 TEST(se_memory_view_get_begin, null_pointer) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   EXPECT_DEATH(se_memory_view_get_begin(nullptr), ".*");
 }
 
@@ -19,6 +24,9 @@ TEST(se_memory_view_get_end, valid_pointer) {
 }
 
 TEST(se_memory_view_get_end, null_pointer) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
   EXPECT_DEATH(se_memory_view_get_end(nullptr), ".*");
 }
 
@@ -185,6 +193,9 @@ TEST(se_memory_view_contains_pointer, null_pointer) {
 }
 
 TEST(se_memory_view_contains_pointer, empty_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   se_memory_view_t range = {nullptr, nullptr};
   int value = 42;
   void *ptr = &value;
@@ -194,6 +205,9 @@ TEST(se_memory_view_contains_pointer, empty_range) {
 }
 
 TEST(se_memory_view_contains_pointer, empty_range_returns_false_for_nullptr) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   se_memory_view_t range = {nullptr, nullptr};
   EXPECT_DEATH(se_memory_view_contains_pointer(&range, nullptr), ".*");
 }
@@ -288,6 +302,9 @@ TEST(se_memory_view_is_multiple_of, zero_element_size) {
 }
 
 TEST(se_memory_view_is_multiple_of, empty_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   se_memory_view_t range = {nullptr, nullptr};
   se_usize_t element_size = sizeof(int);
   EXPECT_DEATH(se_memory_view_is_multiple_of(&range, element_size), ".*")
@@ -315,6 +332,9 @@ TEST(se_memory_view_is_aligned, valid_aligned) {
 }
 
 TEST(se_memory_view_is_aligned, zero_alignment) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_ARGUMENT checks are disabled";
+  }
   int data[2];
   se_memory_view_t range = {data, &data[2]};
   se_usize_t alignment_size = 0;
@@ -370,6 +390,9 @@ TEST(se_memory_view_get_size, single_element_range) {
 }
 
 TEST(se_memory_view_get_size, invalid_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
   se_memory_view_t range = {nullptr, nullptr};
   EXPECT_DEATH(se_memory_view_get_size(&range), ".*");
 }
@@ -415,6 +438,9 @@ TEST(se_memory_view_at_begin, null_pointer) {
 }
 
 TEST(se_memory_view_at_begin, invalid_offset) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[100];
   se_memory_view_t view = {.begin = buffer, .end = buffer + 100};
   EXPECT_DEATH(se_memory_view_at_begin(&view, 100), ".*");
@@ -430,6 +456,9 @@ TEST(se_memory_view_at_begin, valid_offset) {
 }
 
 TEST(se_memory_view_at_begin, empty_view) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[1];
   se_memory_view_t view = {.begin = buffer, .end = buffer};
   EXPECT_DEATH(se_memory_view_at_begin(&view, 0), ".*");
@@ -440,6 +469,9 @@ TEST(se_memory_view_at_end, null_pointer) {
 }
 
 TEST(se_memory_view_at_end, invalid_offset) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[100];
   se_memory_view_t view = {.begin = buffer, .end = buffer + 100};
 
@@ -456,6 +488,9 @@ TEST(se_memory_view_at_end, valid_offset) {
 }
 
 TEST(se_memory_view_at_end, empty_view) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[1];
   se_memory_view_t view = {.begin = buffer, .end = buffer};
   EXPECT_DEATH(se_memory_view_at_end(&view, 0), ".*");
@@ -467,12 +502,18 @@ TEST(se_memory_view_at, null_pointer) {
 }
 
 TEST(se_memory_view_at, invalid_offset_forward) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[100];
   se_memory_view_t view = {.begin = buffer, .end = buffer + 100};
   EXPECT_DEATH(se_memory_view_at(&view, 100, false), ".*");
 }
 
 TEST(se_memory_view_at, invalid_offset_reversed) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[100];
   se_memory_view_t view = {.begin = buffer, .end = buffer + 100};
   EXPECT_DEATH(se_memory_view_at(&view, 100, true), ".*");
@@ -497,6 +538,9 @@ TEST(se_memory_view_at, valid_offset_reversed) {
 }
 
 TEST(se_memory_view_at, empty_view) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[1];
   se_memory_view_t view = {.begin = buffer, .end = buffer};
 
@@ -515,6 +559,9 @@ TEST(se_memory_view_get_first, valid_view) {
 }
 
 TEST(se_memory_view_get_first, empty_view) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[1];
   se_memory_view_t view = {.begin = buffer, .end = buffer};
   EXPECT_DEATH(se_memory_view_get_first(&view), ".*");
@@ -531,6 +578,9 @@ TEST(se_memory_view_get_last, valid_view) {
 }
 
 TEST(se_memory_view_get_last, empty_view) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
   char buffer[1];
   se_memory_view_t view = {.begin = buffer, .end = buffer};
   EXPECT_DEATH(se_memory_view_get_last(&view), ".*");
@@ -709,4 +759,81 @@ TEST(se_memory_view_is_equal, empty_views) {
   se_memory_view_t other = {.begin = buffer, .end = buffer};
 
   EXPECT_TRUE(se_memory_view_is_equal(&self, &other));
-}
\ No newline at end of file
+}
+
+TEST(se_memory_view_get_begin_unchecked, matches_checked) {
+  int values[4] = {1, 2, 3, 4};
+  se_memory_view_t range = {values, values + se_static_array_size(values)};
+  EXPECT_EQ(se_memory_view_get_begin_unchecked(&range), se_memory_view_get_begin(&range));
+  EXPECT_EQ(se_memory_view_get_end_unchecked(&range), se_memory_view_get_end(&range));
+  EXPECT_EQ(se_memory_view_get_size_unchecked(&range), se_memory_view_get_size(&range));
+}
+
+TEST(se_memory_view_at_begin_unchecked, matches_checked) {
+  char values[8] = {};
+  se_memory_view_t range = {values, values + sizeof(values)};
+  for (se_uoffset_t offset = 0; offset < sizeof(values); ++offset) {
+    EXPECT_EQ(se_memory_view_at_begin_unchecked(&range, offset), se_memory_view_at_begin(&range, offset));
+    EXPECT_EQ(se_memory_view_at_end_unchecked(&range, offset), se_memory_view_at_end(&range, offset));
+  }
+}
+
+TEST(se_memory_view_at_begin_unchecked, skips_range_check) {
+  char values[8] = {};
+  se_memory_view_t range = {values, values + 4};
+  // The offset is outside the view but inside the array it was taken from
+  EXPECT_EQ(se_memory_view_at_begin_unchecked(&range, 6), values + 6);
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    EXPECT_DEATH(se_memory_view_at_begin(&range, 6), ".*");
+  }
+}
+
+TEST(se_memory_view_at_begin_r, returns_pointer_and_keeps_error) {
+  char values[8] = {};
+  se_memory_view_t range = {values, values + sizeof(values)};
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_view_at_begin_r(&range, 3, &error), values + 3);
+  EXPECT_EQ(se_memory_view_at_end_r(&range, 0, &error), values + 7);
+  EXPECT_EQ(se_memory_view_get_size_r(&range, &error), sizeof(values));
+  EXPECT_TRUE(se_memory_view_contains_pointer_r(&range, values + 8, &error));
+  EXPECT_TRUE(se_error_is_ok(&error));
+}
+
+TEST(se_memory_view_at_begin_r, reports_out_of_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
+  char values[8] = {};
+  se_memory_view_t range = {values, values + sizeof(values)};
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_view_at_begin_r(&range, 8, &error), nullptr);
+  EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_OUT_OF_RANGE);
+
+  se_error_clear(&error);
+  EXPECT_EQ(se_memory_view_at_end_r(&range, 8, &error), nullptr);
+  EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_OUT_OF_RANGE);
+}
+
+TEST(se_memory_view_get_size_r, reports_invalid_range) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE checks are disabled";
+  }
+  char values[8] = {};
+  se_memory_view_t range = {values + 4, values};
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_view_get_size_r(&range, &error), 0u);
+  EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE);
+}
+
+TEST(se_memory_view_get_begin_r, reports_null_pointer) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_NULL_POINTER checks are disabled";
+  }
+  se_error_t error = {};
+  EXPECT_EQ(se_memory_view_get_begin_r(nullptr, &error), nullptr);
+  EXPECT_EQ(se_error_get_code(&error), SE_RUNTIME_ERROR_NULL_POINTER);
+
+  // The error output is optional
+  EXPECT_EQ(se_memory_view_get_end_r(nullptr, nullptr), nullptr);
+  EXPECT_FALSE(se_memory_view_contains_pointer_r(nullptr, nullptr, nullptr));
+}
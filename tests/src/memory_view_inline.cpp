@@ -0,0 +1,140 @@
+// Built with the inline accessors regardless of the library option: a call
+// like se_memory_view_get_begin(&view) expands to the inline version, while
+// the parenthesized name (se_memory_view_get_begin)(&view) calls the export.
+#ifndef SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+#define SE_LIBRARY_OPTION_MEMORY_VIEW_INLINE
+#endif
+
+#include <gtest/gtest.h>
+#include <se/memory_view.h>
+#include <se/runtime_error_code.h>
+#include <se/runtime_check.h>
+
+#include <vector>
+
+namespace {
+
+char g_buffer[16];
+
+std::vector<se_memory_view_t> valid_views() {
+  return {
+      {g_buffer, g_buffer + sizeof(g_buffer)},
+      {g_buffer + 3, g_buffer + 11},
+      {g_buffer + 5, g_buffer + 6},
+      {g_buffer + 7, g_buffer + 7},
+  };
+}
+
+}  // namespace
+
+TEST(se_memory_view_inline, address_is_exported_symbol) {
+  se_memory_view_t view = {g_buffer, g_buffer + sizeof(g_buffer)};
+  const void *(*get_begin)(const se_memory_view_t *) = &se_memory_view_get_begin;
+  EXPECT_EQ(get_begin(&view), se_memory_view_get_begin(&view));
+}
+
+TEST(se_memory_view_inline, accessors_match_exports) {
+  for (const se_memory_view_t &view : valid_views()) {
+    EXPECT_EQ(se_memory_view_get_begin(&view), (se_memory_view_get_begin)(&view));
+    EXPECT_EQ(se_memory_view_get_begin_unchecked(&view), (se_memory_view_get_begin_unchecked)(&view));
+    EXPECT_EQ(se_memory_view_get_end(&view), (se_memory_view_get_end)(&view));
+    EXPECT_EQ(se_memory_view_get_end_unchecked(&view), (se_memory_view_get_end_unchecked)(&view));
+    EXPECT_EQ(se_memory_view_is_empty(&view), (se_memory_view_is_empty)(&view));
+    EXPECT_EQ(se_memory_view_is_valid(&view), (se_memory_view_is_valid)(&view));
+    EXPECT_EQ(se_memory_view_get_size(&view), (se_memory_view_get_size)(&view));
+    EXPECT_EQ(se_memory_view_get_size_unchecked(&view), (se_memory_view_get_size_unchecked)(&view));
+
+    const void *inline_begin = nullptr, *inline_end = nullptr;
+    const void *export_begin = nullptr, *export_end = nullptr;
+    se_memory_view_unpack(&view, &inline_begin, &inline_end);
+    (se_memory_view_unpack)(&view, &export_begin, &export_end);
+    EXPECT_EQ(inline_begin, export_begin);
+    EXPECT_EQ(inline_end, export_end);
+
+    for (se_usize_t size = 1; size <= 4; ++size) {
+      EXPECT_EQ(se_memory_view_is_multiple_of(&view, size), (se_memory_view_is_multiple_of)(&view, size));
+      EXPECT_EQ(se_memory_view_is_aligned(&view, size), (se_memory_view_is_aligned)(&view, size));
+    }
+  }
+}
+
+TEST(se_memory_view_inline, offsets_match_exports) {
+  for (const se_memory_view_t &view : valid_views()) {
+    const se_usize_t size = se_memory_view_get_size(&view);
+    for (se_uoffset_t offset = 0; offset <= size; ++offset) {
+      EXPECT_EQ(se_memory_view_is_valid_offset(&view, offset), (se_memory_view_is_valid_offset)(&view, offset));
+      EXPECT_EQ(se_memory_view_at_begin_unchecked(&view, offset), (se_memory_view_at_begin_unchecked)(&view, offset));
+      EXPECT_EQ(se_memory_view_at_end_unchecked(&view, offset), (se_memory_view_at_end_unchecked)(&view, offset));
+      if (offset == size) {
+        continue;
+      }
+      EXPECT_EQ(se_memory_view_at_begin(&view, offset), (se_memory_view_at_begin)(&view, offset));
+      EXPECT_EQ(se_memory_view_at_end(&view, offset), (se_memory_view_at_end)(&view, offset));
+      EXPECT_EQ(se_memory_view_at(&view, offset, false), (se_memory_view_at)(&view, offset, false));
+      EXPECT_EQ(se_memory_view_at(&view, offset, true), (se_memory_view_at)(&view, offset, true));
+    }
+    if (size) {
+      EXPECT_EQ(se_memory_view_get_first(&view), (se_memory_view_get_first)(&view));
+      EXPECT_EQ(se_memory_view_get_last(&view), (se_memory_view_get_last)(&view));
+    }
+  }
+}
+
+TEST(se_memory_view_inline, comparisons_match_exports) {
+  const std::vector<se_memory_view_t> views = valid_views();
+  for (const se_memory_view_t &self : views) {
+    for (const char *ptr = g_buffer; ptr <= g_buffer + sizeof(g_buffer); ++ptr) {
+      EXPECT_EQ(se_memory_view_contains_pointer(&self, ptr), (se_memory_view_contains_pointer)(&self, ptr));
+      EXPECT_EQ(se_memory_view_is_begin_equal(&self, ptr), (se_memory_view_is_begin_equal)(&self, ptr));
+      EXPECT_EQ(se_memory_view_is_end_equal(&self, ptr), (se_memory_view_is_end_equal)(&self, ptr));
+    }
+    for (const se_memory_view_t &other : views) {
+      EXPECT_EQ(se_memory_view_contains(&self, &other), (se_memory_view_contains)(&self, &other));
+      EXPECT_EQ(se_memory_view_contains_range(&self, other.begin, other.end),
+                (se_memory_view_contains_range)(&self, other.begin, other.end));
+      EXPECT_EQ(se_memory_view_is_begin_equal_to(&self, &other), (se_memory_view_is_begin_equal_to)(&self, &other));
+      EXPECT_EQ(se_memory_view_is_end_equal_to(&self, &other), (se_memory_view_is_end_equal_to)(&self, &other));
+      EXPECT_EQ(se_memory_view_is_equal(&self, &other), (se_memory_view_is_equal)(&self, &other));
+    }
+  }
+}
+
+TEST(se_memory_view_inline, error_codes_match_exports) {
+  std::vector<se_memory_view_t> views = valid_views();
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_MEMORY_RANGE)) {
+    views.push_back({g_buffer + 8, g_buffer + 2});
+  }
+
+  for (const se_memory_view_t &view : views) {
+    se_error_t inline_error = {};
+    se_error_t export_error = {};
+    EXPECT_EQ(se_memory_view_get_begin_r(&view, &inline_error), (se_memory_view_get_begin_r)(&view, &export_error));
+    EXPECT_EQ(se_memory_view_get_end_r(&view, &inline_error), (se_memory_view_get_end_r)(&view, &export_error));
+    EXPECT_EQ(se_memory_view_get_size_r(&view, &inline_error), (se_memory_view_get_size_r)(&view, &export_error));
+    EXPECT_EQ(se_memory_view_contains_pointer_r(&view, g_buffer + 4, &inline_error),
+              (se_memory_view_contains_pointer_r)(&view, g_buffer + 4, &export_error));
+    EXPECT_EQ(se_error_get_code(&inline_error), se_error_get_code(&export_error));
+
+    if (!se_memory_view_is_valid(&view)) {
+      continue;
+    }
+    // One past the end is an error only while the range check is compiled in
+    const se_usize_t count = se_memory_view_get_size(&view) + se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE);
+    for (se_uoffset_t offset = 0; offset < count; ++offset) {
+      se_error_clear(&inline_error);
+      se_error_clear(&export_error);
+      EXPECT_EQ(se_memory_view_at_begin_r(&view, offset, &inline_error),
+                (se_memory_view_at_begin_r)(&view, offset, &export_error));
+      EXPECT_EQ(se_memory_view_at_end_r(&view, offset, &inline_error),
+                (se_memory_view_at_end_r)(&view, offset, &export_error));
+      EXPECT_EQ(se_error_get_code(&inline_error), se_error_get_code(&export_error));
+    }
+  }
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_NULL_POINTER)) {
+    se_error_t inline_error = {};
+    se_error_t export_error = {};
+    EXPECT_EQ(se_memory_view_get_begin_r(nullptr, &inline_error), (se_memory_view_get_begin_r)(nullptr, &export_error));
+    EXPECT_EQ(se_error_get_code(&inline_error), se_error_get_code(&export_error));
+  }
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <se/mpmc_queue.h>
+#include <se/runtime_check.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct message {
+  std::uint32_t producer;
+  std::uint32_t sequence;
+  char payload[24];
+};
+
+} // namespace
+
+TEST(se_mpmc_queue_init, rounds_capacity) {
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, 100, sizeof(message));
+  EXPECT_EQ(se_mpmc_queue_get_capacity(&queue), 128u);
+  EXPECT_EQ(se_mpmc_queue_get_element_size(&queue), sizeof(message));
+  EXPECT_EQ(se_mpmc_queue_get_size(&queue), 0u);
+  se_mpmc_queue_deinit(&queue);
+
+  if (se_runtime_check_is_enabled(SE_RUNTIME_ERROR_INVALID_ARGUMENT)) {
+    EXPECT_DEATH(se_mpmc_queue_init(&queue, 16, 0), ".*");
+  }
+}
+
+TEST(se_mpmc_queue_try_enqueue, fills_and_drains_in_order) {
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, 8, sizeof(int));
+
+  int value = 0;
+  EXPECT_FALSE(se_mpmc_queue_try_dequeue(&queue, &value));
+
+  // Several laps over the cells
+  for (int lap = 0; lap < 3; ++lap) {
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_TRUE(se_mpmc_queue_try_enqueue(&queue, &i));
+    }
+    EXPECT_FALSE(se_mpmc_queue_try_enqueue(&queue, &value));
+    EXPECT_EQ(se_mpmc_queue_get_size(&queue), 8u);
+
+    for (int i = 0; i < 8; ++i) {
+      ASSERT_TRUE(se_mpmc_queue_try_dequeue(&queue, &value));
+      EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(se_mpmc_queue_try_dequeue(&queue, &value));
+  }
+
+  se_mpmc_queue_deinit(&queue);
+}
+
+TEST(se_mpmc_queue_try_enqueue_batch, partial_batches) {
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, 8, sizeof(std::uint16_t));
+
+  const std::uint16_t input[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  EXPECT_EQ(se_mpmc_queue_try_enqueue_batch(&queue, input, 5), 5u);
+  EXPECT_EQ(se_mpmc_queue_try_enqueue_batch(&queue, input + 5, 7), 3u);
+
+  std::uint16_t output[12] = {};
+  EXPECT_EQ(se_mpmc_queue_try_dequeue_batch(&queue, output, 6), 6u);
+  EXPECT_EQ(se_mpmc_queue_try_enqueue_batch(&queue, input + 8, 4), 4u);
+  EXPECT_EQ(se_mpmc_queue_try_dequeue_batch(&queue, output + 6, 12), 6u);
+
+  for (std::uint16_t i = 0; i < 12; ++i) {
+    EXPECT_EQ(output[i], i);
+  }
+
+  se_mpmc_queue_deinit(&queue);
+}
+
+TEST(se_mpmc_queue_enqueue, many_producers_many_consumers) {
+  constexpr std::uint32_t kProducers = 4;
+  constexpr std::uint32_t kConsumers = 4;
+  constexpr std::uint32_t kPerProducer = 50000;
+
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, 64, sizeof(message));
+
+  std::vector<std::thread> threads;
+  for (std::uint32_t p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      message batch[5] = {};
+      for (std::uint32_t i = 0; i < kPerProducer; i += 5) {
+        for (std::uint32_t j = 0; j < 5; ++j) {
+          batch[j].producer = p;
+          batch[j].sequence = i + j;
+        }
+        // Mix single and batched blocking enqueues
+        if (i % 2) {
+          se_mpmc_queue_enqueue_batch(&queue, batch, 5);
+        } else {
+          for (const message &item : batch) {
+            se_mpmc_queue_enqueue(&queue, &item);
+          }
+        }
+      }
+    });
+  }
+
+  std::vector<std::vector<std::uint32_t>> received(kConsumers * kProducers);
+  std::atomic<std::uint32_t> remaining{kProducers * kPerProducer};
+  std::atomic<bool> ordered{true};
+
+  for (std::uint32_t c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&, c] {
+      message batch[8];
+      std::vector<std::uint32_t> last(kProducers, UINT32_MAX);
+      while (remaining.load() > 0) {
+        const se_usize_t count = se_mpmc_queue_try_dequeue_batch(&queue, batch, 8);
+        if (!count) {
+          std::this_thread::yield();
+          continue;
+        }
+        for (se_usize_t i = 0; i < count; ++i) {
+          // Messages of one producer reach each consumer in order
+          std::uint32_t &previous = last[batch[i].producer];
+          if (previous != UINT32_MAX && batch[i].sequence <= previous) {
+            ordered = false;
+          }
+          previous = batch[i].sequence;
+          received[c * kProducers + batch[i].producer].push_back(batch[i].sequence);
+        }
+        remaining -= static_cast<std::uint32_t>(count);
+      }
+    });
+  }
+
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_TRUE(ordered);
+  for (std::uint32_t p = 0; p < kProducers; ++p) {
+    std::vector<bool> seen(kPerProducer);
+    for (std::uint32_t c = 0; c < kConsumers; ++c) {
+      for (std::uint32_t sequence : received[c * kProducers + p]) {
+        ASSERT_FALSE(seen[sequence]);
+        seen[sequence] = true;
+      }
+    }
+    for (std::uint32_t i = 0; i < kPerProducer; ++i) {
+      ASSERT_TRUE(seen[i]);
+    }
+  }
+
+  se_mpmc_queue_deinit(&queue);
+}
+
+TEST(se_mpmc_queue_dequeue, blocks_until_enqueue) {
+  se_mpmc_queue_t queue;
+  se_mpmc_queue_init(&queue, 2, sizeof(int));
+
+  // Consumers park on the futex long before the producer starts
+  std::vector<std::thread> consumers;
+  std::atomic<int> sum{0};
+  for (int c = 0; c < 3; ++c) {
+    consumers.emplace_back([&] {
+      int values[2];
+      int taken = 0;
+      while (taken < 100) {
+        const se_usize_t count = se_mpmc_queue_dequeue_batch(&queue, values, taken + 2 <= 100 ? 2 : 1);
+        for (se_usize_t i = 0; i < count; ++i) {
+          sum += values[i];
+        }
+        taken += static_cast<int>(count);
+      }
+    });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  for (int i = 1; i <= 300; ++i) {
+    se_mpmc_queue_enqueue(&queue, &i);
+  }
+
+  for (std::thread &consumer : consumers) {
+    consumer.join();
+  }
+  EXPECT_EQ(sum.load(), 300 * 301 / 2);
+
+  se_mpmc_queue_deinit(&queue);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <se/mutex.h>
+#include <se/atomic.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(se_mutex, is_padded_to_cache_line) {
+  EXPECT_EQ(sizeof(se_mutex_t), static_cast<std::size_t>(SE_CACHE_LINE_SIZE));
+  EXPECT_EQ(alignof(se_mutex_t), static_cast<std::size_t>(SE_CACHE_LINE_SIZE));
+}
+
+TEST(se_mutex_try_lock, fails_while_locked) {
+  se_mutex_t mutex;
+  se_mutex_init(&mutex, nullptr);
+
+  EXPECT_TRUE(se_mutex_try_lock(&mutex));
+  EXPECT_FALSE(se_mutex_try_lock(&mutex));
+  se_mutex_unlock(&mutex);
+  EXPECT_TRUE(se_mutex_try_lock(&mutex));
+  se_mutex_unlock(&mutex);
+}
+
+TEST(se_mutex_lock, serializes_threads) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 20000;
+
+  se_mutex_t mutex;
+  se_mutex_init(&mutex, nullptr);
+
+  // Non-atomic on purpose: only the mutex keeps the increments whole
+  long counter = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations; ++i) {
+        se_mutex_lock(&mutex);
+        ++counter;
+        se_mutex_unlock(&mutex);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(counter, static_cast<long>(kThreads) * kIterations);
+}
+
+TEST(se_mutex_lock, counts_sleeping_waiter) {
+  se_lock_stats_t stats = {};
+  se_mutex_t mutex;
+  se_mutex_init(&mutex, &stats);
+
+  se_mutex_lock(&mutex);
+  EXPECT_EQ(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), 0u);
+
+  std::thread waiter([&] {
+    se_mutex_lock(&mutex);
+    se_mutex_unlock(&mutex);
+  });
+
+  // Long enough for the waiter to give up spinning and sleep
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  se_mutex_unlock(&mutex);
+  waiter.join();
+
+  EXPECT_EQ(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), 1u);
+  EXPECT_EQ(se_atomic_u64_load(&stats.spin_count, SE_ATOMIC_ORDER_RELAXED), static_cast<se_u64_t>(SE_MUTEX_SPIN_COUNT));
+  EXPECT_GE(se_atomic_u64_load(&stats.wait_count, SE_ATOMIC_ORDER_RELAXED), 1u);
+}
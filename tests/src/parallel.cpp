@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+#include <se/parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+std::uint64_t mix(std::uint64_t x) {
+  x ^= x >> 33;
+  x *= 0xFF51AFD7ED558CCDULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// Affine maps x -> m * x + c under composition: associative, not commutative
+struct affine {
+  std::uint64_t m;
+  std::uint64_t c;
+};
+
+affine compose(affine first, affine then) {
+  return {first.m * then.m, first.c * then.m + then.c};
+}
+
+void combine_affine(void *accumulator, const void *value, void *) {
+  affine *acc = static_cast<affine *>(accumulator);
+  *acc = compose(*acc, *static_cast<const affine *>(value));
+}
+
+void reduce_affine(void *accumulator, const se_memory_view_t *chunk, void *) {
+  for (const affine *it = static_cast<const affine *>(chunk->begin); it != chunk->end; ++it) {
+    combine_affine(accumulator, it, nullptr);
+  }
+}
+
+std::vector<affine> make_affine(std::size_t count) {
+  std::vector<affine> values(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    values[i] = {mix(i) | 1, mix(i + count)};
+  }
+  return values;
+}
+
+struct visit_log {
+  std::vector<std::atomic<int>> *visits;
+  const std::uint32_t *base;
+  std::atomic<int> misaligned;
+};
+
+void visit_chunk(const se_memory_view_t *chunk, se_usize_t first, void *context) {
+  visit_log *log = static_cast<visit_log *>(context);
+  const std::uint32_t *begin = static_cast<const std::uint32_t *>(chunk->begin);
+
+  EXPECT_EQ(begin, log->base + first);
+  if (first && reinterpret_cast<std::uintptr_t>(begin) % SE_CACHE_LINE_SIZE) {
+    log->misaligned.fetch_add(1);
+  }
+  for (const std::uint32_t *it = begin; it != chunk->end; ++it) {
+    (*log->visits)[*it].fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+struct record {
+  std::uint32_t key;
+  std::uint32_t sequence;
+  std::uint32_t padding;
+};
+
+int compare_records(const void *lhs, const void *rhs, void *) {
+  const std::uint32_t a = static_cast<const record *>(lhs)->key;
+  const std::uint32_t b = static_cast<const record *>(rhs)->key;
+  return a < b ? -1 : a > b;
+}
+
+class se_parallel : public ::testing::TestWithParam<int> {
+protected:
+  void SetUp() override {
+    if (GetParam()) {
+      se_thread_pool_init(&pool_, GetParam());
+    }
+  }
+
+  void TearDown() override {
+    if (GetParam()) {
+      se_thread_pool_deinit(&pool_);
+    }
+  }
+
+  se_thread_pool_t *pool() { return GetParam() ? &pool_ : nullptr; }
+
+private:
+  se_thread_pool_t pool_;
+};
+
+} // namespace
+
+TEST_P(se_parallel, for_visits_every_record_once_in_aligned_chunks) {
+  constexpr std::size_t kCount = 100003;
+
+  // Start one record past a cache line so the first chunk absorbs the head
+  std::vector<std::uint32_t> storage(kCount + 32);
+  std::uint32_t *data = storage.data();
+  while (reinterpret_cast<std::uintptr_t>(data) % SE_CACHE_LINE_SIZE != sizeof(std::uint32_t)) {
+    ++data;
+  }
+  std::iota(data, data + kCount, 0u);
+
+  for (se_usize_t grain : {0u, 1u, 1000u}) {
+    std::vector<std::atomic<int>> visits(kCount);
+    visit_log log = {&visits, data, {0}};
+    const se_memory_view_t view = {data, data + kCount};
+
+    se_parallel_for(pool(), &view, sizeof(std::uint32_t), grain, visit_chunk, &log);
+
+    EXPECT_EQ(log.misaligned.load(), 0);
+    for (std::size_t i = 0; i < kCount; ++i) {
+      ASSERT_EQ(visits[i].load(), 1) << "record " << i << ", grain " << grain;
+    }
+  }
+}
+
+TEST_P(se_parallel, reduce_keeps_record_order) {
+  for (std::size_t count : {0u, 1u, 17u, 50000u}) {
+    const std::vector<affine> values = make_affine(count);
+
+    affine expected = {1, 0};
+    for (const affine &value : values) {
+      expected = compose(expected, value);
+    }
+
+    const affine identity = {1, 0};
+    const se_memory_view_t view = {values.data(), values.data() + count};
+    for (se_usize_t grain : {0u, 7u}) {
+      affine result = {0, 0};
+      se_parallel_reduce(pool(), &view, sizeof(affine), grain, &identity, sizeof(affine), reduce_affine,
+                         combine_affine, nullptr, &result);
+      EXPECT_EQ(result.m, expected.m);
+      EXPECT_EQ(result.c, expected.c);
+    }
+  }
+}
+
+TEST_P(se_parallel, scan_matches_serial_and_runs_in_place) {
+  constexpr std::size_t kCount = 30001;
+  std::vector<affine> values = make_affine(kCount);
+
+  std::vector<affine> expected(kCount);
+  expected[0] = values[0];
+  for (std::size_t i = 1; i < kCount; ++i) {
+    expected[i] = compose(expected[i - 1], values[i]);
+  }
+
+  const se_memory_view_t view = {values.data(), values.data() + kCount};
+  std::vector<affine> output(kCount);
+  se_parallel_scan(pool(), &view, sizeof(affine), 100, combine_affine, nullptr, output.data());
+  for (std::size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(output[i].m, expected[i].m) << i;
+    ASSERT_EQ(output[i].c, expected[i].c) << i;
+  }
+
+  se_parallel_scan(pool(), &view, sizeof(affine), 0, combine_affine, nullptr, values.data());
+  for (std::size_t i = 0; i < kCount; ++i) {
+    ASSERT_EQ(values[i].m, expected[i].m) << i;
+    ASSERT_EQ(values[i].c, expected[i].c) << i;
+  }
+}
+
+TEST_P(se_parallel, prefix_sum_u64) {
+  for (std::size_t count : {0u, 1u, 5u, 4096u, 200001u}) {
+    std::vector<se_u64_t> values(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      values[i] = mix(i) >> 20;
+    }
+
+    std::vector<se_u64_t> expected(count);
+    std::partial_sum(values.begin(), values.end(), expected.begin());
+
+    const se_memory_view_t view = {values.data(), values.data() + count};
+    std::vector<se_u64_t> output(count);
+    se_parallel_prefix_sum_u64(pool(), &view, 0, output.data());
+    EXPECT_EQ(output, expected);
+
+    se_parallel_prefix_sum_u64(pool(), &view, 333, values.data());
+    EXPECT_EQ(values, expected);
+  }
+}
+
+TEST_P(se_parallel, sort_is_stable) {
+  for (std::size_t count : {0u, 1u, 15u, 16u, 17u, 1000u, 100000u}) {
+    std::vector<record> records(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      // Few distinct keys: long runs of equal records
+      records[i] = {static_cast<std::uint32_t>(mix(i) % 97), static_cast<std::uint32_t>(i), 0};
+    }
+
+    std::vector<record> expected = records;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const record &a, const record &b) { return a.key < b.key; });
+
+    for (se_usize_t grain : {0u, 64u}) {
+      std::vector<record> sorted = records;
+      const se_memory_range_t range = {sorted.data(), sorted.data() + count};
+      se_parallel_sort(pool(), &range, sizeof(record), grain, compare_records, nullptr);
+
+      for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_EQ(sorted[i].key, expected[i].key) << i;
+        ASSERT_EQ(sorted[i].sequence, expected[i].sequence) << i;
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(workers, se_parallel, ::testing::Values(0, 1, 4));
+
+TEST(se_parallel_for, rejects_partial_records) {
+  std::uint32_t data[5] = {};
+  const se_memory_view_t view = {data, reinterpret_cast<char *>(data) + 18};
+  EXPECT_DEATH(se_parallel_for(nullptr, &view, sizeof(std::uint32_t), 0, visit_chunk, nullptr), ".*");
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <se/ring_buffer.h>
+#include <se/runtime_check.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+se_usize_t view_size(const se_memory_view_t &view) {
+  return static_cast<se_usize_t>(static_cast<const char *>(view.end) - static_cast<const char *>(view.begin));
+}
+
+se_usize_t range_size(const se_memory_range_t &range) {
+  return static_cast<se_usize_t>(static_cast<char *>(range.end) - static_cast<char *>(range.begin));
+}
+
+} // namespace
+
+TEST(se_ring_buffer_init, rounds_capacity) {
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, 100, SE_RING_BUFFER_FLAG_NONE);
+  EXPECT_EQ(se_ring_buffer_get_capacity(&ring), 128u);
+  EXPECT_EQ(se_ring_buffer_get_size(&ring), 0u);
+  se_ring_buffer_deinit(&ring);
+
+  se_ring_buffer_init(&ring, 100, SE_RING_BUFFER_FLAG_MIRRORED);
+  EXPECT_EQ(se_ring_buffer_get_capacity(&ring), static_cast<se_usize_t>(SE_RING_BUFFER_MIRRORED_MIN_CAPACITY));
+  se_ring_buffer_deinit(&ring);
+}
+
+TEST(se_ring_buffer_reserve, commit_peek_consume) {
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, 64, SE_RING_BUFFER_FLAG_NONE);
+
+  EXPECT_EQ(view_size(se_ring_buffer_peek(&ring, 1)), 0u);
+
+  se_memory_range_t range = se_ring_buffer_reserve(&ring, 10);
+  ASSERT_EQ(range_size(range), 64u);
+  std::memcpy(range.begin, "0123456789", 10);
+  se_ring_buffer_commit(&ring, 10);
+  EXPECT_EQ(se_ring_buffer_get_size(&ring), 10u);
+
+  // Only published bytes are visible, and requests larger than that yield nothing
+  EXPECT_EQ(view_size(se_ring_buffer_peek(&ring, 11)), 0u);
+  se_memory_view_t view = se_ring_buffer_peek(&ring, 4);
+  ASSERT_EQ(view_size(view), 10u);
+  EXPECT_EQ(std::memcmp(view.begin, "0123456789", 10), 0);
+
+  se_ring_buffer_consume(&ring, 4);
+  view = se_ring_buffer_peek(&ring, 0);
+  ASSERT_EQ(view_size(view), 6u);
+  EXPECT_EQ(std::memcmp(view.begin, "456789", 6), 0);
+
+  EXPECT_EQ(range_size(se_ring_buffer_reserve(&ring, 59)), 0u);
+  EXPECT_EQ(range_size(se_ring_buffer_reserve(&ring, 54)), 54u);
+
+  se_ring_buffer_deinit(&ring);
+}
+
+TEST(se_ring_buffer_reserve, plain_mode_splits_at_end) {
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, 64, SE_RING_BUFFER_FLAG_NONE);
+
+  char data[64];
+  for (int i = 0; i < 64; ++i) {
+    data[i] = static_cast<char>(i);
+  }
+
+  ASSERT_EQ(se_ring_buffer_write(&ring, data, 48), 48u);
+  ASSERT_EQ(se_ring_buffer_read(&ring, data, 40), 40u);
+
+  // 56 bytes are free, but only 16 of them before the end of the buffer
+  EXPECT_EQ(range_size(se_ring_buffer_reserve(&ring, 0)), 16u);
+  EXPECT_EQ(range_size(se_ring_buffer_reserve(&ring, 32)), 0u);
+
+  const char message[] = "wrapping message over the end";
+  ASSERT_EQ(se_ring_buffer_write(&ring, message, sizeof(message)), sizeof(message));
+  EXPECT_EQ(se_ring_buffer_get_size(&ring), 8 + sizeof(message));
+
+  char out[64];
+  ASSERT_EQ(se_ring_buffer_read(&ring, out, 8), 8u);
+  EXPECT_EQ(view_size(se_ring_buffer_peek(&ring, 0)), 16u);
+  ASSERT_EQ(se_ring_buffer_read(&ring, out, sizeof(out)), sizeof(message));
+  EXPECT_STREQ(out, message);
+
+  se_ring_buffer_deinit(&ring);
+}
+
+TEST(se_ring_buffer_reserve, mirrored_mode_stays_contiguous) {
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, 0, SE_RING_BUFFER_FLAG_MIRRORED);
+  const se_usize_t capacity = se_ring_buffer_get_capacity(&ring);
+
+  std::vector<char> data(capacity);
+  ASSERT_EQ(se_ring_buffer_write(&ring, data.data(), capacity - 100), capacity - 100);
+  ASSERT_EQ(se_ring_buffer_read(&ring, data.data(), capacity - 100), capacity - 100);
+
+  // The fragment crosses the end of the buffer without splitting
+  se_memory_range_t range = se_ring_buffer_reserve(&ring, 1000);
+  ASSERT_EQ(range_size(range), capacity);
+  for (int i = 0; i < 1000; ++i) {
+    static_cast<char *>(range.begin)[i] = static_cast<char>(i);
+  }
+  se_ring_buffer_commit(&ring, 1000);
+
+  // The bytes past the end are the same memory as the start of the buffer
+  const char *base = static_cast<const char *>(ring.data);
+  EXPECT_EQ(std::memcmp(base, base + capacity, 900), 0);
+  EXPECT_EQ(base[0], static_cast<char>(100));
+
+  const se_memory_view_t view = se_ring_buffer_peek(&ring, 1000);
+  ASSERT_EQ(view_size(view), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(static_cast<const char *>(view.begin)[i], static_cast<char>(i));
+  }
+  se_ring_buffer_consume(&ring, 1000);
+
+  se_ring_buffer_deinit(&ring);
+}
+
+TEST(se_ring_buffer_commit, overflow) {
+  if (!se_runtime_check_is_enabled(SE_RUNTIME_ERROR_OUT_OF_RANGE)) {
+    GTEST_SKIP() << "SE_RUNTIME_ERROR_OUT_OF_RANGE checks are disabled";
+  }
+  se_ring_buffer_t ring;
+  se_ring_buffer_init(&ring, 64, SE_RING_BUFFER_FLAG_NONE);
+  EXPECT_DEATH(se_ring_buffer_commit(&ring, 65), ".*");
+  EXPECT_DEATH(se_ring_buffer_consume(&ring, 1), ".*");
+  se_ring_buffer_deinit(&ring);
+}
+
+TEST(se_ring_buffer_write, two_threads_preserve_order) {
+  for (se_u32_t flags : {SE_RING_BUFFER_FLAG_NONE, SE_RING_BUFFER_FLAG_MIRRORED}) {
+    se_ring_buffer_t ring;
+    se_ring_buffer_init(&ring, 4096, flags);
+
+    constexpr std::uint32_t kCount = 1 << 20;
+
+    std::thread producer([&] {
+      std::uint32_t next = 0;
+      while (next < kCount) {
+        const se_memory_range_t range = se_ring_buffer_reserve(&ring, sizeof(std::uint32_t));
+        const se_usize_t free = range_size(range) / sizeof(std::uint32_t);
+        if (!free) {
+          std::this_thread::yield();
+          continue;
+        }
+        se_usize_t i = 0;
+        for (; i < free && next < kCount; ++i, ++next) {
+          std::memcpy(static_cast<char *>(range.begin) + i * sizeof(next), &next, sizeof(next));
+        }
+        se_ring_buffer_commit(&ring, i * sizeof(next));
+      }
+    });
+
+    std::uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < kCount) {
+      const se_memory_view_t view = se_ring_buffer_peek(&ring, sizeof(std::uint32_t));
+      const se_usize_t count = view_size(view) / sizeof(std::uint32_t);
+      if (!count) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (se_usize_t i = 0; i < count; ++i, ++expected) {
+        std::uint32_t value;
+        std::memcpy(&value, static_cast<const char *>(view.begin) + i * sizeof(value), sizeof(value));
+        ordered = ordered && value == expected;
+      }
+      se_ring_buffer_consume(&ring, count * sizeof(std::uint32_t));
+    }
+
+    producer.join();
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(se_ring_buffer_get_size(&ring), 0u);
+    se_ring_buffer_deinit(&ring);
+  }
+}
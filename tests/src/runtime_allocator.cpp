@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <se/runtime_allocator.h>
+#include <se/runtime_allocator_stats.h>
+#include <se/addr.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void *plain_alloc(se_usize_t size) { return std::malloc(size); }
+
+using u64 = se_u64_t;
+
+} // namespace
+
+TEST(se_runtime_allocator_alloc_aligned, stdlib) {
+  for (se_usize_t alignment : {8u, 64u, 4096u}) {
+    void *p = se_runtime_allocator_alloc_aligned(100, alignment);
+    EXPECT_EQ(reinterpret_cast<se_uaddr_t>(p) % alignment, 0u);
+    se_runtime_allocator_dealloc(p);
+  }
+}
+
+TEST(se_runtime_allocator_alloc_aligned, invalid_alignment) {
+  EXPECT_DEATH(se_runtime_allocator_alloc_aligned(100, 24), ".*");
+}
+
+TEST(se_runtime_allocator_alloc_aligned, allocator_without_aligned_fn) {
+  const se_memory_allocator_t plain = {plain_alloc, std::free, nullptr};
+  const se_memory_allocator_t previous = se_runtime_allocator_set(&plain);
+
+  // The natural alignment of alloc() is served without alloc_aligned
+  void *p = se_runtime_allocator_alloc_aligned(100, SE_RUNTIME_ALLOCATOR_ALIGNMENT);
+  EXPECT_NE(p, nullptr);
+  se_runtime_allocator_dealloc(p);
+
+  EXPECT_DEATH(se_runtime_allocator_alloc_aligned(100, 64), ".*");
+
+  se_runtime_allocator_set(&previous);
+}
+
+TEST(se_runtime_allocator_alloc_zeroed, allocator_without_zeroed_fn) {
+  const se_memory_allocator_t plain = {plain_alloc, std::free, nullptr, nullptr};
+  const se_memory_allocator_t previous = se_runtime_allocator_set(&plain);
+
+  void *dirty = se_runtime_allocator_alloc_zeroed(256);
+  memset(dirty, 0xAA, 256);
+  se_runtime_allocator_dealloc(dirty);
+
+  const auto *p = static_cast<const unsigned char *>(se_runtime_allocator_alloc_zeroed(256));
+  for (int i = 0; i < 256; ++i) {
+    EXPECT_EQ(p[i], 0);
+  }
+  se_runtime_allocator_dealloc(const_cast<unsigned char *>(p));
+
+  se_runtime_allocator_set(&previous);
+}
+
+TEST(se_runtime_allocator_stats, disabled_build_reports_zero) {
+  if (se_runtime_allocator_stats_is_enabled()) {
+    GTEST_SKIP() << "SE_LIBRARY_OPTION_ALLOC_STATS is ON";
+  }
+
+  se_runtime_allocator_dealloc(se_runtime_allocator_alloc(100));
+
+  se_runtime_allocator_stats_t stats;
+  se_runtime_allocator_stats_snapshot(&stats);
+  EXPECT_EQ(stats.alloc_count, 0u);
+  EXPECT_EQ(stats.thread_count, 0u);
+}
+
+TEST(se_runtime_allocator_stats, thread_counters) {
+  if (!se_runtime_allocator_stats_is_enabled()) {
+    GTEST_SKIP() << "SE_LIBRARY_OPTION_ALLOC_STATS is OFF";
+  }
+#ifndef SE_LIBRARY_OPTION_THREAD_LOCAL
+  GTEST_SKIP() << "SE_LIBRARY_OPTION_THREAD_LOCAL is OFF";
+#endif
+
+  // A fresh thread starts with empty counters
+  std::thread([] {
+    std::vector<void *> blocks;
+    for (int i = 0; i < 10; ++i) {
+      blocks.push_back(se_runtime_allocator_alloc(100));
+    }
+    blocks.push_back(se_runtime_allocator_alloc_aligned(5000, 4096));
+    blocks.push_back(se_runtime_allocator_alloc_zeroed(0));
+
+    se_runtime_allocator_stats_t stats;
+    se_runtime_allocator_stats_thread(&stats);
+    EXPECT_EQ(stats.alloc_count, 12u);
+    EXPECT_EQ(stats.dealloc_count, 0u);
+    EXPECT_EQ(stats.live_bytes, 10u * 100 + 5000);
+    EXPECT_EQ(stats.histogram[6], 10u);
+    EXPECT_EQ(stats.histogram[12], 1u);
+    EXPECT_EQ(stats.histogram[0], 1u);
+
+    for (void *p : blocks) {
+      se_runtime_allocator_dealloc(p);
+    }
+    se_runtime_allocator_stats_thread(&stats);
+    EXPECT_EQ(stats.dealloc_count, 12u);
+    EXPECT_EQ(stats.live_bytes, 0u);
+  }).join();
+}
+
+TEST(se_runtime_allocator_stats, snapshot_aggregates_threads) {
+  if (!se_runtime_allocator_stats_is_enabled()) {
+    GTEST_SKIP() << "SE_LIBRARY_OPTION_ALLOC_STATS is OFF";
+  }
+
+  se_runtime_allocator_stats_t before;
+  se_runtime_allocator_stats_snapshot(&before);
+
+  // Blocks are freed by a thread other than the one that allocated them
+  constexpr int kBlocks = 1000;
+  std::vector<void *> blocks(kBlocks);
+  std::thread([&] {
+    for (void *&p : blocks) {
+      p = se_runtime_allocator_alloc(1024);
+    }
+  }).join();
+
+  se_runtime_allocator_stats_t live;
+  se_runtime_allocator_stats_snapshot(&live);
+  EXPECT_EQ(live.alloc_count - before.alloc_count, u64{kBlocks});
+  EXPECT_EQ(live.live_bytes - before.live_bytes, u64{kBlocks} * 1024);
+  EXPECT_GE(live.peak_bytes, live.live_bytes);
+#ifdef SE_LIBRARY_OPTION_THREAD_LOCAL
+  // Without thread-local storage all threads share one counter block
+  EXPECT_GT(live.thread_count, before.thread_count);
+#endif
+
+  std::thread([&] {
+    for (void *p : blocks) {
+      se_runtime_allocator_dealloc(p);
+    }
+  }).join();
+
+  se_runtime_allocator_stats_t after;
+  se_runtime_allocator_stats_snapshot(&after);
+  EXPECT_EQ(after.dealloc_count - before.dealloc_count, u64{kBlocks});
+  EXPECT_EQ(after.live_bytes, before.live_bytes);
+  EXPECT_GE(after.peak_bytes, live.live_bytes);
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <se/runtime_allocator.h>
+#include <se/runtime_try.h>
+#include <se/runtime_throw.h>
+
+#include <thread>
+
+namespace {
+
+constexpr int kDepth = 1000;
+
+void fail() {
+  // Running out of memory is checked at every runtime check level
+  se_runtime_allocator_alloc(SE_USIZE_T_MAX);
+}
+
+// Every level catches the exception and rethrows it to the next one
+void nest(int depth, int *caught) {
+  se_runtime_try(frame) {
+    if (depth) {
+      nest(depth - 1, caught);
+    } else {
+      fail();
+    }
+    se_runtime_try_finalize();
+  }
+  else {
+    ++*caught;
+    if (depth != kDepth) {
+      se_runtime_rethrow();
+    }
+  }
+}
+
+}  // namespace
+
+TEST(se_runtime_try, starts_empty) {
+  EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+}
+
+TEST(se_runtime_try, finalize_pops_frame) {
+  se_runtime_try(frame) {
+    EXPECT_FALSE(se_runtime_exception_catch_stack_is_begin());
+    EXPECT_EQ(se_runtime_try_finalize(), &frame);
+  }
+
+  EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+  EXPECT_EQ(se_runtime_exception_catch_stack_get_current(), &frame);
+}
+
+TEST(se_runtime_try, catches_into_innermost_frame) {
+  bool inner_caught = false;
+  bool outer_caught = false;
+
+  se_runtime_try(outer) {
+    se_runtime_try(inner) {
+      fail();
+      se_runtime_try_finalize();
+    }
+    else {
+      inner_caught = true;
+      EXPECT_EQ(se_error_get_code(&inner.exception.err), SE_RUNTIME_ERROR_OUT_OF_MEMORY);
+    }
+    se_runtime_try_finalize();
+  }
+  else {
+    outer_caught = true;
+  }
+
+  EXPECT_TRUE(inner_caught);
+  EXPECT_FALSE(outer_caught);
+  EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+}
+
+TEST(se_runtime_try, nests_without_depth_limit) {
+  int caught = 0;
+  nest(kDepth, &caught);
+
+  EXPECT_EQ(caught, kDepth + 1);
+  EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+}
+
+TEST(se_runtime_try, works_on_new_threads) {
+  bool caught = false;
+  std::thread worker([&] {
+    EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+    se_runtime_try(frame) {
+      fail();
+      se_runtime_try_finalize();
+    }
+    else {
+      caught = true;
+    }
+    EXPECT_TRUE(se_runtime_exception_catch_stack_is_begin());
+  });
+  worker.join();
+
+  EXPECT_TRUE(caught);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <se/rwlock.h>
+#include <se/atomic.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST(se_rwlock_try_lock, readers_share_writers_exclude) {
+  se_rwlock_t lock;
+  se_rwlock_init(&lock, nullptr);
+
+  EXPECT_TRUE(se_rwlock_try_read_lock(&lock));
+  EXPECT_TRUE(se_rwlock_try_read_lock(&lock));
+  EXPECT_FALSE(se_rwlock_try_write_lock(&lock));
+  se_rwlock_read_unlock(&lock);
+  se_rwlock_read_unlock(&lock);
+
+  EXPECT_TRUE(se_rwlock_try_write_lock(&lock));
+  EXPECT_FALSE(se_rwlock_try_read_lock(&lock));
+  EXPECT_FALSE(se_rwlock_try_write_lock(&lock));
+  se_rwlock_write_unlock(&lock);
+}
+
+TEST(se_rwlock_lock, readers_see_consistent_pairs) {
+  constexpr int kReaders = 3;
+  constexpr int kWriters = 2;
+  constexpr int kIterations = 10000;
+
+  se_rwlock_t lock;
+  se_rwlock_init(&lock, nullptr);
+
+  // Writers keep the two halves equal; a torn read would see them differ
+  long first = 0;
+  long second = 0;
+  std::atomic<int> torn{0};
+
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations; ++i) {
+        se_rwlock_write_lock(&lock);
+        ++first;
+        ++second;
+        se_rwlock_write_unlock(&lock);
+      }
+    });
+  }
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < kIterations; ++i) {
+        se_rwlock_read_lock(&lock);
+        if (first != second) {
+          torn.fetch_add(1);
+        }
+        se_rwlock_read_unlock(&lock);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(torn.load(), 0);
+  EXPECT_EQ(first, static_cast<long>(kWriters) * kIterations);
+}
+
+TEST(se_rwlock_lock, waiting_writer_blocks_new_readers) {
+  se_lock_stats_t stats = {};
+  se_rwlock_t lock;
+  se_rwlock_init(&lock, &stats);
+
+  se_rwlock_read_lock(&lock);
+
+  std::atomic<bool> written{false};
+  std::thread writer([&] {
+    se_rwlock_write_lock(&lock);
+    written.store(true);
+    se_rwlock_write_unlock(&lock);
+  });
+
+  // Wait until the writer has queued itself behind the reader
+  while (se_atomic_u64_load(&stats.wait_count, SE_ATOMIC_ORDER_RELAXED) == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_FALSE(se_rwlock_try_read_lock(&lock));
+
+  // A blocking reader must also let the writer go first
+  std::atomic<bool> reader_saw_write{false};
+  std::thread reader([&] {
+    se_rwlock_read_lock(&lock);
+    reader_saw_write.store(written.load());
+    se_rwlock_read_unlock(&lock);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  se_rwlock_read_unlock(&lock);
+  writer.join();
+  reader.join();
+
+  EXPECT_TRUE(written.load());
+  EXPECT_TRUE(reader_saw_write.load());
+  EXPECT_EQ(se_atomic_u64_load(&stats.contended_count, SE_ATOMIC_ORDER_RELAXED), 2u);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <se/string.h>
+
+#include <cstring>
+#include <string>
+
+namespace {
+
+std::string contents(const se_string_t &str) {
+  return std::string(se_string_get_cstr(&str), se_string_get_size(&str));
+}
+
+} // namespace
+
+TEST(se_string_init, empty_inline) {
+  se_string_t str;
+  se_string_init(&str);
+
+  EXPECT_TRUE(se_string_is_inline(&str));
+  EXPECT_EQ(se_string_get_size(&str), 0u);
+  EXPECT_EQ(se_string_get_capacity(&str), SE_STRING_INLINE_CAPACITY);
+  EXPECT_STREQ(se_string_get_cstr(&str), "");
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_append, full_inline_buffer_is_terminated) {
+  const std::string text(SE_STRING_INLINE_CAPACITY, 'x');
+
+  se_string_t str;
+  se_string_init(&str);
+  se_string_append(&str, text.data(), text.size());
+
+  EXPECT_TRUE(se_string_is_inline(&str));
+  EXPECT_EQ(sizeof(se_string_t), 3 * sizeof(void *));
+  EXPECT_STREQ(se_string_get_cstr(&str), text.c_str());
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_append, spills_to_heap_and_grows) {
+  se_string_t str;
+  se_string_init(&str);
+
+  std::string expected;
+  for (int i = 0; i < 200; ++i) {
+    const char chunk[] = "abc";
+    se_string_append(&str, chunk, 3);
+    expected += chunk;
+  }
+
+  EXPECT_FALSE(se_string_is_inline(&str));
+  EXPECT_EQ(contents(str), expected);
+  EXPECT_GE(se_string_get_capacity(&str), expected.size());
+  EXPECT_STREQ(se_string_get_cstr(&str), expected.c_str());
+
+  // Capacity is kept after clear
+  const se_usize_t capacity = se_string_get_capacity(&str);
+  se_string_clear(&str);
+  EXPECT_EQ(se_string_get_size(&str), 0u);
+  EXPECT_EQ(se_string_get_capacity(&str), capacity);
+  EXPECT_STREQ(se_string_get_cstr(&str), "");
+
+  se_string_deinit(&str);
+  EXPECT_TRUE(se_string_is_inline(&str));
+}
+
+TEST(se_string_assign, replaces_contents) {
+  se_string_t str;
+  se_string_init(&str);
+
+  se_string_assign(&str, "a long string that does not fit inline", 38);
+  se_string_assign(&str, "short", 5);
+  EXPECT_EQ(contents(str), "short");
+
+  se_string_assign(&str, nullptr, 0);
+  EXPECT_EQ(se_string_get_size(&str), 0u);
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_assign, from_own_data) {
+  se_string_t str;
+  se_string_init(&str);
+
+  // Inline, then spilling to the heap, then growing the heap block
+  std::string expected = "abcdef";
+  se_string_assign(&str, expected.data(), expected.size());
+  for (int i = 0; i < 6; ++i) {
+    se_string_append(&str, se_string_get_cstr(&str), se_string_get_size(&str));
+    expected += expected;
+    EXPECT_EQ(contents(str), expected);
+  }
+
+  se_string_assign(&str, se_string_get_cstr(&str) + 3, 10);
+  EXPECT_EQ(contents(str), expected.substr(3, 10));
+
+  se_string_assign(&str, se_string_get_cstr(&str), se_string_get_size(&str));
+  EXPECT_EQ(contents(str), expected.substr(3, 10));
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_reserve, keeps_contents) {
+  se_string_t str;
+  se_string_init(&str);
+  se_string_append(&str, "hello", 5);
+
+  se_string_reserve(&str, 1000);
+  EXPECT_FALSE(se_string_is_inline(&str));
+  EXPECT_EQ(se_string_get_capacity(&str), 1000u);
+  EXPECT_EQ(contents(str), "hello");
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_append, embedded_zero_bytes) {
+  const char data[] = {'a', '\0', 'b'};
+
+  se_string_t str;
+  se_string_init(&str);
+  se_string_append(&str, data, sizeof(data));
+
+  EXPECT_EQ(se_string_get_size(&str), 3u);
+  EXPECT_EQ(se_string_find(&str, "b", 1), 2u);
+
+  const se_memory_view_t view = se_string_get_view(&str);
+  EXPECT_EQ(static_cast<const char *>(view.end) -
+                static_cast<const char *>(view.begin),
+            3);
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_find, inline_and_heap) {
+  for (const std::string text :
+       {std::string("abcabc"), std::string(100, '.') + "abcabc" + std::string(50, '.')}) {
+    se_string_t str;
+    se_string_init(&str);
+    se_string_assign(&str, text.data(), text.size());
+
+    EXPECT_EQ(se_string_find(&str, "bc", 2), text.find("bc"));
+    EXPECT_EQ(se_string_rfind(&str, "bc", 2), text.rfind("bc"));
+    EXPECT_EQ(se_string_find(&str, "cb", 2), SE_STRING_NPOS);
+    EXPECT_EQ(se_string_find(&str, "", 0), 0u);
+    EXPECT_EQ(se_string_rfind(&str, "", 0), text.size());
+
+    se_string_deinit(&str);
+  }
+}
+
+TEST(se_string_starts_with, prefix_and_suffix) {
+  se_string_t str;
+  se_string_init(&str);
+  se_string_assign(&str, "prefix.body.suffix", 18);
+
+  EXPECT_TRUE(se_string_starts_with(&str, "prefix", 6));
+  EXPECT_FALSE(se_string_starts_with(&str, "suffix", 6));
+  EXPECT_TRUE(se_string_ends_with(&str, "suffix", 6));
+  EXPECT_FALSE(se_string_ends_with(&str, "prefix", 6));
+  EXPECT_TRUE(se_string_starts_with(&str, "", 0));
+  EXPECT_FALSE(se_string_ends_with(&str, "a longer string than the body", 29));
+
+  se_string_deinit(&str);
+}
+
+TEST(se_string_append, null_data) {
+  se_string_t str;
+  se_string_init(&str);
+  EXPECT_DEATH(se_string_append(&str, nullptr, 1), ".*");
+  se_string_deinit(&str);
+}
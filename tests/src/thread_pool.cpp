@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+#include <se/thread_pool.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct fib_job {
+  se_thread_pool_t *pool;
+  unsigned n;
+  std::uint64_t result;
+};
+
+// Fork-join recursion: without helping while waiting, two workers would
+// block on their children almost immediately
+void fib(void *context) {
+  fib_job *job = static_cast<fib_job *>(context);
+  if (job->n < 2) {
+    job->result = job->n;
+    return;
+  }
+
+  fib_job left = {job->pool, job->n - 1, 0};
+  fib_job right = {job->pool, job->n - 2, 0};
+
+  se_thread_pool_task_t *task = se_thread_pool_spawn(job->pool, fib, &left);
+  fib(&right);
+  se_thread_pool_wait(job->pool, task);
+
+  job->result = left.result + right.result;
+}
+
+void increment(void *context) {
+  static_cast<std::atomic<int> *>(context)->fetch_add(1, std::memory_order_relaxed);
+}
+
+struct index_job {
+  se_thread_pool_t *pool;
+  std::size_t index;
+};
+
+void record_index(void *context) {
+  index_job *job = static_cast<index_job *>(context);
+  job->index = se_thread_pool_get_worker_index(job->pool);
+}
+
+struct fan_out_job {
+  se_thread_pool_t *pool;
+  std::atomic<int> *counter;
+  int children;
+};
+
+// Spawns more children than the initial queue capacity before waiting for any
+void fan_out(void *context) {
+  fan_out_job *job = static_cast<fan_out_job *>(context);
+
+  std::vector<se_thread_pool_task_t *> tasks;
+  for (int i = 0; i < job->children; ++i) {
+    tasks.push_back(se_thread_pool_spawn(job->pool, increment, job->counter));
+  }
+  for (se_thread_pool_task_t *task : tasks) {
+    se_thread_pool_wait(job->pool, task);
+  }
+}
+
+void occupy_worker(void *context) {
+  static_cast<std::atomic<bool> *>(context)->store(true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+}
+
+struct nested_job {
+  se_thread_pool_t *pool;
+  std::atomic<int> *counter;
+};
+
+// A large frame that stays live while the task waits for its child
+void nested_wait(void *context) {
+  nested_job *job = static_cast<nested_job *>(context);
+
+  volatile char frame[64 * 1024];
+  frame[0] = 1;
+  frame[sizeof(frame) - 1] = 1;
+
+  se_thread_pool_wait(job->pool, se_thread_pool_spawn(job->pool, increment, job->counter));
+  frame[0] = frame[sizeof(frame) - 1];
+}
+
+} // namespace
+
+TEST(se_thread_pool_init, starts_requested_workers) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 3);
+  EXPECT_EQ(se_thread_pool_get_worker_count(&pool), 3u);
+  EXPECT_EQ(se_thread_pool_get_worker_index(&pool), SE_THREAD_POOL_NOT_WORKER);
+  se_thread_pool_deinit(&pool);
+
+  se_thread_pool_init(&pool, 0);
+  EXPECT_GE(se_thread_pool_get_worker_count(&pool), 1u);
+  se_thread_pool_deinit(&pool);
+}
+
+TEST(se_thread_pool_spawn, runs_task_from_outside_thread) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 2);
+
+  std::atomic<int> counter{0};
+  se_thread_pool_task_t *task = se_thread_pool_spawn(&pool, increment, &counter);
+  se_thread_pool_wait(&pool, task);
+  EXPECT_EQ(counter.load(), 1);
+
+  se_thread_pool_deinit(&pool);
+}
+
+TEST(se_thread_pool_spawn, reports_worker_index_inside_tasks) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 4);
+
+  std::vector<index_job> jobs(64, index_job{&pool, 0});
+  std::vector<se_thread_pool_task_t *> tasks;
+  for (index_job &job : jobs) {
+    tasks.push_back(se_thread_pool_spawn(&pool, record_index, &job));
+  }
+  for (se_thread_pool_task_t *task : tasks) {
+    se_thread_pool_wait(&pool, task);
+  }
+
+  // The waiting thread may run some tasks itself while helping
+  for (const index_job &job : jobs) {
+    EXPECT_TRUE(job.index < 4u || job.index == SE_THREAD_POOL_NOT_WORKER);
+  }
+
+  se_thread_pool_deinit(&pool);
+}
+
+TEST(se_thread_pool_wait, recursive_fork_join) {
+  for (se_usize_t workers : {1u, 2u, 8u}) {
+    se_thread_pool_t pool;
+    se_thread_pool_init(&pool, workers);
+
+    fib_job job = {&pool, 22, 0};
+    se_thread_pool_task_t *task = se_thread_pool_spawn(&pool, fib, &job);
+    se_thread_pool_wait(&pool, task);
+    EXPECT_EQ(job.result, 17711u);
+
+    se_thread_pool_deinit(&pool);
+  }
+}
+
+TEST(se_thread_pool_wait, outside_thread_helps_with_bounded_nesting) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 1);
+
+  // With the only worker busy, the waiting thread runs everything itself
+  std::atomic<bool> started{false};
+  se_thread_pool_task_t *blocker = se_thread_pool_spawn(&pool, occupy_worker, &started);
+  while (!started.load()) {
+    std::this_thread::yield();
+  }
+
+  // Each task waits for a child queued behind all the others: a waiter that
+  // kept helping through the shared queue would nest every task on its stack
+  std::atomic<int> counter{0};
+  std::vector<nested_job> jobs(256, nested_job{&pool, &counter});
+  std::vector<se_thread_pool_task_t *> tasks;
+  for (nested_job &job : jobs) {
+    tasks.push_back(se_thread_pool_spawn(&pool, nested_wait, &job));
+  }
+  for (se_thread_pool_task_t *task : tasks) {
+    se_thread_pool_wait(&pool, task);
+  }
+  se_thread_pool_wait(&pool, blocker);
+  EXPECT_EQ(counter.load(), 256);
+
+  se_thread_pool_deinit(&pool);
+}
+
+TEST(se_thread_pool_wait, grows_worker_queue) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 2);
+
+  std::atomic<int> counter{0};
+  fan_out_job job = {&pool, &counter, SE_THREAD_POOL_DEQUE_CAPACITY * 4};
+  se_thread_pool_task_t *task = se_thread_pool_spawn(&pool, fan_out, &job);
+  se_thread_pool_wait(&pool, task);
+  EXPECT_EQ(counter.load(), SE_THREAD_POOL_DEQUE_CAPACITY * 4);
+
+  se_thread_pool_deinit(&pool);
+}
+
+TEST(se_thread_pool_submit, deinit_runs_remaining_tasks) {
+  se_thread_pool_t pool;
+  se_thread_pool_init(&pool, 4);
+
+  // More than the shared queue holds: the caller runs the overflow itself
+  std::atomic<int> counter{0};
+  for (int i = 0; i < SE_THREAD_POOL_INJECT_CAPACITY * 4; ++i) {
+    se_thread_pool_submit(&pool, increment, &counter);
+  }
+
+  se_thread_pool_deinit(&pool);
+  EXPECT_EQ(counter.load(), SE_THREAD_POOL_INJECT_CAPACITY * 4);
+}
+
+TEST(se_thread_pool_deinit, repeated_init_spawn_wait) {
+  // Pools of different sizes are created over the memory of the previous ones
+  for (unsigned round = 0; round < 200; ++round) {
+    se_thread_pool_t pool;
+    se_thread_pool_init(&pool, 1 + round % 4);
+
+    fib_job job = {&pool, 16, 0};
+    se_thread_pool_task_t *task = se_thread_pool_spawn(&pool, fib, &job);
+    fib_job direct = {&pool, 12, 0};
+    fib(&direct);
+    se_thread_pool_wait(&pool, task);
+    EXPECT_EQ(job.result, 987u);
+    EXPECT_EQ(direct.result, 144u);
+
+    std::atomic<int> counter{0};
+    for (int i = 0; i < 64; ++i) {
+      se_thread_pool_submit(&pool, increment, &counter);
+    }
+
+    se_thread_pool_deinit(&pool);
+    ASSERT_EQ(counter.load(), 64) << "round " << round;
+  }
+}